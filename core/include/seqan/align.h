@@ -56,6 +56,7 @@
 // TODO(holtgrew): Why not use priority queue from STL?
 #include <seqan/misc/priority_type_base.h>
 #include <seqan/misc/priority_type_heap.h>
+#include <seqan/misc/misc_bit_twiddling.h>  // popCount() for the bit-vector traceback.
 
 // ============================================================================
 // Support
@@ -121,6 +122,10 @@
 #include <seqan/align/dp_trace_segment.h>
 #include <seqan/align/dp_traceback_adaptor.h>
 
+// Reusable workspace holding the matrices and trace segments of the dynamic
+// programming between alignment calls.
+#include <seqan/align/dp_context.h>
+
 // Ensures the backwards compatibility for the global interfaces of the
 // alignment algorithms. Based on the called function this selects the
 // correct parameters for the new alignment module.
@@ -139,6 +144,7 @@
 // as a host.
 #include <seqan/align/dp_matrix.h>
 #include <seqan/align/dp_matrix_sparse.h>
+#include <seqan/align/dp_matrix_packed.h>
 
 // The navigator that based on the selected profile and band chooses the
 // correct way to navigate through the matrix.
@@ -152,6 +158,14 @@
 #include <seqan/align/dp_traceback_impl.h>
 #include <seqan/align/dp_algorithm_impl.h>
 
+// Score-only computation of many independent pairs at once, one pair per
+// lane of a vector register.
+#include <seqan/align/dp_batch_simd.h>
+
+// Computes the tiles of very large matrices in parallel along the
+// anti-diagonals of the tile grid.
+#include <seqan/align/dp_wavefront.h>
+
 //################################################################################
 // Old module
 //################################################################################
@@ -190,6 +204,10 @@
 #include <seqan/align/local_alignment_unbanded.h>
 #include <seqan/align/local_alignment_banded.h>
 
+// The striped Smith-Waterman with a query profile for aligning one query
+// against many database sequences.
+#include <seqan/align/local_alignment_striped.h>
+
 // The front-end for enumeration of local alignments.
 #include <seqan/align/local_alignment_enumeration.h>  // documentation
 #include <seqan/align/local_alignment_enumeration_unbanded.h>
@@ -199,6 +217,9 @@
 // Hirschberg, Myers and Myers-Hirschberg.
 #include <seqan/align/global_alignment_specialized.h>
 
+// The parallel front-end for aligning many pairs of sequences of a StringSet.
+#include <seqan/align/align_pairs.h>
+
 // ============================================================================
 // Operations On Alignments
 // ============================================================================
@@ -0,0 +1,435 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Aligns many pairs of sequences of a StringSet in parallel.
+// ==========================================================================
+
+#ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_ALIGN_PAIRS_H_
+#define SEQAN_CORE_INCLUDE_SEQAN_ALIGN_ALIGN_PAIRS_H_
+
+#include <algorithm>
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+/**
+.Tag.Result Order
+..cat:Alignments
+..summary:Selects whether @Function.alignPairs@ reports the results in the order of the pairs.
+..tag.Ordered:The results are reported in the order of the pairs.
+Results of pairs that finish early are kept until all preceding pairs are reported.
+The pairs are aligned in windows of consecutive pairs, so at most one window of results is kept.
+..tag.Unordered:The results are reported as soon as the alignment of a pair is finished.
+..include:seqan/align.h
+*/
+
+struct Ordered_;
+typedef Tag<Ordered_> Ordered;
+
+struct Unordered_;
+typedef Tag<Unordered_> Unordered;
+
+// ----------------------------------------------------------------------------
+// Class AlignPairsCellsGreater_
+// ----------------------------------------------------------------------------
+
+// Orders pair positions by decreasing number of dp cells.  Ties are broken by
+// the position to keep the schedule deterministic.
+template <typename TCells>
+struct AlignPairsCellsGreater_
+{
+    TCells const & cells;
+
+    AlignPairsCellsGreater_(TCells const & _cells) : cells(_cells)
+    {}
+
+    template <typename TPos>
+    inline bool operator()(TPos left, TPos right) const
+    {
+        if (cells[left] != cells[right])
+            return cells[left] > cells[right];
+        return left < right;
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Class AlignPairsCollector_
+// ----------------------------------------------------------------------------
+
+// Delegate of alignPairs() that appends the fragments in the order of the
+// pairs and records one score per pair.
+template <typename TFragments, typename TScores>
+struct AlignPairsCollector_
+{
+    TFragments & matches;
+    TScores & scores;
+
+    AlignPairsCollector_(TFragments & _matches, TScores & _scores) : matches(_matches), scores(_scores)
+    {}
+
+    template <typename TPos, typename TScoreValue, typename TPairFragments>
+    inline void operator()(TPos pos, TScoreValue score, TPairFragments const & fragments)
+    {
+        scores[pos] = score;
+        append(matches, fragments);
+    }
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Metafunction AlignPairsWindowSize_
+// ----------------------------------------------------------------------------
+
+// Number of consecutive pairs that are aligned before the next pairs start if
+// the results are reported in order.  Bounds the number of pending results.
+template <typename TOrderTag>
+struct AlignPairsWindowSize_
+{
+    static const unsigned VALUE = 1024;
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _alignPairsSchedule()
+// ----------------------------------------------------------------------------
+
+// Returns the positions of the pairs sorted by decreasing number of dp cells
+// within each window of windowSize consecutive pairs.  The threads take the
+// pairs of a window dynamically in this order, such that the longest
+// alignments start first and the short ones fill the gaps at the end.
+template <typename TSchedule, typename TSequence, typename TStringSetSpec, typename TPairs, typename TSize>
+inline void
+_alignPairsSchedule(TSchedule & schedule,
+                    StringSet<TSequence, TStringSetSpec> const & strings,
+                    TPairs const & pairs,
+                    TSize windowSize)
+{
+    typedef typename Value<TSchedule>::Type TPos;
+    typedef typename Iterator<TSchedule, Standard>::Type TIter;
+
+    String<__uint64> cells;
+    resize(cells, length(pairs), Exact());
+    resize(schedule, length(pairs), Exact());
+    for (TPos pos = 0; pos < static_cast<TPos>(length(pairs)); ++pos)
+    {
+        cells[pos] = static_cast<__uint64>(length(strings[pairs[pos].i1]) + 1) *
+                     static_cast<__uint64>(length(strings[pairs[pos].i2]) + 1);
+        schedule[pos] = pos;
+    }
+    for (TIter it = begin(schedule, Standard()); it != end(schedule, Standard()); )
+    {
+        TIter itEnd = (end(schedule, Standard()) - it > (__int64)windowSize) ? it + windowSize : end(schedule, Standard());
+        std::sort(it, itEnd, AlignPairsCellsGreater_<String<__uint64> >(cells));
+        it = itEnd;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _alignPairs()
+// ----------------------------------------------------------------------------
+
+// Every thread keeps its own DPContext.  The delegate is called within a
+// critical section, hence it does not need to be thread-safe.  In ordered mode
+// the pairs are aligned window by window and only the results of the current
+// window are buffered.
+template <typename TDelegate, typename TSequence, typename TStringSetSpec, typename TPairs,
+          typename TScoreValue, typename TScoreSpec, typename TAlignConfig, typename TAlgoTag, typename TOrderTag>
+inline void
+_alignPairs(TDelegate & delegate,
+            StringSet<TSequence, TStringSetSpec> const & strings,
+            TPairs const & pairs,
+            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+            TAlignConfig const & alignConfig,
+            TAlgoTag const & algoTag,
+            TOrderTag const &,
+            typename Size<TPairs>::Type windowSize)
+{
+    typedef typename Size<TPairs>::Type TSize;
+    typedef typename MakeSigned<TSize>::Type TSignedSize;
+    typedef String<Fragment<> > TFragments;
+    typedef TraceSegment_<size_t, size_t> TTraceSegment;
+
+    bool const isOrdered = IsSameType<TOrderTag, Ordered>::VALUE;
+    TSignedSize numPairs = length(pairs);
+    if (!isOrdered || windowSize == 0u || windowSize > static_cast<TSize>(numPairs))
+        windowSize = _max(static_cast<TSize>(numPairs), static_cast<TSize>(1));
+
+    String<TSize> schedule;
+    _alignPairsSchedule(schedule, strings, pairs, windowSize);
+
+    // Buffers of the results of the current window that can not be reported yet.
+    String<TScoreValue> pendingScores;
+    String<TFragments> pendingFragments;
+    String<bool> finished;
+    TSize nextPos = 0;
+    if (isOrdered)
+    {
+        resize(pendingScores, windowSize, Exact());
+        resize(pendingFragments, windowSize, Exact());
+        resize(finished, windowSize, false, Exact());
+    }
+
+    SEQAN_OMP_PRAGMA(parallel)
+    {
+        DPContext<TScoreValue> dpContext;
+        String<TTraceSegment> traceSegments;
+        TFragments fragments;
+
+        // The implicit barrier of the loop finishes a window before the next starts.
+        for (TSignedSize windowBegin = 0; windowBegin < numPairs; windowBegin += (TSignedSize)windowSize)
+        {
+            TSignedSize windowEnd = _min(windowBegin + (TSignedSize)windowSize, numPairs);
+
+            SEQAN_OMP_PRAGMA(for schedule(dynamic))
+            for (TSignedSize i = windowBegin; i < windowEnd; ++i)
+            {
+                TSize pos = schedule[i];
+                TSize posH = pairs[pos].i1;
+                TSize posV = pairs[pos].i2;
+
+                clear(traceSegments);
+                clear(fragments);
+                TScoreValue score = _setUpAndRunAlignment(dpContext, traceSegments, strings[posH], strings[posV],
+                                                          scoringScheme, alignConfig, algoTag, GapsLeft());
+                _adaptTraceSegmentsTo(fragments, positionToId(strings, posH), positionToId(strings, posV),
+                                      traceSegments);
+
+                TSize slot = pos % windowSize;
+                if (isOrdered)
+                {
+                    pendingScores[slot] = score;
+                    move(pendingFragments[slot], fragments);
+                }
+
+                SEQAN_OMP_PRAGMA(critical(alignPairsReport))
+                {
+                    if (isOrdered)
+                    {
+                        finished[slot] = true;
+                        for (; nextPos < static_cast<TSize>(windowEnd) && finished[nextPos % windowSize]; ++nextPos)
+                        {
+                            slot = nextPos % windowSize;
+                            delegate(nextPos, pendingScores[slot], pendingFragments[slot]);
+                            clear(pendingFragments[slot]);
+                            shrinkToFit(pendingFragments[slot]);
+                            finished[slot] = false;
+                        }
+                    }
+                    else
+                    {
+                        delegate(pos, score, fragments);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <typename TDelegate, typename TSequence, typename TStringSetSpec, typename TPairs,
+          typename TScoreValue, typename TScoreSpec, typename TAlignConfig, typename TAlgoTag, typename TOrderTag>
+inline void
+_alignPairs(TDelegate & delegate,
+            StringSet<TSequence, TStringSetSpec> const & strings,
+            TPairs const & pairs,
+            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+            TAlignConfig const & alignConfig,
+            TAlgoTag const & algoTag,
+            TOrderTag const & orderTag)
+{
+    _alignPairs(delegate, strings, pairs, scoringScheme, alignConfig, algoTag, orderTag,
+                AlignPairsWindowSize_<TOrderTag>::VALUE);
+}
+
+// ----------------------------------------------------------------------------
+// Function alignPairs()
+// ----------------------------------------------------------------------------
+
+/**
+.Function.alignPairs
+..cat:Alignments
+..summary:Computes the pairwise alignments of many pairs of sequences in parallel.
+..signature:alignPairs(delegate, strings, pairs, scoringScheme, alignConfig, algorithmTag, orderTag)
+..signature:alignPairs(matches, scores, strings, pairs, scoringScheme, alignConfig, algorithmTag)
+..param.delegate:Functor that is called as $delegate(pos, score, fragments)$ for each aligned pair.
+...remarks:$pos$ is the position of the pair in $pairs$ and $fragments$ is a @Class.String@ of @Class.Fragment@ objects.
+The delegate is called by one thread at a time.
+..param.matches:The fragments of all alignments are appended to this string in the order of the pairs.
+...type:Class.String
+..param.scores:Resized to the number of pairs and filled with the score of each pair.
+...type:Class.String
+..param.strings:The sequences to align.
+...type:Class.StringSet
+..param.pairs:A string of @Class.Pair@ objects with the positions of the two sequences in $strings$.
+...type:Class.String
+..param.scoringScheme:The scoring scheme to use for the alignments.
+...type:Class.Score
+..param.alignConfig:The @Class.AlignConfig@ to use for global alignments.
+...type:Class.AlignConfig
+..param.algorithmTag:The algorithm to use.
+...type:Tag.Pairwise Global Alignment Algorithms.tag.NeedlemanWunsch
+...type:Tag.Pairwise Global Alignment Algorithms.tag.Gotoh
+...type:Tag.Pairwise Local Alignment Algorithms.tag.SmithWaterman
+..param.orderTag:Whether the delegate is called in the order of the pairs.
+...type:Tag.Result Order
+..remarks:
+The pairs are distributed dynamically over all OpenMP threads, starting with the pairs that have the largest dp matrices.
+With @Tag.Result Order.tag.Ordered@ the pairs are processed in windows of 1024 consecutive pairs, and the largest first
+order only applies within a window.
+The next window starts when all pairs of the current window are aligned, so at most the results of one window are buffered
+until they can be reported.
+Every thread reuses the buffers of its own @Class.DPContext@.
+The fragments use the ids of the sequences in $strings$.
+..see:Function.alignPairsScore
+..include:seqan/align.h
+*/
+
+template <typename TDelegate, typename TSequence, typename TStringSetSpec, typename TPairs,
+          typename TScoreValue, typename TScoreSpec, typename TAlignConfig, typename TAlgoTag, typename TOrderTag>
+inline void
+alignPairs(TDelegate & delegate,
+           StringSet<TSequence, TStringSetSpec> const & strings,
+           TPairs const & pairs,
+           Score<TScoreValue, TScoreSpec> const & scoringScheme,
+           TAlignConfig const & alignConfig,
+           TAlgoTag const & algoTag,
+           TOrderTag const & orderTag)
+{
+    _alignPairs(delegate, strings, pairs, scoringScheme, alignConfig, algoTag, orderTag);
+}
+
+template <typename TSize, typename TFragmentSpec, typename TStringSpec, typename TScores,
+          typename TSequence, typename TStringSetSpec, typename TPairs,
+          typename TScoreValue, typename TScoreSpec, typename TAlignConfig, typename TAlgoTag>
+inline void
+alignPairs(String<Fragment<TSize, TFragmentSpec>, TStringSpec> & matches,
+           TScores & scores,
+           StringSet<TSequence, TStringSetSpec> const & strings,
+           TPairs const & pairs,
+           Score<TScoreValue, TScoreSpec> const & scoringScheme,
+           TAlignConfig const & alignConfig,
+           TAlgoTag const & algoTag)
+{
+    typedef String<Fragment<TSize, TFragmentSpec>, TStringSpec> TFragments;
+
+    resize(scores, length(pairs), Exact());
+    AlignPairsCollector_<TFragments, TScores> collector(matches, scores);
+    _alignPairs(collector, strings, pairs, scoringScheme, alignConfig, algoTag, Ordered());
+}
+
+// ----------------------------------------------------------------------------
+// Function alignPairsScore()
+// ----------------------------------------------------------------------------
+
+/**
+.Function.alignPairsScore
+..cat:Alignments
+..summary:Computes the scores of the pairwise alignments of many pairs of sequences in parallel.
+..signature:alignPairsScore(scores, strings, pairs, scoringScheme, alignConfig, algorithmTag)
+..param.scores:Resized to the number of pairs and filled with the score of each pair.
+...type:Class.String
+..param.strings:The sequences to align.
+...type:Class.StringSet
+..param.pairs:A string of @Class.Pair@ objects with the positions of the two sequences in $strings$.
+...type:Class.String
+..param.scoringScheme:The scoring scheme to use for the alignments.
+...type:Class.Score
+..param.alignConfig:The @Class.AlignConfig@ to use for global alignments.
+...type:Class.AlignConfig
+..param.algorithmTag:The algorithm to use.
+...type:Tag.Pairwise Global Alignment Algorithms.tag.NeedlemanWunsch
+...type:Tag.Pairwise Global Alignment Algorithms.tag.Gotoh
+...type:Tag.Pairwise Local Alignment Algorithms.tag.SmithWaterman
+..remarks:
+No traceback is computed.
+The pairs are scheduled like in @Function.alignPairs@.
+..example.code:
+StringSet<Dna5String> reads;
+// ...
+String<Pair<unsigned> > pairs;
+for (unsigned i = 0; i < length(reads); ++i)
+    for (unsigned j = i + 1; j < length(reads); ++j)
+        appendValue(pairs, Pair<unsigned>(i, j));
+
+String<int> scores;
+alignPairsScore(scores, reads, pairs, Score<int, Simple>(1, -1, -1), AlignConfig<>(), NeedlemanWunsch());
+..see:Function.alignPairs
+..include:seqan/align.h
+*/
+
+template <typename TScores, typename TSequence, typename TStringSetSpec, typename TPairs,
+          typename TScoreValue, typename TScoreSpec, typename TAlignConfig, typename TAlgoTag>
+inline void
+alignPairsScore(TScores & scores,
+                StringSet<TSequence, TStringSetSpec> const & strings,
+                TPairs const & pairs,
+                Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                TAlignConfig const & alignConfig,
+                TAlgoTag const & algoTag)
+{
+    typedef typename Size<TPairs>::Type TSize;
+    typedef typename MakeSigned<TSize>::Type TSignedSize;
+
+    TSignedSize numPairs = length(pairs);
+    resize(scores, numPairs, Exact());
+
+    String<TSize> schedule;
+    _alignPairsSchedule(schedule, strings, pairs, length(pairs));
+
+    SEQAN_OMP_PRAGMA(parallel)
+    {
+        DPContext<TScoreValue> dpContext;
+
+        SEQAN_OMP_PRAGMA(for schedule(dynamic))
+        for (TSignedSize i = 0; i < numPairs; ++i)
+        {
+            TSize pos = schedule[i];
+            scores[pos] = _setUpAndRunAlignment(dpContext, strings[pairs[pos].i1], strings[pairs[pos].i2],
+                                                scoringScheme, alignConfig, algoTag);
+        }
+    }
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_ALIGN_PAIRS_H_
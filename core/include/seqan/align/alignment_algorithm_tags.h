@@ -84,6 +84,25 @@ typedef Tag<MyersBitVector_> MyersBitVector;
 struct MyersHirschberg_;
 typedef Tag<MyersHirschberg_> MyersHirschberg;
 
+// ----------------------------------------------------------------------------
+// Tag BandDoubling
+// ----------------------------------------------------------------------------
+
+/**
+.Tag.BandDoubling
+..cat:Alignments
+..summary:Selects a banded global alignment whose band is widened until the result is optimal.
+..signature:BandDoubling
+..remarks:The alignment starts with a narrow band around the diagonals of the two sequence ends.
+The band width is doubled until no alignment leaving the band can reach the score of the best alignment within the band.
+..see:Function.globalAlignment
+..see:Function.globalAlignmentScore
+..include:seqan/align.h
+*/
+
+struct BandDoubling_;
+typedef Tag<BandDoubling_> BandDoubling;
+
 // ----------------------------------------------------------------------------
 // Local Alignment Algorithm Tags
 // ----------------------------------------------------------------------------
@@ -1277,24 +1277,24 @@ void _printTracebackMatrix(TTraceMatrix & dpTraceMatrix)
 // Function _computeAligmnment()
 // ----------------------------------------------------------------------------
 
-template <typename TTraceTarget, typename TScoutState, typename TSequenceH, typename TSequenceV, typename TScoreScheme,
-          typename TBandSwitch, typename TAlignmentAlgorithm, typename TGapCosts, typename TTraceFlag>
+// Runs the alignment on the given score and trace matrices, which may be
+// backed by the buffers of a DPContext.
+template <typename TDPScoreMatrix, typename TDPTraceMatrix, typename TTraceTarget, typename TScoutState,
+          typename TSequenceH, typename TSequenceV, typename TScoreScheme, typename TBandSwitch,
+          typename TAlignmentAlgorithm, typename TGapCosts, typename TTraceFlag>
 inline typename Value<TScoreScheme>::Type
-_computeAlignment(TTraceTarget & traceSegments,
-                  TScoutState & scoutState,
-                  TSequenceH const & seqH,
-                  TSequenceV const & seqV,
-                  TScoreScheme const & scoreScheme,
-                  DPBand_<TBandSwitch> const & band,
-                  DPProfile_<TAlignmentAlgorithm, TGapCosts, TTraceFlag> const & dpProfile)
+_computeAlignmentImpl(TDPScoreMatrix & dpScoreMatrix,
+                      TDPTraceMatrix & dpTraceMatrix,
+                      TTraceTarget & traceSegments,
+                      TScoutState & scoutState,
+                      TSequenceH const & seqH,
+                      TSequenceV const & seqV,
+                      TScoreScheme const & scoreScheme,
+                      DPBand_<TBandSwitch> const & band,
+                      DPProfile_<TAlignmentAlgorithm, TGapCosts, TTraceFlag> const & dpProfile)
 {
     typedef typename Value<TScoreScheme>::Type TScoreValue;
-    typedef DPCell_<TScoreValue, TGapCosts> TDPScoreValue;
-    typedef typename DefaultScoreMatrixSpec_<TAlignmentAlgorithm>::Type TScoreMatrixSpec;
-    typedef typename TraceBitMap_::TTraceValue TTraceValue;
-
-    typedef DPMatrix_<TDPScoreValue, TScoreMatrixSpec> TDPScoreMatrix;
-    typedef DPMatrix_<TTraceValue, FullDPMatrix> TDPTraceMatrix;
+    typedef typename Value<TDPScoreMatrix>::Type TDPScoreValue;
 
     typedef DPMatrixNavigator_<TDPScoreMatrix, DPScoreMatrix, NavigateColumnWise> TDPScoreMatrixNavigator;
     typedef DPMatrixNavigator_<TDPTraceMatrix, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> TDPTraceMatrixNavigator;
@@ -1306,9 +1306,6 @@ _computeAlignment(TTraceTarget & traceSegments,
     if (!_isValidDPSettings(seqH, seqV, band, dpProfile))
         return MinValue<TScoreValue>::VALUE;
 
-    TDPScoreMatrix dpScoreMatrix;
-    TDPTraceMatrix dpTraceMatrix;
-
     // TODO(rmaerker): Check whether the matrix allocation can be reduced if upperDiagonal < 0?
     setLength(dpScoreMatrix, +DPMatrixDimension_::HORIZONTAL, length(seqH) + 1 - std::max(0, lowerDiagonal(band)));
     setLength(dpTraceMatrix, +DPMatrixDimension_::HORIZONTAL, length(seqH) + 1 - std::max(0, lowerDiagonal(band)));
@@ -1356,6 +1353,54 @@ _computeAlignment(TTraceTarget & traceSegments,
     return maxScore(dpScout);
 }
 
+template <typename TTraceTarget, typename TScoutState, typename TSequenceH, typename TSequenceV, typename TScoreScheme,
+          typename TBandSwitch, typename TAlignmentAlgorithm, typename TGapCosts, typename TTraceFlag>
+inline typename Value<TScoreScheme>::Type
+_computeAlignment(TTraceTarget & traceSegments,
+                  TScoutState & scoutState,
+                  TSequenceH const & seqH,
+                  TSequenceV const & seqV,
+                  TScoreScheme const & scoreScheme,
+                  DPBand_<TBandSwitch> const & band,
+                  DPProfile_<TAlignmentAlgorithm, TGapCosts, TTraceFlag> const & dpProfile)
+{
+    typedef typename Value<TScoreScheme>::Type TScoreValue;
+    typedef DPCell_<TScoreValue, TGapCosts> TDPScoreValue;
+    typedef typename DefaultScoreMatrixSpec_<TAlignmentAlgorithm>::Type TScoreMatrixSpec;
+    typedef typename DefaultTraceMatrixSpec_<TGapCosts>::Type TTraceMatrixSpec;
+    typedef typename TraceBitMap_::TTraceValue TTraceValue;
+
+    DPMatrix_<TDPScoreValue, TScoreMatrixSpec> dpScoreMatrix;
+    DPMatrix_<TTraceValue, TTraceMatrixSpec> dpTraceMatrix;
+    return _computeAlignmentImpl(dpScoreMatrix, dpTraceMatrix, traceSegments, scoutState, seqH, seqV, scoreScheme,
+                                 band, dpProfile);
+}
+
+// Interface with a DPContext whose buffers are reused for the matrices.
+template <typename TScoreValue, typename TTraceTarget, typename TScoutState, typename TSequenceH,
+          typename TSequenceV, typename TScoreScheme, typename TBandSwitch, typename TAlignmentAlgorithm,
+          typename TGapCosts, typename TTraceFlag>
+inline typename Value<TScoreScheme>::Type
+_computeAlignment(DPContext<TScoreValue> & dpContext,
+                  TTraceTarget & traceSegments,
+                  TScoutState & scoutState,
+                  TSequenceH const & seqH,
+                  TSequenceV const & seqV,
+                  TScoreScheme const & scoreScheme,
+                  DPBand_<TBandSwitch> const & band,
+                  DPProfile_<TAlignmentAlgorithm, TGapCosts, TTraceFlag> const & dpProfile)
+{
+    typedef DPCell_<TScoreValue, TGapCosts> TDPScoreValue;
+    typedef typename DefaultScoreMatrixSpec_<TAlignmentAlgorithm>::Type TScoreMatrixSpec;
+    typedef typename DefaultTraceMatrixSpec_<TGapCosts>::Type TTraceMatrixSpec;
+    typedef typename TraceBitMap_::TTraceValue TTraceValue;
+
+    DPMatrix_<TDPScoreValue, TScoreMatrixSpec> dpScoreMatrix(_dpScoreMatrixHost(dpContext, TGapCosts()));
+    DPMatrix_<TTraceValue, TTraceMatrixSpec> dpTraceMatrix(_dpTraceMatrixHost(dpContext));
+    return _computeAlignmentImpl(dpScoreMatrix, dpTraceMatrix, traceSegments, scoutState, seqH, seqV, scoreScheme,
+                                 band, dpProfile);
+}
+
 template <typename TTraceTarget, typename TSequenceH, typename TSequenceV, typename TScoreScheme, typename TBandSwitch,
           typename TAlignmentAlgorithm, typename TGapCosts, typename TTraceFlag>
 inline typename Value<TScoreScheme>::Type
@@ -0,0 +1,700 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Inter-sequence vectorization of the score-only dynamic programming.
+//
+// Many independent pairs are aligned at once: each lane of a vector register
+// holds the cell of one pair, so all lanes execute exactly the same
+// recurrence without any data dependency between them.  The pairs of a batch
+// are padded to the longest sequences; the padding cells are computed but
+// never read when extracting the scores.  The lane width is chosen per call
+// from a bound on the absolute scores, so short sequences run with 8 bit or
+// 16 bit lanes and long ones fall back to 32 bit lanes.
+// ==========================================================================
+
+#ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_DP_BATCH_SIMD_H_
+#define SEQAN_CORE_INCLUDE_SEQAN_ALIGN_DP_BATCH_SIMD_H_
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif  // #if defined(__SSE2__)
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif  // #if defined(__SSE4_1__)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif  // #if defined(__AVX2__)
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+template <typename TLane, typename TValue>
+struct DPBatchLaneHoldsAlphabet_;
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class DPSimdTraits_
+// ----------------------------------------------------------------------------
+
+// Vector operations on LANES scores of type TLane.  The generic version
+// computes a single lane with scalar instructions and is used whenever the
+// target does not provide vector instructions for the lane type.
+
+template <typename TLane>
+struct DPSimdTraits_
+{
+    typedef int TVector;
+    enum { LANES = 1 };
+
+    static inline TVector set1(int x) { return x; }
+    static inline TVector add(TVector a, TVector b) { return a + b; }
+    static inline TVector maxOf(TVector a, TVector b) { return (a < b) ? b : a; }
+    static inline TVector cmpEq(TVector a, TVector b) { return (a == b) ? -1 : 0; }
+    static inline TVector cmpGt(TVector a, TVector b) { return (a > b) ? -1 : 0; }
+    static inline TVector blend(TVector mask, TVector a, TVector b) { return (mask & a) | (~mask & b); }
+    static inline TVector bitAnd(TVector a, TVector b) { return a & b; }
+    static inline TVector load(TLane const * ptr) { return *ptr; }
+    static inline void store(TLane * ptr, TVector a) { *ptr = static_cast<TLane>(a); }
+};
+
+#if defined(__AVX2__)
+
+template <>
+struct DPSimdTraits_<__int8>
+{
+    typedef __m256i TVector;
+    enum { LANES = 32 };
+
+    static inline TVector set1(int x) { return _mm256_set1_epi8(static_cast<char>(x)); }
+    static inline TVector add(TVector a, TVector b) { return _mm256_adds_epi8(a, b); }
+    static inline TVector maxOf(TVector a, TVector b) { return _mm256_max_epi8(a, b); }
+    static inline TVector cmpEq(TVector a, TVector b) { return _mm256_cmpeq_epi8(a, b); }
+    static inline TVector cmpGt(TVector a, TVector b) { return _mm256_cmpgt_epi8(a, b); }
+    static inline TVector blend(TVector mask, TVector a, TVector b) { return _mm256_blendv_epi8(b, a, mask); }
+    static inline TVector bitAnd(TVector a, TVector b) { return _mm256_and_si256(a, b); }
+    static inline TVector load(__int8 const * ptr) { return _mm256_loadu_si256(reinterpret_cast<TVector const *>(ptr)); }
+    static inline void store(__int8 * ptr, TVector a) { _mm256_storeu_si256(reinterpret_cast<TVector *>(ptr), a); }
+};
+
+template <>
+struct DPSimdTraits_<__int16>
+{
+    typedef __m256i TVector;
+    enum { LANES = 16 };
+
+    static inline TVector set1(int x) { return _mm256_set1_epi16(static_cast<short>(x)); }
+    static inline TVector add(TVector a, TVector b) { return _mm256_adds_epi16(a, b); }
+    static inline TVector maxOf(TVector a, TVector b) { return _mm256_max_epi16(a, b); }
+    static inline TVector cmpEq(TVector a, TVector b) { return _mm256_cmpeq_epi16(a, b); }
+    static inline TVector cmpGt(TVector a, TVector b) { return _mm256_cmpgt_epi16(a, b); }
+    static inline TVector blend(TVector mask, TVector a, TVector b) { return _mm256_blendv_epi8(b, a, mask); }
+    static inline TVector bitAnd(TVector a, TVector b) { return _mm256_and_si256(a, b); }
+    static inline TVector load(__int16 const * ptr) { return _mm256_loadu_si256(reinterpret_cast<TVector const *>(ptr)); }
+    static inline void store(__int16 * ptr, TVector a) { _mm256_storeu_si256(reinterpret_cast<TVector *>(ptr), a); }
+};
+
+template <>
+struct DPSimdTraits_<__int32>
+{
+    typedef __m256i TVector;
+    enum { LANES = 8 };
+
+    static inline TVector set1(int x) { return _mm256_set1_epi32(x); }
+    static inline TVector add(TVector a, TVector b) { return _mm256_add_epi32(a, b); }
+    static inline TVector maxOf(TVector a, TVector b) { return _mm256_max_epi32(a, b); }
+    static inline TVector cmpEq(TVector a, TVector b) { return _mm256_cmpeq_epi32(a, b); }
+    static inline TVector cmpGt(TVector a, TVector b) { return _mm256_cmpgt_epi32(a, b); }
+    static inline TVector blend(TVector mask, TVector a, TVector b) { return _mm256_blendv_epi8(b, a, mask); }
+    static inline TVector bitAnd(TVector a, TVector b) { return _mm256_and_si256(a, b); }
+    static inline TVector load(__int32 const * ptr) { return _mm256_loadu_si256(reinterpret_cast<TVector const *>(ptr)); }
+    static inline void store(__int32 * ptr, TVector a) { _mm256_storeu_si256(reinterpret_cast<TVector *>(ptr), a); }
+};
+
+#elif defined(__SSE4_1__)
+
+template <>
+struct DPSimdTraits_<__int8>
+{
+    typedef __m128i TVector;
+    enum { LANES = 16 };
+
+    static inline TVector set1(int x) { return _mm_set1_epi8(static_cast<char>(x)); }
+    static inline TVector add(TVector a, TVector b) { return _mm_adds_epi8(a, b); }
+    static inline TVector maxOf(TVector a, TVector b) { return _mm_max_epi8(a, b); }
+    static inline TVector cmpEq(TVector a, TVector b) { return _mm_cmpeq_epi8(a, b); }
+    static inline TVector cmpGt(TVector a, TVector b) { return _mm_cmpgt_epi8(a, b); }
+    static inline TVector blend(TVector mask, TVector a, TVector b) { return _mm_blendv_epi8(b, a, mask); }
+    static inline TVector bitAnd(TVector a, TVector b) { return _mm_and_si128(a, b); }
+    static inline TVector load(__int8 const * ptr) { return _mm_loadu_si128(reinterpret_cast<TVector const *>(ptr)); }
+    static inline void store(__int8 * ptr, TVector a) { _mm_storeu_si128(reinterpret_cast<TVector *>(ptr), a); }
+};
+
+template <>
+struct DPSimdTraits_<__int16>
+{
+    typedef __m128i TVector;
+    enum { LANES = 8 };
+
+    static inline TVector set1(int x) { return _mm_set1_epi16(static_cast<short>(x)); }
+    static inline TVector add(TVector a, TVector b) { return _mm_adds_epi16(a, b); }
+    static inline TVector maxOf(TVector a, TVector b) { return _mm_max_epi16(a, b); }
+    static inline TVector cmpEq(TVector a, TVector b) { return _mm_cmpeq_epi16(a, b); }
+    static inline TVector cmpGt(TVector a, TVector b) { return _mm_cmpgt_epi16(a, b); }
+    static inline TVector blend(TVector mask, TVector a, TVector b) { return _mm_blendv_epi8(b, a, mask); }
+    static inline TVector bitAnd(TVector a, TVector b) { return _mm_and_si128(a, b); }
+    static inline TVector load(__int16 const * ptr) { return _mm_loadu_si128(reinterpret_cast<TVector const *>(ptr)); }
+    static inline void store(__int16 * ptr, TVector a) { _mm_storeu_si128(reinterpret_cast<TVector *>(ptr), a); }
+};
+
+template <>
+struct DPSimdTraits_<__int32>
+{
+    typedef __m128i TVector;
+    enum { LANES = 4 };
+
+    static inline TVector set1(int x) { return _mm_set1_epi32(x); }
+    static inline TVector add(TVector a, TVector b) { return _mm_add_epi32(a, b); }
+    static inline TVector maxOf(TVector a, TVector b) { return _mm_max_epi32(a, b); }
+    static inline TVector cmpEq(TVector a, TVector b) { return _mm_cmpeq_epi32(a, b); }
+    static inline TVector cmpGt(TVector a, TVector b) { return _mm_cmpgt_epi32(a, b); }
+    static inline TVector blend(TVector mask, TVector a, TVector b) { return _mm_blendv_epi8(b, a, mask); }
+    static inline TVector bitAnd(TVector a, TVector b) { return _mm_and_si128(a, b); }
+    static inline TVector load(__int32 const * ptr) { return _mm_loadu_si128(reinterpret_cast<TVector const *>(ptr)); }
+    static inline void store(__int32 * ptr, TVector a) { _mm_storeu_si128(reinterpret_cast<TVector *>(ptr), a); }
+};
+
+#elif defined(__SSE2__)
+
+// SSE2 only provides saturated additions and maxima for 16 bit lanes.
+
+template <>
+struct DPSimdTraits_<__int16>
+{
+    typedef __m128i TVector;
+    enum { LANES = 8 };
+
+    static inline TVector set1(int x) { return _mm_set1_epi16(static_cast<short>(x)); }
+    static inline TVector add(TVector a, TVector b) { return _mm_adds_epi16(a, b); }
+    static inline TVector maxOf(TVector a, TVector b) { return _mm_max_epi16(a, b); }
+    static inline TVector cmpEq(TVector a, TVector b) { return _mm_cmpeq_epi16(a, b); }
+    static inline TVector cmpGt(TVector a, TVector b) { return _mm_cmpgt_epi16(a, b); }
+    static inline TVector blend(TVector mask, TVector a, TVector b)
+    {
+        return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+    static inline TVector bitAnd(TVector a, TVector b) { return _mm_and_si128(a, b); }
+    static inline TVector load(__int16 const * ptr) { return _mm_loadu_si128(reinterpret_cast<TVector const *>(ptr)); }
+    static inline void store(__int16 * ptr, TVector a) { _mm_storeu_si128(reinterpret_cast<TVector *>(ptr), a); }
+};
+
+#endif  // #if defined(__AVX2__)
+
+// ----------------------------------------------------------------------------
+// Class DPBatchProfile_
+// ----------------------------------------------------------------------------
+
+// Provides the substitution scores of one row for all lanes.  The generic
+// version looks up the score of each lane separately and works with any
+// scoring scheme.
+
+template <typename TLane, typename TScore, typename TValueH, typename TValueV,
+          bool HOLDS_ALPHABET = DPBatchLaneHoldsAlphabet_<TLane, TValueH>::VALUE>
+struct DPBatchProfile_
+{
+    typedef DPSimdTraits_<TLane> TTraits;
+    typedef typename TTraits::TVector TVector;
+    enum { LANES = TTraits::LANES };
+
+    TScore const & scoringScheme;
+    String<TValueH> charsH;   // Transposed: position * LANES + lane.
+    String<TValueV> charsV;
+    TValueH const * column;
+    TLane buffer[LANES];
+
+    DPBatchProfile_(TScore const & _scoringScheme) : scoringScheme(_scoringScheme), column(0)
+    {}
+
+    inline void setColumn(size_t col)
+    {
+        column = begin(charsH, Standard()) + col * LANES;
+    }
+
+    inline TVector substitution(size_t row)
+    {
+        TValueV const * chars = begin(charsV, Standard()) + row * LANES;
+        for (unsigned lane = 0; lane < (unsigned)LANES; ++lane)
+            buffer[lane] = static_cast<TLane>(score(scoringScheme, column[lane], chars[lane]));
+        return TTraits::load(buffer);
+    }
+};
+
+// For simple scoring schemes the characters of all lanes are compared at once
+// and the match or mismatch score is selected by the resulting mask.  This
+// requires every ordinal value of the alphabet to fit into a lane, larger
+// alphabets use the generic version.
+
+template <typename TLane, typename TScoreValue, typename TValueH, typename TValueV>
+struct DPBatchProfile_<TLane, Score<TScoreValue, Simple>, TValueH, TValueV, true>
+{
+    typedef DPSimdTraits_<TLane> TTraits;
+    typedef typename TTraits::TVector TVector;
+    enum { LANES = TTraits::LANES };
+
+    String<TLane> charsH;
+    String<TLane> charsV;
+    TVector column;
+    TVector matchScore;
+    TVector mismatchScore;
+
+    DPBatchProfile_(Score<TScoreValue, Simple> const & scoringScheme) :
+        matchScore(TTraits::set1(static_cast<int>(scoreMatch(scoringScheme)))),
+        mismatchScore(TTraits::set1(static_cast<int>(scoreMismatch(scoringScheme))))
+    {}
+
+    inline void setColumn(size_t col)
+    {
+        column = TTraits::load(begin(charsH, Standard()) + col * LANES);
+    }
+
+    inline TVector substitution(size_t row)
+    {
+        TVector mask = TTraits::cmpEq(column, TTraits::load(begin(charsV, Standard()) + row * LANES));
+        return TTraits::blend(mask, matchScore, mismatchScore);
+    }
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Metafunction DPBatchLaneHoldsAlphabet_
+// ----------------------------------------------------------------------------
+
+// True if all ordinal values of TValue are distinct when stored in a lane of
+// type TLane.  A value size of 0 stands for 64 bit types.
+
+template <typename TLane, typename TValue>
+struct DPBatchLaneHoldsAlphabet_
+{
+    enum { VALUE = (__uint64)ValueSize<TValue>::VALUE != 0 &&
+                   (__uint64)ValueSize<TValue>::VALUE <= ((__uint64)1 << (8 * sizeof(TLane))) };
+};
+
+// ----------------------------------------------------------------------------
+// Metafunction BatchScalarAlgorithm_
+// ----------------------------------------------------------------------------
+
+// The scalar algorithm used for batches whose scores exceed the 32 bit lanes.
+
+template <typename TAlgoTag>
+struct BatchScalarAlgorithm_
+{
+    typedef Gotoh Type;
+};
+
+template <>
+struct BatchScalarAlgorithm_<Tag<LocalAlignment_<> > >
+{
+    typedef SmithWaterman Type;
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _transposeBatch()
+// ----------------------------------------------------------------------------
+
+// Interleaves the characters of the sequences [beginPos, beginPos + count) so
+// that position i of lane l is stored at i * LANES + l.  Lanes without a
+// sequence and positions behind the end of a sequence are padded.
+
+template <typename TTarget, typename TStrings, typename TPos, typename TPadding>
+inline void
+_transposeBatch(TTarget & target, TStrings const & strings, TPos beginPos, unsigned count, size_t maxLength,
+                TPadding const & padding, unsigned lanes)
+{
+    typedef typename Value<TTarget>::Type TTargetValue;
+    typedef typename Value<TStrings const>::Type TString;
+    typedef typename Iterator<TString const, Standard>::Type TIter;
+
+    resize(target, maxLength * lanes, padding, Exact());
+    for (unsigned lane = 0; lane < count; ++lane)
+    {
+        TIter it = begin(strings[beginPos + lane], Standard());
+        TIter itEnd = end(strings[beginPos + lane], Standard());
+        for (size_t pos = lane; it != itEnd; ++it, pos += lanes)
+            target[pos] = static_cast<TTargetValue>(*it);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _initBatchProfile()
+// ----------------------------------------------------------------------------
+
+template <typename TLane, typename TScore, typename TValueH, typename TValueV, bool HOLDS_ALPHABET,
+          typename TStringsH, typename TStringsV, typename TPos>
+inline void
+_initBatchProfile(DPBatchProfile_<TLane, TScore, TValueH, TValueV, HOLDS_ALPHABET> & profile,
+                  TStringsH const & stringsH, TStringsV const & stringsV, TPos beginPos, unsigned count,
+                  size_t maxLengthH, size_t maxLengthV)
+{
+    typedef DPBatchProfile_<TLane, TScore, TValueH, TValueV, HOLDS_ALPHABET> TProfile;
+
+    _transposeBatch(profile.charsH, stringsH, beginPos, count, maxLengthH, TValueH(), TProfile::LANES);
+    _transposeBatch(profile.charsV, stringsV, beginPos, count, maxLengthV, TValueV(), TProfile::LANES);
+}
+
+// Simple scoring schemes only need to compare characters, so the ordinal
+// values are stored in lanes of the score width.  The profile is only used if
+// the lanes hold all ordinal values, so the conversion never wraps.
+
+template <typename TLane, typename TScoreValue, typename TValueH, typename TValueV,
+          typename TStringsH, typename TStringsV, typename TPos>
+inline void
+_initBatchProfile(DPBatchProfile_<TLane, Score<TScoreValue, Simple>, TValueH, TValueV, true> & profile,
+                  TStringsH const & stringsH, TStringsV const & stringsV, TPos beginPos, unsigned count,
+                  size_t maxLengthH, size_t maxLengthV)
+{
+    typedef DPBatchProfile_<TLane, Score<TScoreValue, Simple>, TValueH, TValueV, true> TProfile;
+
+    resize(profile.charsH, maxLengthH * (unsigned)TProfile::LANES, TLane(-1), Exact());
+    resize(profile.charsV, maxLengthV * (unsigned)TProfile::LANES, TLane(-2), Exact());
+    for (unsigned lane = 0; lane < count; ++lane)
+    {
+        // Compare the ordinal values with the semantics of score(), i.e.
+        // after converting the vertical character into the horizontal
+        // alphabet.
+        for (size_t pos = 0; pos < length(stringsH[beginPos + lane]); ++pos)
+            profile.charsH[pos * TProfile::LANES + lane] =
+                static_cast<TLane>(ordValue(TValueH(stringsH[beginPos + lane][pos])));
+        for (size_t pos = 0; pos < length(stringsV[beginPos + lane]); ++pos)
+            profile.charsV[pos * TProfile::LANES + lane] =
+                static_cast<TLane>(ordValue(TValueH(stringsV[beginPos + lane][pos])));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _batchMaxAbsScore()
+// ----------------------------------------------------------------------------
+
+// Returns an upper bound on the absolute value a single step in the dynamic
+// programming matrix can change the score by.
+
+template <typename TScoreValue, typename TValueH, typename TValueV>
+inline int
+_batchMaxAbsScore(Score<TScoreValue, Simple> const & scoringScheme, TValueH const &, TValueV const &)
+{
+    int maxAbs = _abs(static_cast<int>(scoreMatch(scoringScheme)));
+    maxAbs = _max(maxAbs, _abs(static_cast<int>(scoreMismatch(scoringScheme))));
+    maxAbs = _max(maxAbs, _abs(static_cast<int>(scoreGapOpen(scoringScheme))));
+    return _max(maxAbs, _abs(static_cast<int>(scoreGapExtend(scoringScheme))));
+}
+
+template <typename TScoreValue, typename TScoreSpec, typename TValueH, typename TValueV>
+inline int
+_batchMaxAbsScore(Score<TScoreValue, TScoreSpec> const & scoringScheme, TValueH const &, TValueV const &)
+{
+    int maxAbs = _max(_abs(static_cast<int>(scoreGapOpen(scoringScheme))),
+                      _abs(static_cast<int>(scoreGapExtend(scoringScheme))));
+    for (unsigned i = 0; i < ValueSize<TValueH>::VALUE; ++i)
+        for (unsigned j = 0; j < ValueSize<TValueV>::VALUE; ++j)
+            maxAbs = _max(maxAbs, _abs(static_cast<int>(score(scoringScheme, TValueH(i), TValueV(j)))));
+    return maxAbs;
+}
+
+// ----------------------------------------------------------------------------
+// Function _computeBatchScoresSimd()
+// ----------------------------------------------------------------------------
+
+// Computes the scores of the pairs [beginPos, beginPos + count) with one lane
+// per pair.  The matrix is computed column by column, only the current column
+// of the H and E matrices is stored.
+
+template <typename TLane, typename TScores, typename TStringsH, typename TStringsV, typename TPos,
+          typename TScoreValue, typename TScoreSpec,
+          bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec, typename TAlgoTag>
+inline void
+_computeBatchScoresSimd(TScores & scores,
+                        TStringsH const & stringsH,
+                        TStringsV const & stringsV,
+                        TPos beginPos,
+                        unsigned count,
+                        Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                        AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const &,
+                        TAlgoTag const &)
+{
+    typedef DPSimdTraits_<TLane> TTraits;
+    typedef typename TTraits::TVector TVector;
+    typedef typename Value<typename Value<TStringsH const>::Type>::Type TValueH;
+    typedef typename Value<typename Value<TStringsV const>::Type>::Type TValueV;
+    typedef DPBatchProfile_<TLane, Score<TScoreValue, TScoreSpec>, TValueH, TValueV> TProfile;
+    enum { LANES = TTraits::LANES };
+
+    bool const isLocal = IsSameType<TAlgoTag, Tag<LocalAlignment_<> > >::VALUE;
+    int const negInf = MinValue<TLane>::VALUE / 2;
+    int const gapOpen = scoreGapOpen(scoringScheme);
+    int const gapExtend = scoreGapExtend(scoringScheme);
+
+    size_t lengthH[LANES];
+    size_t lengthV[LANES];
+    size_t maxLengthH = 0;
+    size_t maxLengthV = 0;
+    for (unsigned lane = 0; lane < (unsigned)LANES; ++lane)
+    {
+        lengthH[lane] = (lane < count) ? length(stringsH[beginPos + lane]) : 0;
+        lengthV[lane] = (lane < count) ? length(stringsV[beginPos + lane]) : 0;
+        maxLengthH = _max(maxLengthH, lengthH[lane]);
+        maxLengthV = _max(maxLengthV, lengthV[lane]);
+    }
+
+    TProfile profile(scoringScheme);
+    _initBatchProfile(profile, stringsH, stringsV, beginPos, count, maxLengthH, maxLengthV);
+
+    // Initialize the first column.
+    String<TLane> columnH;
+    String<TLane> columnE;
+    String<TLane> rowMask;
+    resize(columnH, (maxLengthV + 1) * LANES, Exact());
+    resize(columnE, (maxLengthV + 1) * LANES, static_cast<TLane>(negInf), Exact());
+    resize(rowMask, (maxLengthV + 1) * LANES, TLane(0), Exact());
+    for (size_t row = 0; row <= maxLengthV; ++row)
+    {
+        int value = (row == 0 || LEFT || isLocal) ? 0 : gapOpen + static_cast<int>(row - 1) * gapExtend;
+        for (unsigned lane = 0; lane < (unsigned)LANES; ++lane)
+        {
+            columnH[row * LANES + lane] = static_cast<TLane>(value);
+            if (row <= lengthV[lane])
+                rowMask[row * LANES + lane] = TLane(-1);
+        }
+    }
+
+    // The best value of the last row is tracked per column, the last column
+    // is handled once the column of the lane's horizontal length is reached.
+    int best[LANES];
+    for (unsigned lane = 0; lane < (unsigned)LANES; ++lane)
+        best[lane] = (isLocal) ? 0 : MinValue<int>::VALUE;
+
+    TVector const vecOpen = TTraits::set1(gapOpen);
+    TVector const vecExtend = TTraits::set1(gapExtend);
+    TVector const vecZero = TTraits::set1(0);
+    TVector const vecNegInf = TTraits::set1(negInf);
+    TVector vecBest = vecZero;
+    TLane laneBuffer[LANES];
+
+    for (size_t col = 0; ; ++col)
+    {
+        if (col > 0)
+        {
+            for (unsigned lane = 0; lane < (unsigned)LANES; ++lane)
+                laneBuffer[lane] = (col <= lengthH[lane]) ? TLane(-1) : TLane(0);
+            TVector colMask = TTraits::load(laneBuffer);
+
+            profile.setColumn(col - 1);
+            TLane * ptrH = begin(columnH, Standard());
+            TLane * ptrE = begin(columnE, Standard());
+            TVector diagonal = TTraits::load(ptrH);
+            TVector up = TTraits::set1((TOP || isLocal) ? 0 : gapOpen + static_cast<int>(col - 1) * gapExtend);
+            TVector vertical = vecNegInf;
+            TTraits::store(ptrH, up);
+
+            for (size_t row = 1; row <= maxLengthV; ++row)
+            {
+                ptrH += LANES;
+                ptrE += LANES;
+                TVector left = TTraits::load(ptrH);
+                TVector horizontal = TTraits::maxOf(TTraits::add(left, vecOpen),
+                                                    TTraits::add(TTraits::load(ptrE), vecExtend));
+                vertical = TTraits::maxOf(TTraits::add(up, vecOpen), TTraits::add(vertical, vecExtend));
+                TVector current = TTraits::maxOf(TTraits::add(diagonal, profile.substitution(row - 1)),
+                                                 TTraits::maxOf(horizontal, vertical));
+                if (isLocal)
+                {
+                    current = TTraits::maxOf(current, vecZero);
+                    vecBest = TTraits::maxOf(vecBest, TTraits::bitAnd(current,
+                                             TTraits::bitAnd(colMask, TTraits::load(begin(rowMask, Standard()) + row * LANES))));
+                }
+                TTraits::store(ptrH, current);
+                TTraits::store(ptrE, horizontal);
+                diagonal = left;
+                up = current;
+            }
+        }
+
+        if (!isLocal)
+        {
+            for (unsigned lane = 0; lane < count; ++lane)
+            {
+                if (col > lengthH[lane])
+                    continue;
+                if (BOTTOM || col == lengthH[lane])
+                    best[lane] = _max(best[lane], static_cast<int>(columnH[lengthV[lane] * LANES + lane]));
+                if (RIGHT && col == lengthH[lane])
+                    for (size_t row = 0; row < lengthV[lane]; ++row)
+                        best[lane] = _max(best[lane], static_cast<int>(columnH[row * LANES + lane]));
+            }
+        }
+
+        if (col == maxLengthH)
+            break;
+    }
+
+    if (isLocal)
+    {
+        TTraits::store(laneBuffer, vecBest);
+        for (unsigned lane = 0; lane < count; ++lane)
+            best[lane] = laneBuffer[lane];
+    }
+
+    for (unsigned lane = 0; lane < count; ++lane)
+        scores[beginPos + lane] = static_cast<typename Value<TScores>::Type>(best[lane]);
+}
+
+// ----------------------------------------------------------------------------
+// Function _computeBatchScoresParallel()
+// ----------------------------------------------------------------------------
+
+template <typename TLane, typename TScoreValue, typename TStringsH, typename TStringsV,
+          typename TScoreSpec, typename TAlignConfig, typename TAlgoTag>
+inline void
+_computeBatchScoresParallel(String<TScoreValue> & scores,
+                            TStringsH const & stringsH,
+                            TStringsV const & stringsV,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            TAlignConfig const & alignConfig,
+                            TAlgoTag const & algoTag)
+{
+    typedef typename Size<TStringsH>::Type TSize;
+    typedef typename MakeSigned<TSize>::Type TSignedSize;
+    enum { LANES = DPSimdTraits_<TLane>::LANES };
+
+    TSignedSize numBatches = (length(stringsH) + LANES - 1) / LANES;
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for (TSignedSize batch = 0; batch < numBatches; ++batch)
+    {
+        TSize beginPos = batch * LANES;
+        unsigned count = _min(static_cast<TSize>(LANES), length(stringsH) - beginPos);
+        _computeBatchScoresSimd<TLane>(scores, stringsH, stringsV, beginPos, count, scoringScheme, alignConfig,
+                                       algoTag);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _computeBatchScoresScalar()
+// ----------------------------------------------------------------------------
+
+// Computes each pair with the scalar dynamic programming of the pairwise
+// interface.
+
+template <typename TScoreValue, typename TStringsH, typename TStringsV,
+          typename TScoreSpec, typename TAlignConfig, typename TAlgoTag>
+inline void
+_computeBatchScoresScalar(String<TScoreValue> & scores,
+                          TStringsH const & stringsH,
+                          TStringsV const & stringsV,
+                          Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                          TAlignConfig const & alignConfig,
+                          TAlgoTag const &)
+{
+    typedef typename Size<TStringsH>::Type TSize;
+    typedef typename MakeSigned<TSize>::Type TSignedSize;
+    typedef typename BatchScalarAlgorithm_<TAlgoTag>::Type TScalarAlgoTag;
+
+    TSignedSize numPairs = length(stringsH);
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for (TSignedSize i = 0; i < numPairs; ++i)
+        scores[i] = _setUpAndRunAlignment(stringsH[i], stringsV[i], scoringScheme, alignConfig, TScalarAlgoTag());
+}
+
+// ----------------------------------------------------------------------------
+// Function _computeBatchScores()
+// ----------------------------------------------------------------------------
+
+// Selects the narrowest lane type that cannot overflow.  All values of the
+// matrix are bounded by the number of steps times the largest absolute score
+// and must stay above the negative infinity used for initialization.  Batches
+// exceeding the 32 bit lanes are computed with scalar instructions.
+
+template <typename TScoreValue, typename TStringsH, typename TStringsV,
+          typename TScoreSpec, typename TAlignConfig, typename TAlgoTag>
+inline void
+_computeBatchScores(String<TScoreValue> & scores,
+                    TStringsH const & stringsH,
+                    TStringsV const & stringsV,
+                    Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                    TAlignConfig const & alignConfig,
+                    TAlgoTag const & algoTag)
+{
+    typedef typename Value<typename Value<TStringsH const>::Type>::Type TValueH;
+    typedef typename Value<typename Value<TStringsV const>::Type>::Type TValueV;
+
+    SEQAN_ASSERT_EQ(length(stringsH), length(stringsV));
+
+    resize(scores, length(stringsH), Exact());
+    if (empty(stringsH))
+        return;
+
+    size_t maxLengthH = 0;
+    size_t maxLengthV = 0;
+    for (size_t i = 0; i < length(stringsH); ++i)
+    {
+        maxLengthH = _max(maxLengthH, static_cast<size_t>(length(stringsH[i])));
+        maxLengthV = _max(maxLengthV, static_cast<size_t>(length(stringsV[i])));
+    }
+
+    __int64 bound = static_cast<__int64>(maxLengthH + maxLengthV + 1) *
+                    _batchMaxAbsScore(scoringScheme, TValueH(), TValueV());
+
+    if (bound < MaxValue<__int8>::VALUE / 4 &&
+        (int)DPSimdTraits_<__int8>::LANES > (int)DPSimdTraits_<__int16>::LANES)
+        _computeBatchScoresParallel<__int8>(scores, stringsH, stringsV, scoringScheme, alignConfig, algoTag);
+    else if (bound < MaxValue<__int16>::VALUE / 4 &&
+             (int)DPSimdTraits_<__int16>::LANES > (int)DPSimdTraits_<__int32>::LANES)
+        _computeBatchScoresParallel<__int16>(scores, stringsH, stringsV, scoringScheme, alignConfig, algoTag);
+    else if (bound < static_cast<__int64>(MaxValue<__int32>::VALUE / 4))
+        _computeBatchScoresParallel<__int32>(scores, stringsH, stringsV, scoringScheme, alignConfig, algoTag);
+    else
+        _computeBatchScoresScalar(scores, stringsH, stringsV, scoringScheme, alignConfig, algoTag);
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_DP_BATCH_SIMD_H_
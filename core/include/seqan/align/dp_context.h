@@ -0,0 +1,183 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// The DPContext keeps the buffers of the dynamic programming matrices and the
+// trace segments between alignment calls.
+// ==========================================================================
+
+#ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_DP_CONTEXT_H_
+#define SEQAN_CORE_INCLUDE_SEQAN_ALIGN_DP_CONTEXT_H_
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class DPContext
+// ----------------------------------------------------------------------------
+
+/**
+.Class.DPContext
+..cat:Alignments
+..summary:Reusable workspace for the dynamic programming alignment functions.
+..signature:DPContext<TScoreValue>
+..param.TScoreValue:The score value type of the scoring scheme.
+..remarks:
+The context stores the score matrix, the trace matrix and the trace segments of an alignment.
+If it is passed to @Function.globalAlignment@, @Function.globalAlignmentScore@ or @Function.localAlignment@, the buffers of the previous call are reused.
+They only grow, so aligning many sequences of similar length does not allocate any memory for the dynamic programming after the first call.
+..remarks:
+A context must not be used by two threads at the same time; keep one context per thread instead.
+..example.code:
+DPContext<int> dpContext;
+Score<int, Simple> scoringScheme(2, -1, -2);
+for (unsigned i = 0; i < length(reads); ++i)
+{
+    Align<Dna5String> align;
+    resize(rows(align), 2);
+    assignSource(row(align, 0), reads[i]);
+    assignSource(row(align, 1), reference);
+    globalAlignment(align, scoringScheme, dpContext);
+}
+..include:seqan/align.h
+*/
+
+template <typename TScoreValue>
+class DPContext
+{
+public:
+    typedef typename TraceBitMap_::TTraceValue TTraceValue;
+    typedef TraceSegment_<size_t, size_t> TTraceSegment;
+
+    Matrix<DPCell_<TScoreValue, LinearGaps>, 2> _scoreMatrixLinear;
+    Matrix<DPCell_<TScoreValue, AffineGaps>, 2> _scoreMatrixAffine;
+    Matrix<TTraceValue, 2> _traceMatrix;
+    String<TTraceSegment> _traceSegments;
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _dpScoreMatrixHost()
+// ----------------------------------------------------------------------------
+
+// Returns the emptied buffer of the score matrix for the given gap cost model.
+// The buffer keeps its capacity but the cells are constructed anew when the
+// matrix is resized, since the initialization relies on default cells.
+
+template <typename TScoreValue>
+inline Matrix<DPCell_<TScoreValue, LinearGaps>, 2> &
+_dpScoreMatrixHost(DPContext<TScoreValue> & dpContext, LinearGaps const &)
+{
+    clear(host(dpContext._scoreMatrixLinear));
+    return dpContext._scoreMatrixLinear;
+}
+
+template <typename TScoreValue>
+inline Matrix<DPCell_<TScoreValue, AffineGaps>, 2> &
+_dpScoreMatrixHost(DPContext<TScoreValue> & dpContext, AffineGaps const &)
+{
+    clear(host(dpContext._scoreMatrixAffine));
+    return dpContext._scoreMatrixAffine;
+}
+
+// ----------------------------------------------------------------------------
+// Function _dpTraceMatrixHost()
+// ----------------------------------------------------------------------------
+
+// Returns the emptied buffer of the trace matrix, keeping its capacity.
+
+template <typename TScoreValue>
+inline Matrix<typename TraceBitMap_::TTraceValue, 2> &
+_dpTraceMatrixHost(DPContext<TScoreValue> & dpContext)
+{
+    clear(host(dpContext._traceMatrix));
+    return dpContext._traceMatrix;
+}
+
+// ----------------------------------------------------------------------------
+// Function _dpTraceSegments()
+// ----------------------------------------------------------------------------
+
+// Returns the emptied trace segments, keeping their capacity.
+
+template <typename TScoreValue>
+inline String<typename DPContext<TScoreValue>::TTraceSegment> &
+_dpTraceSegments(DPContext<TScoreValue> & dpContext)
+{
+    clear(dpContext._traceSegments);
+    return dpContext._traceSegments;
+}
+
+// ----------------------------------------------------------------------------
+// Function clear()
+// ----------------------------------------------------------------------------
+
+/**
+.Function.DPContext#clear
+..class:Class.DPContext
+..cat:Alignments
+..summary:Releases the memory held by the context.
+..signature:clear(dpContext)
+..param.dpContext:
+...type:Class.DPContext
+..include:seqan/align.h
+*/
+
+template <typename TScoreValue>
+inline void
+clear(DPContext<TScoreValue> & dpContext)
+{
+    clear(host(dpContext._scoreMatrixLinear));
+    shrinkToFit(host(dpContext._scoreMatrixLinear));
+    clear(host(dpContext._scoreMatrixAffine));
+    shrinkToFit(host(dpContext._scoreMatrixAffine));
+    clear(host(dpContext._traceMatrix));
+    shrinkToFit(host(dpContext._traceMatrix));
+    clear(dpContext._traceSegments);
+    shrinkToFit(dpContext._traceSegments);
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_DP_CONTEXT_H_
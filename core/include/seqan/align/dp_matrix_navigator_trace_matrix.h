@@ -54,22 +54,23 @@ namespace seqan {
 // ============================================================================
 
 // ----------------------------------------------------------------------------
-// Class DPMatrixNavigator                        [FullDPMatrix, DPTraceMatrix]
+// Class DPMatrixNavigator                                      [DPTraceMatrix]
 // ----------------------------------------------------------------------------
 
 // The matrix navigator for the trace-back matrix.
 //
 // It takes three types to be specialized. The first type defines the underlying
-// dp-matrix it is working on. This has to be a FullDPMatrix. The second type,
-// specifies that this is a trace-matrix navigator while the TTraceFlag can either
-// be TracebackOn to enable the navigator or TracebackOff to disable it.
+// dp-matrix it is working on. This has to be a FullDPMatrix or a PackedDPMatrix.
+// The second type, specifies that this is a trace-matrix navigator while the
+// TTraceFlag can either be TracebackOn to enable the navigator or TracebackOff
+// to disable it.
 // The last parameter specifies the kind of navigation.
-template <typename TValue, typename TTraceFlag>
-class DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise>
+template <typename TValue, typename TMatrixSpec, typename TTraceFlag>
+class DPMatrixNavigator_<DPMatrix_<TValue, TMatrixSpec>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise>
 {
 public:
 
-    typedef  DPMatrix_<TValue, FullDPMatrix> TDPMatrix_;
+    typedef  DPMatrix_<TValue, TMatrixSpec> TDPMatrix_;
     typedef typename Pointer_<TDPMatrix_>::Type TDPMatrixPointer_;
     typedef typename Iterator<TDPMatrix_, Standard>::Type TDPMatrixIterator;
 
@@ -98,10 +99,10 @@ public:
 // ----------------------------------------------------------------------------
 
 // Initializes the navigator for unbanded alignments.
-template <typename TValue, typename TTraceFlag>
+template <typename TValue, typename TMatrixSpec, typename TTraceFlag>
 inline void
-_init(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & navigator,
-      DPMatrix_<TValue, FullDPMatrix> & dpMatrix,
+_init(DPMatrixNavigator_<DPMatrix_<TValue, TMatrixSpec>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & navigator,
+      DPMatrix_<TValue, TMatrixSpec> & dpMatrix,
       DPBand_<BandOff> const &)
 {
     if (IsSameType<TTraceFlag, TracebackOff>::VALUE)
@@ -114,13 +115,13 @@ _init(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFl
 
 // Initializes the navigator for banded alignments.
 // Note, the band size has a maximal width of length of the vertical sequence.
-template <typename TValue, typename TTraceFlag>
+template <typename TValue, typename TMatrixSpec, typename TTraceFlag>
 inline void
-_init(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & navigator,
-      DPMatrix_<TValue, FullDPMatrix> & dpMatrix,
+_init(DPMatrixNavigator_<DPMatrix_<TValue, TMatrixSpec>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & navigator,
+      DPMatrix_<TValue, TMatrixSpec> & dpMatrix,
       DPBand_<BandOn> const & band)
 {
-    typedef typename Size<DPMatrix_<TValue, FullDPMatrix> >::Type TMatrixSize;
+    typedef typename Size<DPMatrix_<TValue, TMatrixSpec> >::Type TMatrixSize;
     typedef typename MakeSigned<TMatrixSize>::Type TSignedSize;
 
     if (IsSameType<TTraceFlag, TracebackOff>::VALUE)
@@ -156,18 +157,18 @@ _init(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFl
 // ----------------------------------------------------------------------------
 
 // In the initial column we don't need to do anything because, the navigagtor is already initialized.
-template <typename TValue, typename TTraceFlag>
+template <typename TValue, typename TMatrixSpec, typename TTraceFlag>
 inline void
-_goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & /*dpNavigator*/,
+_goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, TMatrixSpec>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & /*dpNavigator*/,
             MetaColumnDescriptor<DPInitialColumn, PartialColumnTop> const &,
             FirstCell const &)
 {
     // no-op
 }
 
-template <typename TValue, typename TTraceFlag, typename TColumnLocation>
+template <typename TValue, typename TMatrixSpec, typename TTraceFlag, typename TColumnLocation>
 inline void
-_goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & /*dpNavigator*/,
+_goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, TMatrixSpec>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & /*dpNavigator*/,
             MetaColumnDescriptor<DPInitialColumn, TColumnLocation> const &,
             FirstCell const &)
 {
@@ -182,9 +183,9 @@ _goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TT
 // The left cell of the active cell is not valid, beacause we only can come from horizontal direction.
 // The lower left cell of the active cell is the horizontal direction.
 
-template <typename TValue, typename TTraceFlag, typename TColumnType>
+template <typename TValue, typename TMatrixSpec, typename TTraceFlag, typename TColumnType>
 inline void
-_goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
+_goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, TMatrixSpec>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
             MetaColumnDescriptor<TColumnType, PartialColumnTop> const &,
             FirstCell const &)
 {
@@ -202,9 +203,9 @@ _goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TT
 // We are in the banded case.
 // The left cell of the active cell represents diagonal direction. The lower left diagonal represents the horizontal direction.
 
-template <typename TValue, typename TTraceFlag, typename TColumnType, typename TColumnLocation>
+template <typename TValue, typename TMatrixSpec, typename TTraceFlag, typename TColumnType, typename TColumnLocation>
 inline void
-_goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
+_goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, TMatrixSpec>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
             MetaColumnDescriptor<TColumnType, TColumnLocation> const &,
             FirstCell const &)
 {
@@ -219,9 +220,9 @@ _goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TT
 // ----------------------------------------------------------------------------
 
 // For any other column type and location we can use the same navigation procedure.
-template <typename TValue, typename TTraceFlag, typename TColumnType, typename TColumnLocation>
+template <typename TValue, typename TMatrixSpec, typename TTraceFlag, typename TColumnType, typename TColumnLocation>
 inline void
-_goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
+_goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, TMatrixSpec>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
             MetaColumnDescriptor<TColumnType, TColumnLocation> const &,
             InnerCell const &)
 {
@@ -235,9 +236,9 @@ _goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TT
 // Function _goNextCell                         [PartialColumnBottom, LastCell]
 // ----------------------------------------------------------------------------
 
-template <typename TValue, typename TTraceFlag>
+template <typename TValue, typename TMatrixSpec, typename TTraceFlag>
 inline void
-_goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
+_goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, TMatrixSpec>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
             MetaColumnDescriptor<DPInitialColumn, PartialColumnBottom> const &,
             LastCell const &)
 {
@@ -249,9 +250,9 @@ _goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TT
 
 // If we are in banded case and the band crosses the last row, we have to update
 // the additional leap for the current track.
-template <typename TValue, typename TTraceFlag, typename TColumnType>
+template <typename TValue, typename TMatrixSpec, typename TTraceFlag, typename TColumnType>
 inline void
-_goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
+_goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, TMatrixSpec>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
             MetaColumnDescriptor<TColumnType, PartialColumnBottom> const &,
             LastCell const &)
 {
@@ -267,9 +268,9 @@ _goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TT
 // ----------------------------------------------------------------------------
 
 // If we are in the banded case the left cell of the active represents the diagonal direction.
-template <typename TValue, typename TTraceFlag, typename TColumnType, typename TColumnLocation>
+template <typename TValue, typename TMatrixSpec, typename TTraceFlag, typename TColumnType, typename TColumnLocation>
 inline void
-_goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
+_goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, TMatrixSpec>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
             MetaColumnDescriptor<TColumnType, TColumnLocation> const &,
             LastCell const &)
 {
@@ -283,9 +284,9 @@ _goNextCell(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TT
 // Function _traceHorizontal()
 // ----------------------------------------------------------------------------
 
-template <typename TValue, typename TTraceFlag>
+template <typename TValue, typename TMatrixSpec, typename TTraceFlag>
 inline void
-_traceHorizontal(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
+_traceHorizontal(DPMatrixNavigator_<DPMatrix_<TValue, TMatrixSpec>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
                  bool isBandShift)
 {
     if (IsSameType<TTraceFlag, TracebackOff>::VALUE)
@@ -302,9 +303,9 @@ _traceHorizontal(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatr
 // Function _traceDiagonal()
 // ----------------------------------------------------------------------------
 
-template <typename TValue, typename TTraceFlag>
+template <typename TValue, typename TMatrixSpec, typename TTraceFlag>
 inline void
-_traceDiagonal(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
+_traceDiagonal(DPMatrixNavigator_<DPMatrix_<TValue, TMatrixSpec>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
                bool isBandShift)
 {
     if (IsSameType<TTraceFlag, TracebackOff>::VALUE)
@@ -321,9 +322,9 @@ _traceDiagonal(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix
 // Function _traceVertical()
 // ----------------------------------------------------------------------------
 
-template <typename TValue, typename TTraceFlag>
+template <typename TValue, typename TMatrixSpec, typename TTraceFlag>
 inline void
-_traceVertical(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
+_traceVertical(DPMatrixNavigator_<DPMatrix_<TValue, TMatrixSpec>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
                bool /*isBandShift*/)
 {
     if (IsSameType<TTraceFlag, TracebackOff>::VALUE)
@@ -336,9 +337,9 @@ _traceVertical(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix
 // Function setToPosition()
 // ----------------------------------------------------------------------------
 
-template <typename TValue, typename TTraceFlag, typename TPosition>
+template <typename TValue, typename TMatrixSpec, typename TTraceFlag, typename TPosition>
 inline void
-_setToPosition(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
+_setToPosition(DPMatrixNavigator_<DPMatrix_<TValue, TMatrixSpec>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
               TPosition const & hostPosition)
 {
     if (IsSameType<TTraceFlag, TracebackOff>::VALUE)
@@ -351,9 +352,9 @@ _setToPosition(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix
 // Sets the host position based on the given horizontal and vertical position. Note that the horizontal and
 // vertical positions must correspond to the correct size of the underlying matrix.
 // For banded matrices the vertical dimension might not equal the length of the vertical sequence.
-template <typename TValue, typename TTraceFlag, typename TPositionH, typename TPositionV>
+template <typename TValue, typename TMatrixSpec, typename TTraceFlag, typename TPositionH, typename TPositionV>
 inline void
-_setToPosition(DPMatrixNavigator_<DPMatrix_<TValue, FullDPMatrix>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
+_setToPosition(DPMatrixNavigator_<DPMatrix_<TValue, TMatrixSpec>, DPTraceMatrix<TTraceFlag>, NavigateColumnWise> & dpNavigator,
               TPositionH const & horizontalPosition,
               TPositionV const & verticalPosition)
 {
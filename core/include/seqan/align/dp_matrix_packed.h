@@ -0,0 +1,491 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Implements a bit-packed trace matrix storing two trace values per byte.
+// ==========================================================================
+
+#ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_DP_MATRIX_PACKED_H_
+#define SEQAN_CORE_INCLUDE_SEQAN_ALIGN_DP_MATRIX_PACKED_H_
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Tag PackedDPMatrix
+// ----------------------------------------------------------------------------
+
+struct PackedDPMatrix_;
+typedef Tag<PackedDPMatrix_> PackedDPMatrix;
+
+// ----------------------------------------------------------------------------
+// Class DPMatrix                                              [PackedDPMatrix]
+// ----------------------------------------------------------------------------
+
+// Stores every cell of the dp matrix like the FullDPMatrix but with 4 bits per
+// cell instead of 8 bits. Can only be used for trace values whose flags fit into
+// the lower 4 bits, i.e. for linear gap costs. The cells are packed in the same
+// column-major order as in the FullDPMatrix, such that all positions and the
+// dimension factors of the hosted matrix are the same. Only the underlying
+// string of the hosted matrix is shrunk to half of its size.
+template <typename TValue>
+class DPMatrix_<TValue, PackedDPMatrix>
+{
+public:
+
+    typedef Matrix<TValue, 2> THost;
+
+    Holder<THost>   _dataHost;  // The host containing the packed matrix.
+
+    DPMatrix_() :
+        _dataHost()
+    {
+        create(_dataHost);
+    }
+
+    // Works on the given host, e.g. the buffer of a DPContext.
+    explicit DPMatrix_(THost & host) :
+        _dataHost(host)
+    {}
+
+    DPMatrix_(DPMatrix_ const & other) :
+        _dataHost(other._dataHost) {}
+
+    ~DPMatrix_() {}
+
+    DPMatrix_ & operator=(DPMatrix_ const & other)
+    {
+        if (this != &other)
+        {
+            _dataHost = other._dataHost;
+        }
+        return *this;
+    }
+
+};
+
+// ----------------------------------------------------------------------------
+// Class DPPackedMatrixIterator_
+// ----------------------------------------------------------------------------
+
+// Standard iterator of the PackedDPMatrix. It addresses a cell by its position
+// within the matrix and reads and writes the corresponding half byte.
+template <typename TByte>
+class DPPackedMatrixIterator_
+{
+public:
+
+    TByte * _data;
+    size_t _pos;
+
+    DPPackedMatrixIterator_() : _data(0), _pos(0)
+    {}
+
+    DPPackedMatrixIterator_(TByte * data, size_t pos) : _data(data), _pos(pos)
+    {}
+
+    template <typename TOtherByte>
+    DPPackedMatrixIterator_(DPPackedMatrixIterator_<TOtherByte> const & other) :
+        _data(other._data), _pos(other._pos)
+    {}
+
+    DPPackedMatrixIterator_ & operator+=(ptrdiff_t steps)  // nolint
+    {
+        _pos += steps;
+        return *this;
+    }
+
+    DPPackedMatrixIterator_ & operator-=(ptrdiff_t steps)  // nolint
+    {
+        _pos -= steps;
+        return *this;
+    }
+
+    DPPackedMatrixIterator_ & operator++()
+    {
+        ++_pos;
+        return *this;
+    }
+
+    DPPackedMatrixIterator_ & operator--()
+    {
+        --_pos;
+        return *this;
+    }
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Metafunction DefaultTraceMatrixSpec_
+// ----------------------------------------------------------------------------
+
+// Determines the specialization of the trace matrix based on the gap costs.
+// By default all trace matrices are FullDPMatrix. If SEQAN_DP_PACKED_TRACE_MATRIX
+// is defined, the trace values of linear gap costs are stored in the
+// PackedDPMatrix, since they only use the DIAGONAL, HORIZONTAL and VERTICAL
+// flags. This halves the memory of the trace matrix at the cost of the bit
+// operations per cell. The affine gap costs use all seven flags of the
+// TraceBitMap_ and always use the FullDPMatrix.
+template <typename TGapCosts>
+struct DefaultTraceMatrixSpec_
+{
+    typedef FullDPMatrix Type;
+};
+
+#ifdef SEQAN_DP_PACKED_TRACE_MATRIX
+template <>
+struct DefaultTraceMatrixSpec_<LinearGaps>
+{
+    typedef PackedDPMatrix Type;
+};
+#endif  // #ifdef SEQAN_DP_PACKED_TRACE_MATRIX
+
+// ----------------------------------------------------------------------------
+// Metafunction Reference
+// ----------------------------------------------------------------------------
+
+// The packed cells can not be referenced, hence they are returned by value.
+template <typename TValue>
+struct Reference<DPMatrix_<TValue, PackedDPMatrix> >
+{
+    typedef TValue Type;
+};
+
+template <typename TValue>
+struct Reference<DPMatrix_<TValue, PackedDPMatrix> const>
+{
+    typedef TValue Type;
+};
+
+// ----------------------------------------------------------------------------
+// Metafunction Iterator
+// ----------------------------------------------------------------------------
+
+template <typename TValue>
+struct Iterator<DPMatrix_<TValue, PackedDPMatrix>, Standard>
+{
+    typedef DPPackedMatrixIterator_<TValue> Type;
+};
+
+template <typename TValue>
+struct Iterator<DPMatrix_<TValue, PackedDPMatrix> const, Standard>
+{
+    typedef DPPackedMatrixIterator_<TValue const> Type;
+};
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _packedLength()
+// ----------------------------------------------------------------------------
+
+// Returns the number of bytes needed to store the given number of cells.
+template <typename TSize>
+inline TSize
+_packedLength(TSize cells)
+{
+    return (cells + 1) >> 1;
+}
+
+// ----------------------------------------------------------------------------
+// Function _packedShift()
+// ----------------------------------------------------------------------------
+
+// Returns the offset of the half byte storing the cell at the given position.
+inline unsigned
+_packedShift(size_t pos)
+{
+    return static_cast<unsigned>(pos & 1u) << 2;
+}
+
+// ----------------------------------------------------------------------------
+// Function resize()
+// ----------------------------------------------------------------------------
+
+// The dimension factors are set as in the FullDPMatrix while the host string
+// only stores half of the cells.
+template <typename TValue>
+inline void
+resize(DPMatrix_<TValue, PackedDPMatrix> & dpMatrix)
+{
+    typedef DPMatrix_<TValue, PackedDPMatrix> TDPMatrix;
+    typedef typename Size<TDPMatrix>::Type TSize;
+
+    TSize dimV = length(dpMatrix, DPMatrixDimension_::VERTICAL);
+    TSize dimH = length(dpMatrix, DPMatrixDimension_::HORIZONTAL);
+
+    _dataFactors(dpMatrix)[DPMatrixDimension_::HORIZONTAL] = dimV;
+
+    if (dimV * dimH > 0)
+        resize(host(dpMatrix), _packedLength(dimV * dimH), Exact());
+}
+
+template <typename TValue>
+inline void
+resize(DPMatrix_<TValue, PackedDPMatrix> & dpMatrix,
+       TValue const & fillValue)
+{
+    typedef DPMatrix_<TValue, PackedDPMatrix> TDPMatrix;
+    typedef typename Size<TDPMatrix>::Type TSize;
+
+    TSize dimV = length(dpMatrix, DPMatrixDimension_::VERTICAL);
+    TSize dimH = length(dpMatrix, DPMatrixDimension_::HORIZONTAL);
+
+    _dataFactors(dpMatrix)[DPMatrixDimension_::HORIZONTAL] = dimV;
+
+    if (dimV * dimH > 0)
+        resize(host(dpMatrix), _packedLength(dimV * dimH),
+               static_cast<TValue>((fillValue & 0xF) | ((fillValue & 0xF) << 4)), Exact());
+}
+
+// ----------------------------------------------------------------------------
+// Function length()
+// ----------------------------------------------------------------------------
+
+// Returns the number of cells and not the number of bytes of the host.
+template <typename TValue>
+inline typename Size<DPMatrix_<TValue, PackedDPMatrix> const>::Type
+length(DPMatrix_<TValue, PackedDPMatrix> const & dpMatrix)
+{
+    return length(dpMatrix, DPMatrixDimension_::VERTICAL) * length(dpMatrix, DPMatrixDimension_::HORIZONTAL);
+}
+
+// ----------------------------------------------------------------------------
+// Function begin()
+// ----------------------------------------------------------------------------
+
+template <typename TValue>
+inline typename Iterator<DPMatrix_<TValue, PackedDPMatrix>, Standard const>::Type
+begin(DPMatrix_<TValue, PackedDPMatrix> & dpMatrix, Standard const)
+{
+    typedef typename Iterator<DPMatrix_<TValue, PackedDPMatrix>, Standard const>::Type TIterator;
+    return TIterator(begin(host(dpMatrix), Standard()), 0);
+}
+
+template <typename TValue>
+inline typename Iterator<DPMatrix_<TValue, PackedDPMatrix> const, Standard const>::Type
+begin(DPMatrix_<TValue, PackedDPMatrix> const & dpMatrix, Standard const)
+{
+    typedef typename Iterator<DPMatrix_<TValue, PackedDPMatrix> const, Standard const>::Type TIterator;
+    return TIterator(begin(host(dpMatrix), Standard()), 0);
+}
+
+// ----------------------------------------------------------------------------
+// Function end()
+// ----------------------------------------------------------------------------
+
+template <typename TValue>
+inline typename Iterator<DPMatrix_<TValue, PackedDPMatrix>, Standard const>::Type
+end(DPMatrix_<TValue, PackedDPMatrix> & dpMatrix, Standard const)
+{
+    return begin(dpMatrix, Standard()) + length(dpMatrix);
+}
+
+template <typename TValue>
+inline typename Iterator<DPMatrix_<TValue, PackedDPMatrix> const, Standard const>::Type
+end(DPMatrix_<TValue, PackedDPMatrix> const & dpMatrix, Standard const)
+{
+    return begin(dpMatrix, Standard()) + length(dpMatrix);
+}
+
+// ----------------------------------------------------------------------------
+// Function value()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TPosition>
+inline TValue
+value(DPMatrix_<TValue, PackedDPMatrix> const & dpMatrix,
+      TPosition const & pos)
+{
+    return value(begin(dpMatrix, Standard()) + pos);
+}
+
+template <typename TValue, typename TPosition>
+inline TValue
+value(DPMatrix_<TValue, PackedDPMatrix> & dpMatrix,
+      TPosition const & pos)
+{
+    return value(static_cast<DPMatrix_<TValue, PackedDPMatrix> const &>(dpMatrix), pos);
+}
+
+template <typename TValue, typename TPositionV, typename TPositionH>
+inline TValue
+value(DPMatrix_<TValue, PackedDPMatrix> const & dpMatrix,
+      TPositionV const & posDimV,
+      TPositionH const & posDimH)
+{
+    return value(dpMatrix, posDimV + posDimH * _dataFactors(dpMatrix)[DPMatrixDimension_::HORIZONTAL]);
+}
+
+template <typename TValue, typename TPositionV, typename TPositionH>
+inline TValue
+value(DPMatrix_<TValue, PackedDPMatrix> & dpMatrix,
+      TPositionV const & posDimV,
+      TPositionH const & posDimH)
+{
+    return value(static_cast<DPMatrix_<TValue, PackedDPMatrix> const &>(dpMatrix), posDimV, posDimH);
+}
+
+// ----------------------------------------------------------------------------
+// Function assignValue()
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TPosition>
+inline void
+assignValue(DPMatrix_<TValue, PackedDPMatrix> & dpMatrix,
+            TPosition const & pos,
+            TValue const & val)
+{
+    typename Iterator<DPMatrix_<TValue, PackedDPMatrix>, Standard>::Type it = begin(dpMatrix, Standard()) + pos;
+    assignValue(it, val);
+}
+
+// ----------------------------------------------------------------------------
+// Function coordinate()
+// ----------------------------------------------------------------------------
+
+// Positions refer to the cells, hence the coordinates are the same as in the
+// FullDPMatrix.
+template <typename TValue, typename TPosition>
+inline typename Position<DPMatrix_<TValue, PackedDPMatrix> >::Type
+coordinate(DPMatrix_<TValue, PackedDPMatrix> const & dpMatrix,
+           TPosition hostPos,
+           typename DPMatrixDimension_::TValue dimension)
+{
+    return coordinate(_dataHost(dpMatrix), hostPos, dimension);
+}
+
+// ----------------------------------------------------------------------------
+// Function value()                                  [DPPackedMatrixIterator_]
+// ----------------------------------------------------------------------------
+
+template <typename TByte>
+inline typename RemoveConst<TByte>::Type
+value(DPPackedMatrixIterator_<TByte> const & it)
+{
+    return (it._data[it._pos >> 1] >> _packedShift(it._pos)) & 0xF;
+}
+
+template <typename TByte>
+inline typename RemoveConst<TByte>::Type
+value(DPPackedMatrixIterator_<TByte> & it)
+{
+    return value(static_cast<DPPackedMatrixIterator_<TByte> const &>(it));
+}
+
+// ----------------------------------------------------------------------------
+// Function assignValue()                            [DPPackedMatrixIterator_]
+// ----------------------------------------------------------------------------
+
+// Only the lower 4 bits of the given value are stored.
+template <typename TByte, typename TValue>
+inline void
+assignValue(DPPackedMatrixIterator_<TByte> const & it,
+            TValue const & val)
+{
+    TByte & packed = it._data[it._pos >> 1];
+    unsigned shift = _packedShift(it._pos);
+    packed = (packed & ~(0xF << shift)) | ((val & 0xF) << shift);
+}
+
+template <typename TByte, typename TValue>
+inline void
+assignValue(DPPackedMatrixIterator_<TByte> & it,
+            TValue const & val)
+{
+    assignValue(static_cast<DPPackedMatrixIterator_<TByte> const &>(it), val);
+}
+
+// ----------------------------------------------------------------------------
+// Function position()                               [DPPackedMatrixIterator_]
+// ----------------------------------------------------------------------------
+
+template <typename TByte, typename TContainer>
+inline size_t
+position(DPPackedMatrixIterator_<TByte> const & it,
+         TContainer const & /*dpMatrix*/)
+{
+    return it._pos;
+}
+
+// ----------------------------------------------------------------------------
+// Operators                                         [DPPackedMatrixIterator_]
+// ----------------------------------------------------------------------------
+
+template <typename TByte>
+inline DPPackedMatrixIterator_<TByte>
+operator+(DPPackedMatrixIterator_<TByte> const & it, ptrdiff_t steps)
+{
+    return DPPackedMatrixIterator_<TByte>(it._data, it._pos + steps);
+}
+
+template <typename TByte>
+inline DPPackedMatrixIterator_<TByte>
+operator-(DPPackedMatrixIterator_<TByte> const & it, ptrdiff_t steps)
+{
+    return DPPackedMatrixIterator_<TByte>(it._data, it._pos - steps);
+}
+
+template <typename TByte>
+inline ptrdiff_t
+operator-(DPPackedMatrixIterator_<TByte> const & left, DPPackedMatrixIterator_<TByte> const & right)
+{
+    return static_cast<ptrdiff_t>(left._pos) - static_cast<ptrdiff_t>(right._pos);
+}
+
+template <typename TByte>
+inline bool
+operator==(DPPackedMatrixIterator_<TByte> const & left, DPPackedMatrixIterator_<TByte> const & right)
+{
+    return left._data == right._data && left._pos == right._pos;
+}
+
+template <typename TByte>
+inline bool
+operator!=(DPPackedMatrixIterator_<TByte> const & left, DPPackedMatrixIterator_<TByte> const & right)
+{
+    return !(left == right);
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_DP_MATRIX_PACKED_H_
@@ -64,6 +64,11 @@ public:
         create(_dataHost);
     }
 
+    // Works on the given host, e.g. the buffer of a DPContext.
+    explicit DPMatrix_(THost & host) :
+        _dataHost(host)
+    {}
+
     DPMatrix_(DPMatrix_ const & other) :
         _dataHost(other._dataHost) {}
 
@@ -555,6 +555,89 @@ _setUpAndRunAlignment(String<TAlphabetH, TSpecH> const & seqH,
     return _setUpAndRunAlignment(noState, seqH, seqV, scoringScheme, alignConfig, algoTag, GapsLeft());
 }
 
+// Interface with AlignConfig and a DPContext whose buffers are reused.
+template <typename TContextScoreValue, typename TTraceSegment, typename TSpec, typename TSequenceH,
+          typename TSequenceV, typename TScoreValue, typename TScoreSpec, bool TTop, bool TRight, bool TLeft,
+          bool TBottom, typename TACSpec, typename TAlgoTag, typename TGapsTag>
+typename Value<Score<TScoreValue, TScoreSpec> >::Type
+_setUpAndRunAlignment(DPContext<TContextScoreValue> & dpContext,
+                      String<TTraceSegment, TSpec> & traceSegments,
+                      TSequenceH const & seqH,
+                      TSequenceV const & seqV,
+                      Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                      AlignConfig<TTop, TRight, TLeft, TBottom, TACSpec> const &,
+                      TAlgoTag const &,
+                      TGapsTag const &)
+{
+    typedef Score<TScoreValue, TScoreSpec> TScoringScheme;
+    typedef typename SequenceEntryForScore<TScoringScheme, TSequenceH>::Type TSequenceHEntry;
+    typedef typename SequenceEntryForScore<TScoringScheme, TSequenceV>::Type TSequenceVEntry;
+    typedef AlignConfig<TTop, TRight, TLeft, TBottom, TACSpec> TAlignConfig;
+
+    SEQAN_ASSERT_GEQ(length(seqH), 1u);
+    SEQAN_ASSERT_GEQ(length(seqV), 1u);
+
+    DPScoutState_<Default> noState;
+    TSequenceHEntry seqHEntry = sequenceEntryForScore(scoringScheme, seqH, 0);
+    TSequenceVEntry seqVEntry = sequenceEntryForScore(scoringScheme, seqV, 0);
+
+    if (scoreGapExtendHorizontal(scoringScheme, seqHEntry, seqVEntry) !=
+        scoreGapOpenHorizontal(scoringScheme, seqHEntry, seqVEntry) ||
+        scoreGapExtendVertical(scoringScheme, seqHEntry, seqVEntry) !=
+        scoreGapOpenVertical(scoringScheme, seqHEntry, seqVEntry))
+    {
+        typedef typename SetupAlignmentProfile_<TAlgoTag, TAlignConfig, AffineGaps, TracebackOn<TGapsTag> >::Type TDPProfile;
+        return _computeAlignment(dpContext, traceSegments, noState, seqH, seqV, scoringScheme, DPBand_<BandOff>(),
+                                 TDPProfile());
+    }
+    else
+    {
+        typedef typename SetupAlignmentProfile_<TAlgoTag, TAlignConfig, LinearGaps, TracebackOn<TGapsTag> >::Type TDPProfile;
+        return _computeAlignment(dpContext, traceSegments, noState, seqH, seqV, scoringScheme, DPBand_<BandOff>(),
+                                 TDPProfile());
+    }
+}
+
+// Interface with AlignConfig, traceback disabled and a DPContext whose buffers are reused.
+template <typename TContextScoreValue, typename TSequenceH, typename TSequenceV, typename TScoreValue,
+          typename TScoreSpec, bool TTop, bool TRight, bool TLeft, bool TBottom, typename TACSpec, typename TAlgoTag>
+typename Value<Score<TScoreValue, TScoreSpec> >::Type
+_setUpAndRunAlignment(DPContext<TContextScoreValue> & dpContext,
+                      TSequenceH const & seqH,
+                      TSequenceV const & seqV,
+                      Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                      AlignConfig<TTop, TRight, TLeft, TBottom, TACSpec> const &,
+                      TAlgoTag const &)
+{
+    typedef Score<TScoreValue, TScoreSpec> TScoringScheme;
+    typedef typename SequenceEntryForScore<TScoringScheme, TSequenceH>::Type TSequenceHEntry;
+    typedef typename SequenceEntryForScore<TScoringScheme, TSequenceV>::Type TSequenceVEntry;
+    typedef AlignConfig<TTop, TRight, TLeft, TBottom, TACSpec> TAlignConfig;
+
+    SEQAN_ASSERT_GEQ(length(seqH), 1u);
+    SEQAN_ASSERT_GEQ(length(seqV), 1u);
+
+    DPScoutState_<Default> noState;
+    TSequenceHEntry seqHEntry = sequenceEntryForScore(scoringScheme, seqH, 0);
+    TSequenceVEntry seqVEntry = sequenceEntryForScore(scoringScheme, seqV, 0);
+
+    if (scoreGapExtendHorizontal(scoringScheme, seqHEntry, seqVEntry) !=
+        scoreGapOpenHorizontal(scoringScheme, seqHEntry, seqVEntry) ||
+        scoreGapExtendVertical(scoringScheme, seqHEntry, seqVEntry) !=
+        scoreGapOpenVertical(scoringScheme, seqHEntry, seqVEntry))
+    {
+        typedef typename SetupAlignmentProfile_<TAlgoTag, TAlignConfig, AffineGaps, TracebackOff>::Type TDPProfile;
+        return _computeAlignment(dpContext, _dpTraceSegments(dpContext), noState, seqH, seqV, scoringScheme,
+                                 DPBand_<BandOff>(), TDPProfile());
+    }
+    else
+    {
+        typedef typename SetupAlignmentProfile_<TAlgoTag, TAlignConfig, LinearGaps, TracebackOff>::Type TDPProfile;
+        return _computeAlignment(dpContext, _dpTraceSegments(dpContext), noState, seqH, seqV, scoringScheme,
+                                 DPBand_<BandOff>(), TDPProfile());
+    }
+}
+
 // ----------------------------------------------------------------------------
 // Function _setUpAndRunAlignment()                                    [Banded]
 // ----------------------------------------------------------------------------
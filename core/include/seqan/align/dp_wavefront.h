@@ -0,0 +1,327 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Wavefront parallelization of the dynamic programming for long global
+// alignments.  The matrix is split into square tiles; all tiles on one
+// anti-diagonal of the tile grid only depend on tiles of the previous
+// anti-diagonals and are computed concurrently.
+// ==========================================================================
+
+#ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_DP_WAVEFRONT_H_
+#define SEQAN_CORE_INCLUDE_SEQAN_ALIGN_DP_WAVEFRONT_H_
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class DPWavefrontConfig_
+// ----------------------------------------------------------------------------
+
+// The wavefront is used for matrices of at least MIN_CELLS cells if more
+// than one thread is available.
+
+struct DPWavefrontConfig_
+{
+    enum
+    {
+        TILE_SIZE = 2048,
+        MIN_CELLS = 1 << 26
+    };
+};
+
+// ----------------------------------------------------------------------------
+// Class DPWavefrontGotohKernel_
+// ----------------------------------------------------------------------------
+
+// Tile kernel for global alignment scores with affine gap costs.  The row
+// buffers hold the last computed row (H and the vertical gap scores F) of
+// every column, the column buffers the last computed column (H and the
+// horizontal gap scores E) of every row.  Each band of tile rows also keeps
+// the H value of the upper left corner of its next tile, since the row
+// buffer has already been overwritten there when the tile is computed.
+
+template <typename TSequenceH, typename TSequenceV, typename TScore>
+class DPWavefrontGotohKernel_
+{
+public:
+    typedef typename Value<TScore>::Type TScoreValue;
+
+    TSequenceH const & seqH;
+    TSequenceV const & seqV;
+    TScore const & scoringScheme;
+    TScoreValue gapOpen;
+    TScoreValue gapExtend;
+
+    String<TScoreValue> rowH;
+    String<TScoreValue> rowF;
+    String<TScoreValue> columnH;
+    String<TScoreValue> columnE;
+    String<TScoreValue> corner;
+
+    DPWavefrontGotohKernel_(TSequenceH const & _seqH, TSequenceV const & _seqV, TScore const & _scoringScheme) :
+        seqH(_seqH), seqV(_seqV), scoringScheme(_scoringScheme), gapOpen(scoreGapOpen(_scoringScheme)),
+        gapExtend(scoreGapExtend(_scoringScheme))
+    {}
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function _dpWavefrontEnabled()
+// ----------------------------------------------------------------------------
+
+// Returns true if more than one thread is available for the wavefront.
+
+inline bool
+_dpWavefrontEnabled()
+{
+#ifdef _OPENMP
+    return omp_get_max_threads() > 1;
+#else
+    return false;
+#endif
+}
+
+// ----------------------------------------------------------------------------
+// Function _dpWavefrontTileSize()
+// ----------------------------------------------------------------------------
+
+// Returns the tile size for a matrix with the given dimensions or 0 if the
+// matrix should be computed sequentially.  Callers check _dpWavefrontEnabled()
+// once beforehand.
+
+inline size_t
+_dpWavefrontTileSize(size_t rows, size_t cols)
+{
+    if (rows >= 2u * DPWavefrontConfig_::TILE_SIZE && cols >= 2u * DPWavefrontConfig_::TILE_SIZE &&
+        static_cast<double>(rows) * cols >= static_cast<double>(DPWavefrontConfig_::MIN_CELLS))
+        return DPWavefrontConfig_::TILE_SIZE;
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function _dpWavefrontSupports()
+// ----------------------------------------------------------------------------
+
+// Returns true if the affine gap kernel of the wavefront computes the same
+// scores as the given algorithm.  Needleman-Wunsch uses linear gap costs and
+// only agrees if the gap open and extension scores are equal.
+
+template <typename TScoreValue, typename TScoreSpec, typename TAlgoTag>
+inline bool
+_dpWavefrontSupports(Score<TScoreValue, TScoreSpec> const &, TAlgoTag const &)
+{
+    return false;
+}
+
+template <typename TScoreValue, typename TScoreSpec>
+inline bool
+_dpWavefrontSupports(Score<TScoreValue, TScoreSpec> const &, Gotoh const &)
+{
+    return true;
+}
+
+template <typename TScoreValue, typename TScoreSpec>
+inline bool
+_dpWavefrontSupports(Score<TScoreValue, TScoreSpec> const & scoringScheme, NeedlemanWunsch const &)
+{
+    return scoreGapOpen(scoringScheme) == scoreGapExtend(scoringScheme);
+}
+
+// ----------------------------------------------------------------------------
+// Function _dpWavefront()
+// ----------------------------------------------------------------------------
+
+// Computes the tiles of a rows x cols matrix (without the initialization row
+// and column) anti-diagonal by anti-diagonal.  The tiles of one anti-diagonal
+// are distributed over the threads, the implicit barrier of the loop
+// separates the anti-diagonals.
+
+template <typename TKernel>
+inline void
+_dpWavefront(TKernel & kernel, size_t rows, size_t cols, size_t tileSize)
+{
+    SEQAN_ASSERT_GT(tileSize, 0u);
+
+    int tilesV = static_cast<int>((rows + tileSize - 1) / tileSize);
+    int tilesH = static_cast<int>((cols + tileSize - 1) / tileSize);
+
+    SEQAN_OMP_PRAGMA(parallel)
+    {
+        for (int diag = 0; diag < tilesV + tilesH - 1; ++diag)
+        {
+            int firstTile = _max(0, diag - tilesH + 1);
+            int lastTile = _min(diag, tilesV - 1);
+
+            SEQAN_OMP_PRAGMA(for schedule(dynamic))
+            for (int tileV = firstTile; tileV <= lastTile; ++tileV)
+            {
+                size_t rowBegin = tileV * tileSize;
+                size_t colBegin = (diag - tileV) * tileSize;
+                _computeWavefrontTile(kernel, tileV, rowBegin, _min(rows, rowBegin + tileSize),
+                                      colBegin, _min(cols, colBegin + tileSize));
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _computeWavefrontTile()                                    [Gotoh]
+// ----------------------------------------------------------------------------
+
+// Computes the cells (rowBegin, rowEnd] x (colBegin, colEnd] of the matrix.
+
+template <typename TSequenceH, typename TSequenceV, typename TScore>
+inline void
+_computeWavefrontTile(DPWavefrontGotohKernel_<TSequenceH, TSequenceV, TScore> & kernel,
+                      int tileV,
+                      size_t rowBegin,
+                      size_t rowEnd,
+                      size_t colBegin,
+                      size_t colEnd)
+{
+    typedef typename Value<TScore>::Type TScoreValue;
+    typedef typename Iterator<TSequenceH const, Standard>::Type TIterH;
+    typedef typename Value<TSequenceV const>::Type TValueV;
+
+    TScoreValue * rowH = begin(kernel.rowH, Standard());
+    TScoreValue * rowF = begin(kernel.rowF, Standard());
+
+    // The diagonal value of the first row of this tile; the upper right
+    // corner is the diagonal value of the next tile in this band.
+    TScoreValue diagonal = kernel.corner[tileV];
+    kernel.corner[tileV] = rowH[colEnd];
+
+    for (size_t row = rowBegin + 1; row <= rowEnd; ++row)
+    {
+        TValueV valueV = kernel.seqV[row - 1];
+        TScoreValue left = kernel.columnH[row];
+        TScoreValue horizontal = kernel.columnE[row];
+        TScoreValue current = left;
+        TScoreValue diag = diagonal;
+        diagonal = left;
+
+        TIterH itH = begin(kernel.seqH, Standard()) + colBegin;
+        for (size_t col = colBegin + 1; col <= colEnd; ++col, ++itH)
+        {
+            TScoreValue up = rowH[col];
+            horizontal = _max(current + kernel.gapOpen, horizontal + kernel.gapExtend);
+            TScoreValue vertical = _max(up + kernel.gapOpen, rowF[col] + kernel.gapExtend);
+            current = _max(diag + score(kernel.scoringScheme, *itH, valueV), _max(horizontal, vertical));
+            diag = up;
+            rowH[col] = current;
+            rowF[col] = vertical;
+        }
+        kernel.columnH[row] = current;
+        kernel.columnE[row] = horizontal;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _globalAlignmentScoreWavefront()
+// ----------------------------------------------------------------------------
+
+// Computes the global alignment score with affine gap costs (linear gap
+// costs are the special case of equal gap open and extension scores) using
+// tiles of size tileSize.
+
+template <typename TSequenceH, typename TSequenceV, typename TScoreValue, typename TScoreSpec,
+          bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec>
+TScoreValue
+_globalAlignmentScoreWavefront(TSequenceH const & seqH,
+                               TSequenceV const & seqV,
+                               Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                               AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const &,
+                               size_t tileSize)
+{
+    typedef Score<TScoreValue, TScoreSpec> TScore;
+    typedef DPWavefrontGotohKernel_<TSequenceH, TSequenceV, TScore> TKernel;
+
+    size_t lengthH = length(seqH);
+    size_t lengthV = length(seqV);
+    SEQAN_ASSERT_GEQ(lengthH, 1u);
+    SEQAN_ASSERT_GEQ(lengthV, 1u);
+
+    TScoreValue const negInf = MinValue<TScoreValue>::VALUE / 2;
+    TKernel kernel(seqH, seqV, scoringScheme);
+
+    // Initialize the first row and column.
+    resize(kernel.rowH, lengthH + 1, Exact());
+    resize(kernel.rowF, lengthH + 1, negInf, Exact());
+    resize(kernel.columnH, lengthV + 1, Exact());
+    resize(kernel.columnE, lengthV + 1, negInf, Exact());
+    kernel.rowH[0] = 0;
+    for (size_t col = 1; col <= lengthH; ++col)
+        kernel.rowH[col] = (TOP) ? 0 : kernel.gapOpen + static_cast<TScoreValue>(col - 1) * kernel.gapExtend;
+    kernel.columnH[0] = 0;
+    for (size_t row = 1; row <= lengthV; ++row)
+        kernel.columnH[row] = (LEFT) ? 0 : kernel.gapOpen + static_cast<TScoreValue>(row - 1) * kernel.gapExtend;
+    TScoreValue lastRowFirst = kernel.columnH[lengthV];
+
+    resize(kernel.corner, (lengthV + tileSize - 1) / tileSize, Exact());
+    for (size_t tileV = 0; tileV < length(kernel.corner); ++tileV)
+        kernel.corner[tileV] = kernel.columnH[tileV * tileSize];
+
+    _dpWavefront(kernel, lengthV, lengthH, tileSize);
+
+    // The buffers now hold the last row and the last column.
+    TScoreValue best = kernel.rowH[lengthH];
+    if (BOTTOM)
+    {
+        best = _max(best, lastRowFirst);
+        for (size_t col = 1; col < lengthH; ++col)
+            best = _max(best, kernel.rowH[col]);
+    }
+    if (RIGHT)
+    {
+        best = _max(best, (TOP) ? 0 : kernel.gapOpen + static_cast<TScoreValue>(lengthH - 1) * kernel.gapExtend);
+        for (size_t row = 1; row < lengthV; ++row)
+            best = _max(best, kernel.columnH[row]);
+    }
+    return best;
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_DP_WAVEFRONT_H_
@@ -61,6 +61,21 @@ class Fragment;
 // Tags, Classes, Enums
 // ============================================================================
 
+// ----------------------------------------------------------------------------
+// Class DPBandDoublingConfig_
+// ----------------------------------------------------------------------------
+
+// The first band of the BandDoubling mode extends INITIAL_WIDTH diagonals
+// beyond the diagonals of the two ends of the alignment matrix.
+
+struct DPBandDoublingConfig_
+{
+    enum
+    {
+        INITIAL_WIDTH = 16
+    };
+};
+
 // ============================================================================
 // Metafunctions
 // ============================================================================
@@ -526,6 +541,223 @@ TScoreValue globalAlignmentScore(StringSet<TString, TSpec> const & strings,
     return globalAlignmentScore(strings[0], strings[1], scoringScheme, alignConfig, lowerDiag, upperDiag);
 }
 
+// ----------------------------------------------------------------------------
+// Function _bandDoublingMaxSubstitution()
+// ----------------------------------------------------------------------------
+
+// Returns the best score of any aligned pair of characters.
+
+template <typename TAlphabetH, typename TAlphabetV, typename TScoreValue, typename TScoreSpec>
+inline TScoreValue
+_bandDoublingMaxSubstitution(Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    TScoreValue result = score(scoringScheme, TAlphabetH(0), TAlphabetV(0));
+    for (unsigned i = 0; i < ValueSize<TAlphabetH>::VALUE; ++i)
+        for (unsigned j = 0; j < ValueSize<TAlphabetV>::VALUE; ++j)
+            result = _max(result, static_cast<TScoreValue>(score(scoringScheme, TAlphabetH(i), TAlphabetV(j))));
+    return result;
+}
+
+template <typename TAlphabetH, typename TAlphabetV, typename TScoreValue>
+inline TScoreValue
+_bandDoublingMaxSubstitution(Score<TScoreValue, Simple> const & scoringScheme)
+{
+    return _max(scoreMatch(scoringScheme), scoreMismatch(scoringScheme));
+}
+
+// ----------------------------------------------------------------------------
+// Function _bandDoublingOutsideBound()
+// ----------------------------------------------------------------------------
+
+// Returns an upper bound for the score of all global alignments that leave the
+// band [lowerDiag, upperDiag].  Such an alignment crosses one of the diagonals
+// next to the band and needs at least |d| + |d - (lenH - lenV)| gaps to reach
+// diagonal d and the end of the matrix.  The remaining characters form at most
+// (lenH + lenV - gaps) / 2 aligned pairs and the gaps form at least two runs.
+// The bound only holds if opening a gap is not better than extending it and two
+// gaps are not better than one aligned pair.
+
+template <typename TScoreValue, typename TScoreSpec>
+inline __int64
+_bandDoublingOutsideBound(Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                          __int64 lenH,
+                          __int64 lenV,
+                          int lowerDiag,
+                          int upperDiag,
+                          TScoreValue maxSubstitution)
+{
+    __int64 delta = lenH - lenV;
+    __int64 minGaps = MaxValue<__int64>::VALUE;
+    if (upperDiag < lenH)
+    {
+        __int64 diag = upperDiag + 1;
+        minGaps = _min(minGaps, _abs(diag) + _abs(diag - delta));
+    }
+    if (lowerDiag > -lenV)
+    {
+        __int64 diag = lowerDiag - 1;
+        minGaps = _min(minGaps, _abs(diag) + _abs(diag - delta));
+    }
+    SEQAN_ASSERT_GEQ(minGaps, 2);
+
+    return static_cast<__int64>(maxSubstitution) * ((lenH + lenV - minGaps) / 2) +
+           2 * static_cast<__int64>(scoreGapOpen(scoringScheme)) +
+           (minGaps - 2) * static_cast<__int64>(scoreGapExtend(scoringScheme));
+}
+
+// ----------------------------------------------------------------------------
+// Function _runBandDoubling()
+// ----------------------------------------------------------------------------
+
+// Computes the banded alignment of one round, with or without traceback.  A
+// band covering the whole matrix is computed by the unbanded algorithm.
+
+template <typename TTraceSegment, typename TSpec, typename TSequenceH, typename TSequenceV,
+          typename TScoreValue, typename TScoreSpec, typename TAlgoTag>
+inline TScoreValue
+_runBandDoubling(String<TTraceSegment, TSpec> & traceSegments,
+                 TSequenceH const & seqH,
+                 TSequenceV const & seqV,
+                 Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                 int lowerDiag,
+                 int upperDiag,
+                 TAlgoTag const & algoTag)
+{
+    clear(traceSegments);
+    if (lowerDiag <= -static_cast<int>(length(seqV)) && upperDiag >= static_cast<int>(length(seqH)))
+        return _setUpAndRunAlignment(traceSegments, seqH, seqV, scoringScheme, AlignConfig<>(), algoTag);
+    return _setUpAndRunAlignment(traceSegments, seqH, seqV, scoringScheme, AlignConfig<>(), lowerDiag, upperDiag,
+                                 algoTag);
+}
+
+template <typename TSequenceH, typename TSequenceV, typename TScoreValue, typename TScoreSpec, typename TAlgoTag>
+inline TScoreValue
+_runBandDoubling(Nothing & /*scoreOnly*/,
+                 TSequenceH const & seqH,
+                 TSequenceV const & seqV,
+                 Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                 int lowerDiag,
+                 int upperDiag,
+                 TAlgoTag const & algoTag)
+{
+    if (lowerDiag <= -static_cast<int>(length(seqV)) && upperDiag >= static_cast<int>(length(seqH)))
+        return _setUpAndRunAlignment(seqH, seqV, scoringScheme, AlignConfig<>(), algoTag);
+    return _setUpAndRunAlignment(seqH, seqV, scoringScheme, AlignConfig<>(), lowerDiag, upperDiag, algoTag);
+}
+
+// ----------------------------------------------------------------------------
+// Function _setUpAndRunBandDoubling()
+// ----------------------------------------------------------------------------
+
+// Doubles the band width until the score of the banded alignment reaches the
+// bound for all alignments leaving the band or the band covers the whole matrix.
+
+template <typename TTarget, typename TSequenceH, typename TSequenceV, typename TScoreValue, typename TScoreSpec,
+          typename TAlgoTag>
+inline TScoreValue
+_setUpAndRunBandDoubling(TTarget & target,
+                         TSequenceH const & seqH,
+                         TSequenceV const & seqV,
+                         Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                         TAlgoTag const & algoTag)
+{
+    typedef typename Value<TSequenceH>::Type TAlphabetH;
+    typedef typename Value<TSequenceV>::Type TAlphabetV;
+
+    int lenH = length(seqH);
+    int lenV = length(seqV);
+    int delta = lenH - lenV;
+
+    // Without a valid bound only the full band yields the optimal alignment.
+    TScoreValue maxSubstitution = _bandDoublingMaxSubstitution<TAlphabetH, TAlphabetV>(scoringScheme);
+    if (scoreGapOpen(scoringScheme) > scoreGapExtend(scoringScheme) ||
+        2 * scoreGapExtend(scoringScheme) > maxSubstitution)
+        return _runBandDoubling(target, seqH, seqV, scoringScheme, -lenV, lenH, algoTag);
+
+    for (__int64 width = DPBandDoublingConfig_::INITIAL_WIDTH; ; width *= 2)
+    {
+        int lowerDiag = static_cast<int>(_max(static_cast<__int64>(-lenV), _min(0, delta) - width));
+        int upperDiag = static_cast<int>(_min(static_cast<__int64>(lenH), _max(0, delta) + width));
+        TScoreValue res = _runBandDoubling(target, seqH, seqV, scoringScheme, lowerDiag, upperDiag, algoTag);
+        if ((lowerDiag == -lenV && upperDiag == lenH) ||
+            res >= _bandDoublingOutsideBound(scoringScheme, lenH, lenV, lowerDiag, upperDiag, maxSubstitution))
+            return res;
+    }
+}
+
+template <typename TTarget, typename TSequenceH, typename TSequenceV, typename TScoreValue, typename TScoreSpec>
+inline TScoreValue
+_setUpAndRunBandDoubling(TTarget & target,
+                         TSequenceH const & seqH,
+                         TSequenceV const & seqV,
+                         Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    if (scoreGapOpen(scoringScheme) == scoreGapExtend(scoringScheme))
+        return _setUpAndRunBandDoubling(target, seqH, seqV, scoringScheme, NeedlemanWunsch());
+    else
+        return _setUpAndRunBandDoubling(target, seqH, seqV, scoringScheme, Gotoh());
+}
+
+// ----------------------------------------------------------------------------
+// Function globalAlignment()                            [BandDoubling, Align]
+// ----------------------------------------------------------------------------
+
+template <typename TSequence, typename TAlignSpec, typename TScoreValue, typename TScoreSpec>
+TScoreValue globalAlignment(Align<TSequence, TAlignSpec> & align,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            BandDoubling const & /*tag*/)
+{
+    typedef Align<TSequence, TAlignSpec> TAlign;
+    typedef typename Size<TAlign>::Type  TSize;
+    typedef typename Position<TAlign>::Type TPosition;
+    typedef TraceSegment_<TPosition, TSize> TTraceSegment;
+
+    String<TTraceSegment> trace;
+
+    TScoreValue res = _setUpAndRunBandDoubling(trace, source(row(align, 0)), source(row(align, 1)), scoringScheme);
+    _adaptTraceSegmentsTo(row(align, 0), row(align, 1), trace);
+    return res;
+}
+
+// ----------------------------------------------------------------------------
+// Function globalAlignment()                             [BandDoubling, Gaps]
+// ----------------------------------------------------------------------------
+
+template <typename TSequenceH, typename TGapsSpecH,
+          typename TSequenceV, typename TGapsSpecV,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                            Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            BandDoubling const & /*tag*/)
+{
+    typedef typename Size<TSequenceH>::Type TSize;
+    typedef typename Position<TSequenceH>::Type TPosition;
+    typedef TraceSegment_<TPosition, TSize> TTraceSegment;
+
+    String<TTraceSegment> traceSegments;
+
+    TScoreValue res = _setUpAndRunBandDoubling(traceSegments, source(gapsH), source(gapsV), scoringScheme);
+    _adaptTraceSegmentsTo(gapsH, gapsV, traceSegments);
+    return res;
+}
+
+// ----------------------------------------------------------------------------
+// Function globalAlignmentScore()                   [BandDoubling, 2 Strings]
+// ----------------------------------------------------------------------------
+
+template <typename TAlphabetH, typename TSpecH,
+          typename TAlphabetV, typename TSpecV,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue globalAlignmentScore(String<TAlphabetH, TSpecH> const & seqH,
+                                 String<TAlphabetV, TSpecV> const & seqV,
+                                 Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                 BandDoubling const & /*tag*/)
+{
+    Nothing scoreOnly;
+    return _setUpAndRunBandDoubling(scoreOnly, seqH, seqV, scoringScheme);
+}
+
 }  // namespace seqan
 
 #endif  // #ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_GLOBAL_ALIGNMENT_BANDED_H_
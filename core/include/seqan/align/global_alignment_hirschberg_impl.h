@@ -90,6 +90,38 @@ public:
 
 };
 
+// ----------------------------------------------------------------------------
+// Helper Class DPWavefrontHirschbergKernel_
+// ----------------------------------------------------------------------------
+
+// Tile kernel computing the cut of Hirschberg's algorithm on the wavefront.
+// The rows are the positions in s1, the columns the positions in s2.  Each
+// cell stores its score and the column in which the optimal path passes the
+// mid row.  The row buffers are the c_score and pointer strings of the
+// sequential implementation, such that the tie breaking is the same.
+
+template <typename TSequenceH, typename TSequenceV, typename TScoreValue>
+class DPWavefrontHirschbergKernel_
+{
+public:
+    TSequenceH const & s1;
+    TSequenceV const & s2;
+    String<TScoreValue> & rowScore;
+    String<int> & rowPointer;
+    String<TScoreValue> columnScore;
+    String<int> columnPointer;
+    String<TScoreValue> cornerScore;
+    String<int> cornerPointer;
+    int begin1, begin2, mid;
+    TScoreValue scoreMatch, scoreMismatch, scoreGap;
+
+    DPWavefrontHirschbergKernel_(TSequenceH const & _s1, TSequenceV const & _s2, String<TScoreValue> & _rowScore,
+                                 String<int> & _rowPointer) :
+        s1(_s1), s2(_s2), rowScore(_rowScore), rowPointer(_rowPointer), begin1(0), begin2(0), mid(0),
+        scoreMatch(), scoreMismatch(), scoreGap()
+    {}
+};
+
 // ============================================================================
 // Metafunctions
 // ============================================================================
@@ -360,6 +392,138 @@ operator==(HirschbergSet_ const & lhs,
 
 #endif
 
+// ----------------------------------------------------------------------------
+// Function _computeWavefrontTile()                               [Hirschberg]
+// ----------------------------------------------------------------------------
+
+// Computes the cells (rowBegin, rowEnd] x (colBegin, colEnd] of the cut
+// relative to the sub problem, with the same recurrence as the sequential
+// loops in _globalAlignment().
+
+template <typename TSequenceH, typename TSequenceV, typename TScoreValue>
+inline void
+_computeWavefrontTile(DPWavefrontHirschbergKernel_<TSequenceH, TSequenceV, TScoreValue> & kernel,
+                      int tileV,
+                      size_t rowBegin,
+                      size_t rowEnd,
+                      size_t colBegin,
+                      size_t colEnd)
+{
+    int const colOffset = kernel.begin2;
+    int const first = colOffset + static_cast<int>(colBegin) + 1;
+    int const last = colOffset + static_cast<int>(colEnd);
+    TScoreValue * c_score = begin(kernel.rowScore, Standard());
+    int * pointer = begin(kernel.rowPointer, Standard());
+
+    TScoreValue diagScore = kernel.cornerScore[tileV];
+    int diagPointer = kernel.cornerPointer[tileV];
+    kernel.cornerScore[tileV] = c_score[last];
+    kernel.cornerPointer[tileV] = pointer[last];
+
+    for (size_t row = rowBegin + 1; row <= rowEnd; ++row)
+    {
+        int i = kernel.begin1 + static_cast<int>(row);
+        typename Value<TSequenceH const>::Type v = getValue(kernel.s1, i - 1);
+        TScoreValue leftScore = kernel.columnScore[row];
+        int leftPointer = kernel.columnPointer[row];
+        TScoreValue s = diagScore;
+        int dp = diagPointer;
+        diagScore = leftScore;
+        diagPointer = leftPointer;
+
+        for (int j = first; j <= last; ++j)
+        {
+            TScoreValue sg1 = kernel.scoreGap + c_score[j];
+            TScoreValue sg2 = kernel.scoreGap + leftScore;
+            TScoreValue sd = s + ((v == getValue(kernel.s2, j - 1)) ? kernel.scoreMatch : kernel.scoreMismatch);
+            s = c_score[j];
+            int sg = pointer[j];
+
+            if (i <= kernel.mid)
+            {
+                c_score[j] = (_max(sg1, sg2) > sd) ? _max(sg1, sg2) : sd;
+            }
+            else if (sd >= _max(sg1, sg2))
+            {
+                c_score[j] = sd;
+                pointer[j] = dp;
+            }
+            else if (sg2 > sg1)
+            {
+                c_score[j] = sg2;
+                pointer[j] = leftPointer;
+            }
+            else
+            {
+                c_score[j] = sg1;
+            }
+            dp = sg;
+            leftScore = c_score[j];
+            leftPointer = pointer[j];
+        }
+        kernel.columnScore[row] = leftScore;
+        kernel.columnPointer[row] = leftPointer;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _hirschbergCutWavefront()
+// ----------------------------------------------------------------------------
+
+// Fills c_score and pointer for the sub problem target like the sequential
+// cut computation in _globalAlignment(), using tiles of size tileSize.
+
+template <typename TSequenceH, typename TSequenceV, typename TScoreValue>
+inline void
+_hirschbergCutWavefront(String<TScoreValue> & c_score,
+                        String<int> & pointer,
+                        TSequenceH const & s1,
+                        TSequenceV const & s2,
+                        HirschbergSet_ const & target,
+                        int mid,
+                        TScoreValue scoreMatch,
+                        TScoreValue scoreMismatch,
+                        TScoreValue scoreGap,
+                        size_t tileSize)
+{
+    typedef DPWavefrontHirschbergKernel_<TSequenceH, TSequenceV, TScoreValue> TKernel;
+
+    size_t rows = _end1(target) - _begin1(target);
+    size_t cols = _end2(target) - _begin2(target);
+
+    TKernel kernel(s1, s2, c_score, pointer);
+    kernel.begin1 = _begin1(target);
+    kernel.begin2 = _begin2(target);
+    kernel.mid = mid;
+    kernel.scoreMatch = scoreMatch;
+    kernel.scoreMismatch = scoreMismatch;
+    kernel.scoreGap = scoreGap;
+
+    TScoreValue border = 0;
+    for (int j = _begin2(target); j <= _end2(target); ++j)
+    {
+        c_score[j] = border;
+        border += scoreGap;
+        pointer[j] = j;
+    }
+
+    resize(kernel.columnScore, rows + 1, Exact());
+    resize(kernel.columnPointer, rows + 1, _begin2(target), Exact());
+    border = 0;
+    for (size_t row = 0; row <= rows; ++row)
+    {
+        kernel.columnScore[row] = border;
+        border += scoreGap;
+    }
+
+    resize(kernel.cornerScore, (rows + tileSize - 1) / tileSize, Exact());
+    resize(kernel.cornerPointer, length(kernel.cornerScore), _begin2(target), Exact());
+    for (size_t tileV = 0; tileV < length(kernel.cornerScore); ++tileV)
+        kernel.cornerScore[tileV] = kernel.columnScore[tileV * tileSize];
+
+    _dpWavefront(kernel, rows, cols, tileSize);
+}
+
 // debug flag .. define to see where Hirschberg cuts the sequences	
 //#define SEQAN_HIRSCHBERG_DEBUG_CUT
 
@@ -387,7 +551,8 @@ TScoreValue
 _globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
                  Gaps<TSequenceV, TGapsSpecV> & gapsV,
                  Score<TScoreValue, TScoreSpec> const & score_,
-                 Hirschberg const & /*algorithmTag*/)
+                 Hirschberg const & /*algorithmTag*/,
+                 size_t wavefrontTileSize)
 {
     TSequenceH const & s1 = source(gapsH);
     TSequenceV const & s2 = source(gapsV);
@@ -437,6 +602,9 @@ _globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
 	HirschbergSet_ hs_complete(0,len1,0,len2,0);
 	to_process.push(hs_complete);
 
+    // The thread check is done once for all sub problems.
+    bool autoWavefront = wavefrontTileSize == 0 && _dpWavefrontEnabled();
+
 	while(!to_process.empty())
 	{
 		target = to_process.top();
@@ -634,6 +802,19 @@ _globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
 			*/
 			int mid = static_cast<int>(floor( static_cast<double>((_begin1(target) + _end1(target))/2) ));
 
+            // Large cuts are computed in parallel tiles along the anti-diagonals.
+            size_t tileSize = wavefrontTileSize;
+            if (autoWavefront)
+                tileSize = _dpWavefrontTileSize(_end1(target) - _begin1(target), _end2(target) - _begin2(target));
+            if (tileSize != 0)
+            {
+                _hirschbergCutWavefront(c_score, pointer, s1, s2, target, mid, score_match, score_mismatch, score_gap,
+                                        tileSize);
+                to_process.push(HirschbergSet_(mid,_end1(target),pointer[_end2(target)],_end2(target),0));
+                to_process.push(HirschbergSet_(_begin1(target),mid,_begin2(target),pointer[_end2(target)],0));
+                continue;
+            }
+
 #ifdef SEQAN_HIRSCHBERG_DEBUG_CUT
 			std::cout << "calculate cut for s1 " << _begin1(target) << " to " << _end1(target) << " and s2 " << _begin2(target) << " to " << _end2(target) << std::endl;
 			std::cout << "calculate cut for " << infix(s1,_begin1(target),_end1(target)) << " and " << infix(s2,_begin2(target),_end2(target)) << std::endl;
@@ -724,6 +905,18 @@ _globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
 	return total_score;
 }
 
+template <typename TSequenceH, typename TGapsSpecH, typename TSequenceV, typename TGapsSpecV,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue
+_globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                 Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                 Score<TScoreValue, TScoreSpec> const & score_,
+                 Hirschberg const & algorithmTag)
+{
+    // The tile size 0 selects the wavefront for large cuts if several threads are available.
+    return _globalAlignment(gapsH, gapsV, score_, algorithmTag, 0u);
+}
+
 }  // namespace seqan
 
 #endif  // #ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_GLOBAL_ALIGNMENT_HIRSCHBERG_IMPL_H_
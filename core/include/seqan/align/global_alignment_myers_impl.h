@@ -47,6 +47,30 @@ namespace seqan {
 // Tags, Classes, Enums
 // ============================================================================
 
+// ----------------------------------------------------------------------------
+// Class MyersBitVectorTrace_
+// ----------------------------------------------------------------------------
+
+// Keeps the vertical delta vectors VP/VN of the computed blocks of every column
+// together with the score in the last row of each block.  This is enough to
+// restore any cell value of the stored blocks in constant time.  Column j is
+// stored at [columnBegin[j], columnBegin[j + 1]) and starts with block
+// firstBlock[j], column 0 is implicit.
+
+struct MyersBitVectorTrace_
+{
+    typedef __uint64 TWord;
+
+    static const unsigned BLOCK_SIZE = 64;
+
+    unsigned rows;
+    String<unsigned> firstBlock;
+    String<size_t> columnBegin;
+    String<TWord> VP;
+    String<TWord> VN;
+    String<int> blockScore;
+};
+
 // ============================================================================
 // Metafunctions
 // ============================================================================
@@ -196,6 +220,243 @@ _globalAlignmentScore(String<TAlphabetH, TSpecH> const & seqH,
 	return score;
 }
 
+// ----------------------------------------------------------------------------
+// Function _myersTraceValue()
+// ----------------------------------------------------------------------------
+
+// Returns the edit distance of cell (row, col).  The cell must lie in a stored block.
+
+inline int
+_myersTraceValue(MyersBitVectorTrace_ const & trace, unsigned row, size_t col)
+{
+    typedef MyersBitVectorTrace_::TWord TWord;
+    const unsigned BLOCK_SIZE = MyersBitVectorTrace_::BLOCK_SIZE;
+
+    if (col == 0)
+        return row;
+    if (row == 0)
+        return col;
+
+    unsigned block = (row - 1) / BLOCK_SIZE;
+    SEQAN_ASSERT_GEQ(block, trace.firstBlock[col]);
+    size_t idx = trace.columnBegin[col] + block - trace.firstBlock[col];
+    SEQAN_ASSERT_LT(idx, trace.columnBegin[col + 1]);
+
+    // Subtract the vertical deltas of the rows below row in this block.
+    unsigned bitsAbove = row - block * BLOCK_SIZE;
+    unsigned bitsValid = _min(trace.rows - block * BLOCK_SIZE, BLOCK_SIZE);
+    TWord mask = (bitsAbove == BLOCK_SIZE) ? 0 : (~static_cast<TWord>(0) << bitsAbove);
+    if (bitsValid < BLOCK_SIZE)
+        mask &= (static_cast<TWord>(1) << bitsValid) - 1;
+    return trace.blockScore[idx] - (int)popCount(trace.VP[idx] & mask) + (int)popCount(trace.VN[idx] & mask);
+}
+
+// ----------------------------------------------------------------------------
+// Function _computeMyersBitVectorTrace()
+// ----------------------------------------------------------------------------
+
+// Runs the multi-word bit-vector algorithm of Myers/Hyyro for the pattern y
+// (vertical) against the text x (horizontal) and stores the delta vectors of
+// every column.  Only the blocks covering the diagonals [lowerDiag, upperDiag]
+// are computed.  As in the Ukkonen cut-off, blocks entering the band at the
+// bottom start with increasing values and the block at the top of the band
+// gets a horizontal delta of +1, so cells outside of the band are
+// overestimated.  Returns the edit distance of the last cell.
+
+template <typename TSequenceH, typename TSequenceV>
+int
+_computeMyersBitVectorTrace(MyersBitVectorTrace_ & trace,
+                            TSequenceH const & x,
+                            TSequenceV const & y,
+                            int lowerDiag,
+                            int upperDiag)
+{
+    typedef MyersBitVectorTrace_::TWord TWord;
+    typedef typename Value<TSequenceV>::Type TPatternAlphabet;
+    const unsigned BLOCK_SIZE = MyersBitVectorTrace_::BLOCK_SIZE;
+    const TWord HIGH_BIT = static_cast<TWord>(1) << (BLOCK_SIZE - 1);
+
+    int len_x = length(x);
+    int len_y = length(y);
+    unsigned blockCount = (len_y + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    TWord lastBit = static_cast<TWord>(1) << ((len_y - 1) % BLOCK_SIZE);
+
+    trace.rows = len_y;
+    clear(trace.firstBlock);
+    clear(trace.columnBegin);
+    clear(trace.VP);
+    clear(trace.VN);
+    clear(trace.blockScore);
+    resize(trace.firstBlock, len_x + 1, 0u, Exact());
+    resize(trace.columnBegin, len_x + 2, 0u, Exact());
+    size_t bandBlocks = _min(blockCount, (unsigned)((upperDiag - lowerDiag) / BLOCK_SIZE + 2));
+    reserve(trace.VP, len_x * bandBlocks, Exact());
+    reserve(trace.VN, len_x * bandBlocks, Exact());
+    reserve(trace.blockScore, len_x * bandBlocks, Exact());
+
+    // encoding the letters as bit-vectors
+    String<TWord> bitMask;
+    resize(bitMask, ValueSize<TPatternAlphabet>::VALUE * blockCount, 0, Exact());
+    for (int j = 0; j < len_y; ++j)
+        bitMask[blockCount * ordValue(getValue(y, j)) + j / BLOCK_SIZE] |= static_cast<TWord>(1) << (j % BLOCK_SIZE);
+
+    // State of the current column.  Blocks below lastBlock have not been reached yet.
+    String<TWord> VP;
+    resize(VP, blockCount, ~static_cast<TWord>(0), Exact());
+    String<TWord> VN;
+    resize(VN, blockCount, 0, Exact());
+    String<int> score;
+    resize(score, blockCount, Exact());
+    for (unsigned b = 0; b < blockCount; ++b)
+        score[b] = _min((int)((b + 1) * BLOCK_SIZE), len_y);
+
+    int lastBlock = -1;
+    for (int col = 1; col <= len_x; ++col)
+    {
+        // rows of the band in this column
+        unsigned firstBlock = (_max(1, col - upperDiag) - 1) / BLOCK_SIZE;
+        int newLastBlock = (_min(len_y, col - lowerDiag) - 1) / BLOCK_SIZE;
+        for (; lastBlock < newLastBlock; ++lastBlock)
+        {
+            VP[lastBlock + 1] = ~static_cast<TWord>(0);
+            VN[lastBlock + 1] = 0;
+            if (lastBlock >= 0)
+                score[lastBlock + 1] = score[lastBlock] + _min((int)BLOCK_SIZE, len_y - (lastBlock + 1) * (int)BLOCK_SIZE);
+        }
+
+        trace.firstBlock[col] = firstBlock;
+        trace.columnBegin[col] = length(trace.VP);
+
+        unsigned shift = blockCount * ordValue(static_cast<TPatternAlphabet>(getValue(x, col - 1)));
+        TWord carryD0 = 0, carryHP = 1, carryHN = 0;
+        for (unsigned b = firstBlock; b <= (unsigned)lastBlock; ++b)
+        {
+            TWord X = bitMask[shift + b] | VN[b];
+            TWord temp = VP[b] + (X & VP[b]) + carryD0;
+            carryD0 = (carryD0) ? temp <= VP[b] : temp < VP[b];
+
+            TWord D0 = (temp ^ VP[b]) | X;
+            TWord HN = VP[b] & D0;
+            TWord HP = VN[b] | ~(VP[b] | D0);
+
+            TWord bottomBit = (b + 1 == blockCount) ? lastBit : HIGH_BIT;
+            if (HP & bottomBit)
+                ++score[b];
+            else if (HN & bottomBit)
+                --score[b];
+
+            X = (HP << 1) | carryHP;
+            carryHP = HP >> (BLOCK_SIZE - 1);
+            VN[b] = X & D0;
+            temp = (HN << 1) | carryHN;
+            carryHN = HN >> (BLOCK_SIZE - 1);
+            VP[b] = temp | ~(X | D0);
+
+            appendValue(trace.VP, VP[b]);
+            appendValue(trace.VN, VN[b]);
+            appendValue(trace.blockScore, score[b]);
+        }
+    }
+    trace.columnBegin[len_x + 1] = length(trace.VP);
+
+    return score[blockCount - 1];
+}
+
+// ----------------------------------------------------------------------------
+// Function _globalAlignment()                                 [MyersBitVector]
+// ----------------------------------------------------------------------------
+
+// Computes an edit distance alignment restricted to the diagonals [lowerDiag,
+// upperDiag] with the bit-vector algorithm.  The traceback is done on the
+// stored delta vectors, preferring diagonal over vertical over horizontal
+// steps like the default dynamic programming traceback.  Returns
+// MinValue<int>::VALUE if the traceback would have to leave the band.
+
+template <typename TSequenceH, typename TGapsSpecH, typename TSequenceV, typename TGapsSpecV>
+int
+_globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                 Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                 int lowerDiag,
+                 int upperDiag,
+                 MyersBitVector const & algorithmTag)
+{
+    typedef typename Source<Gaps<TSequenceV, TGapsSpecV> >::Type TSourceV;
+    typedef typename Value<TSourceV>::Type TPatternAlphabet;
+    typedef TraceSegment_<size_t, size_t> TTraceSegment;
+
+    // Switch horizontal and vertical gap roles, gapsV should be the shorter one
+    // to fit into less words.
+    if (length(source(gapsH)) < length(source(gapsV)))
+        return _globalAlignment(gapsV, gapsH, -upperDiag, -lowerDiag, algorithmTag);
+
+    int len_x = length(source(gapsH));
+    int len_y = length(source(gapsV));
+    if (lowerDiag > _min(0, len_x - len_y) || upperDiag < _max(0, len_x - len_y))
+        return MinValue<int>::VALUE;
+    lowerDiag = _max(lowerDiag, -len_y);
+    upperDiag = _min(upperDiag, len_x);
+
+    String<TTraceSegment> traceSegments;
+    int distance = len_x;
+    if (len_y == 0)
+    {
+        _recordSegment(traceSegments, 0u, 0u, len_x, +TraceBitMap_::HORIZONTAL);
+    }
+    else
+    {
+        MyersBitVectorTrace_ trace;
+        distance = _computeMyersBitVectorTrace(trace, source(gapsH), source(gapsV), lowerDiag, upperDiag);
+
+        int row = len_y;
+        int col = len_x;
+        int current = distance;
+        int runLength = 0;
+        unsigned runValue = TraceBitMap_::NONE;
+        while (row > 0 || col > 0)
+        {
+            unsigned traceValue = TraceBitMap_::NONE;
+            if (row > 0 && col > 0 && col - row >= lowerDiag && col - row <= upperDiag &&
+                _myersTraceValue(trace, row - 1, col - 1) +
+                (ordValue(static_cast<TPatternAlphabet>(source(gapsH)[col - 1])) == ordValue(source(gapsV)[row - 1]) ? 0 : 1) == current)
+                traceValue = TraceBitMap_::DIAGONAL;
+            else if (row > 0 && col - row + 1 <= upperDiag && _myersTraceValue(trace, row - 1, col) + 1 == current)
+                traceValue = TraceBitMap_::VERTICAL;
+            else if (col > 0 && col - 1 - row >= lowerDiag && _myersTraceValue(trace, row, col - 1) + 1 == current)
+                traceValue = TraceBitMap_::HORIZONTAL;
+            else
+                return MinValue<int>::VALUE;  // The band is too narrow.
+
+            if (traceValue != runValue)
+            {
+                _recordSegment(traceSegments, col, row, runLength, runValue);
+                runValue = traceValue;
+                runLength = 0;
+            }
+            ++runLength;
+            if (traceValue != TraceBitMap_::VERTICAL)
+                --col;
+            if (traceValue != TraceBitMap_::HORIZONTAL)
+                --row;
+            current = _myersTraceValue(trace, row, col);
+        }
+        _recordSegment(traceSegments, col, row, runLength, runValue);
+    }
+
+    _adaptTraceSegmentsTo(gapsH, gapsV, traceSegments);
+    return -distance;
+}
+
+template <typename TSequenceH, typename TGapsSpecH, typename TSequenceV, typename TGapsSpecV>
+int
+_globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                 Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                 MyersBitVector const & algorithmTag)
+{
+    int lenH = length(source(gapsH));
+    int lenV = length(source(gapsV));
+    return _globalAlignment(gapsH, gapsV, -lenV, lenH, algorithmTag);
+}
+
 }  // namespace seqan
 
 #endif  // #ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_GLOBAL_ALIGNMENT_MYERS_IMPL_H_
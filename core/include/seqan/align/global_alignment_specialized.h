@@ -123,6 +123,27 @@ int globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
     return _globalAlignment(gapsH, gapsV, algorithmTag);
 }
 
+template <typename TSequence, typename TAlignSpec>
+int globalAlignment(Align<TSequence, TAlignSpec> & align,
+                    int lowerDiag,
+                    int upperDiag,
+                    MyersBitVector const & algorithmTag)
+{
+    SEQAN_ASSERT_EQ(length(rows(align)), 2u);
+    return _globalAlignment(row(align, 0), row(align, 1), lowerDiag, upperDiag, algorithmTag);
+}
+
+template <typename TSequenceH, typename TGapsSpecH,
+          typename TSequenceV, typename TGapsSpecV>
+int globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                    Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                    int lowerDiag,
+                    int upperDiag,
+                    MyersBitVector const & algorithmTag)
+{
+    return _globalAlignment(gapsH, gapsV, lowerDiag, upperDiag, algorithmTag);
+}
+
 // ----------------------------------------------------------------------------
 // Function globalAlignmentScore()                                 [Hirschberg]
 // ----------------------------------------------------------------------------
@@ -81,6 +81,12 @@ class Fragment;
 ..signature:globalAlignment(gapsH, gapsV,   scoringScheme, [alignConfig,] [lowerDiag, upperDiag,] [algorithmTag])
 ..signature:globalAlignment(frags, strings, scoringScheme, [alignConfig,] [lowerDiag, upperDiag,] [algorithmTag])
 ..signature:globalAlignment(alignmentGraph, scoringScheme, [alignConfig,] [lowerDiag, upperDiag,] [algorithmTag])
+..signature:globalAlignment(align,          scoringScheme, [alignConfig, [algorithmTag,]] dpContext)
+..signature:globalAlignment(gapsH, gapsV,   scoringScheme, [alignConfig, [algorithmTag,]] dpContext)
+..signature:globalAlignment(align,          [lowerDiag, upperDiag,] MyersBitVector)
+..signature:globalAlignment(gapsH, gapsV,   [lowerDiag, upperDiag,] MyersBitVector)
+..signature:globalAlignment(align,          scoringScheme, BandDoubling)
+..signature:globalAlignment(gapsH, gapsV,   scoringScheme, BandDoubling)
 ..param.align:
 An @Class.Align@ object that stores the alignment.
 The number of rows must be 2 and the sequences must have already been set.
@@ -99,6 +105,10 @@ The sequence with id $0$ is the horizontal one, the sequence with id $1$ is the
 ...remarks:The underlying @Class.StringSet@ must be an @Spec.Owner|Owner StringSet@.
 ..param.strings:A @Class.StringSet@ containing two sequences.
 ...type:Class.StringSet
+..param.stringsH:A @Class.StringSet@ with the horizontal sequences of a batch of pairs.
+...type:Class.StringSet
+..param.stringsV:A @Class.StringSet@ with the vertical sequences of a batch of pairs, of the same length as $stringsH$.
+...type:Class.StringSet
 ..param.scoringScheme:
 The scoring scheme to use for the alignment.
 Note that the user is responsible for ensuring that the scoring scheme is compatible with $algorithmTag$.
@@ -114,6 +124,10 @@ Note that the user is responsible for ensuring that the scoring scheme is compat
 ...type:Tag.Pairwise Global Alignment Algorithms.tag.NeedlemanWunsch
 ...type:Tag.Pairwise Global Alignment Algorithms.tag.Hirschberg
 ...type:Tag.Pairwise Global Alignment Algorithms.tag.MyersHirschberg
+...type:Tag.Pairwise Global Alignment Algorithms.tag.MyersBitVector
+..param.dpContext:Workspace whose buffers are reused for the dynamic programming of repeated calls.
+Only supported by the unbanded $NeedlemanWunsch$ and $Gotoh$ algorithms.
+...type:Class.DPContext
 ..returns:An integer with the alignment score, as given by the @Metafunction.Value@ metafunction of the @Class.Score@ type.
 ..remarks:
 There exist multiple overloads for this function with four configuration dimensions.
@@ -139,6 +153,14 @@ Gotoh's algorithm can handle arbitrary substitution and affine gap scores.
 Needleman-Wunsch is limited to linear gap scores.
 The implementation of Hirschberg's algorithm is further limited that it does not support $alignConfig$ objects or banding.
 The implementation of the Myers-Hirschberg algorithm further limits this to only support edit distance (as scores, matches are scored with 0, mismatches are scored with -1).
+The $MyersBitVector$ variant also computes edit distance alignments.
+It keeps the bit-vectors of all columns and restores the alignment from them, using $O(nm/w)$ memory for a word size $w$ of 64.
+Given a band, only the words covering the band are computed and stored and cells outside of the band are overestimated.
+If the traceback cannot be completed within the band, $MinValue<int>::VALUE$ is returned and the alignment should be repeated with a wider band.
+..remarks:
+With @Tag.BandDoubling@ instead of a band, a banded alignment without free end gaps is computed with a band of 16 diagonals around the diagonals of both matrix ends.
+The band width is doubled until the score reaches an upper bound for all alignments leaving the band, so the result is optimal at the cost of the final band for similar sequences.
+The bound is only used if a gap open score is not above the gap extension score and two gap extensions do not score better than the best aligned pair; otherwise the full matrix is computed.
 ..remarks:
 The examples below show some common use cases.
 ..example.text:Global alignment of two sequences using an @Class.Align@ object and the Needleman-Wunsch algorithm.
@@ -316,6 +338,114 @@ TScoreValue globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
     return globalAlignment(gapsH, gapsV, scoringScheme, alignConfig);
 }
 
+// ----------------------------------------------------------------------------
+// Function globalAlignment()                     [unbanded, Align, DPContext]
+// ----------------------------------------------------------------------------
+
+template <typename TSequence, typename TAlignSpec,
+          typename TScoreValue, typename TScoreSpec,
+          bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec,
+          typename TAlgoTag>
+TScoreValue globalAlignment(Align<TSequence, TAlignSpec> & align,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & alignConfig,
+                            TAlgoTag const & algoTag,
+                            DPContext<TScoreValue> & dpContext)
+{
+    typedef typename DPContext<TScoreValue>::TTraceSegment TTraceSegment;
+
+    String<TTraceSegment> & trace = _dpTraceSegments(dpContext);
+    TScoreValue res = _setUpAndRunAlignment(dpContext, trace, source(row(align, 0)), source(row(align, 1)),
+                                            scoringScheme, alignConfig, algoTag, GapsLeft());
+    _adaptTraceSegmentsTo(row(align, 0), row(align, 1), trace);
+    return res;
+}
+
+// Interface without algorithm tag.
+
+template <typename TSequence, typename TAlignSpec,
+          typename TScoreValue, typename TScoreSpec,
+          bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec>
+TScoreValue globalAlignment(Align<TSequence, TAlignSpec> & align,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & alignConfig,
+                            DPContext<TScoreValue> & dpContext)
+{
+    if (scoreGapOpen(scoringScheme) == scoreGapExtend(scoringScheme))
+        return globalAlignment(align, scoringScheme, alignConfig, NeedlemanWunsch(), dpContext);
+    else
+        return globalAlignment(align, scoringScheme, alignConfig, Gotoh(), dpContext);
+}
+
+// Interface without AlignConfig<> and algorithm tag.
+
+template <typename TSequence, typename TAlignSpec,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue globalAlignment(Align<TSequence, TAlignSpec> & align,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            DPContext<TScoreValue> & dpContext)
+{
+    AlignConfig<> alignConfig;
+    return globalAlignment(align, scoringScheme, alignConfig, dpContext);
+}
+
+// ----------------------------------------------------------------------------
+// Function globalAlignment()                      [unbanded, Gaps, DPContext]
+// ----------------------------------------------------------------------------
+
+template <typename TSequenceH, typename TGapsSpecH,
+          typename TSequenceV, typename TGapsSpecV,
+          typename TScoreValue, typename TScoreSpec,
+          bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec,
+          typename TAlgoTag>
+TScoreValue globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                            Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & alignConfig,
+                            TAlgoTag const & algoTag,
+                            DPContext<TScoreValue> & dpContext)
+{
+    typedef typename DPContext<TScoreValue>::TTraceSegment TTraceSegment;
+
+    String<TTraceSegment> & traceSegments = _dpTraceSegments(dpContext);
+    TScoreValue res = _setUpAndRunAlignment(dpContext, traceSegments, source(gapsH), source(gapsV), scoringScheme,
+                                            alignConfig, algoTag, GapsLeft());
+    _adaptTraceSegmentsTo(gapsH, gapsV, traceSegments);
+    return res;
+}
+
+// Interface without algorithm tag.
+
+template <typename TSequenceH, typename TGapsSpecH,
+          typename TSequenceV, typename TGapsSpecV,
+          typename TScoreValue, typename TScoreSpec,
+          bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec>
+TScoreValue globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                            Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & alignConfig,
+                            DPContext<TScoreValue> & dpContext)
+{
+    if (scoreGapOpen(scoringScheme) == scoreGapExtend(scoringScheme))
+        return globalAlignment(gapsH, gapsV, scoringScheme, alignConfig, NeedlemanWunsch(), dpContext);
+    else
+        return globalAlignment(gapsH, gapsV, scoringScheme, alignConfig, Gotoh(), dpContext);
+}
+
+// Interface without AlignConfig<> and algorithm tag.
+
+template <typename TSequenceH, typename TGapsSpecH,
+          typename TSequenceV, typename TGapsSpecV,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue globalAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                            Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                            Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                            DPContext<TScoreValue> & dpContext)
+{
+    AlignConfig<> alignConfig;
+    return globalAlignment(gapsH, gapsV, scoringScheme, alignConfig, dpContext);
+}
+
 // ----------------------------------------------------------------------------
 // Function globalAlignment()                   [unbanded, Graph<Alignment<> >]
 // ----------------------------------------------------------------------------
@@ -470,6 +600,9 @@ TScoreValue globalAlignment(String<Fragment<TSize, TFragmentSpec>, TStringSpec>
 ..signature:globalAlignmentScore(strings,    scoringScheme, [alignConfig,] [lowerDiag, upperDiag,] [algorithmTag])
 ..signature:globalAlignmentScore(seqH, seqV, {MyersBitVector | MyersHirschberg})
 ..signature:globalAlignmentScore(strings,    {MyersBitVector | MyersHirschberg})
+..signature:globalAlignmentScore(stringsH, stringsV, scoringScheme, [alignConfig])
+..signature:globalAlignmentScore(seqH, seqV, scoringScheme, [alignConfig, algorithmTag,] dpContext)
+..signature:globalAlignmentScore(seqH, seqV, scoringScheme, BandDoubling)
 ..param.seqH:Horizontal gapped sequence in alignment matrix.
 ...type:Class.String
 ..param.seqV:Vertical gapped sequence in alignment matrix.
@@ -492,13 +625,20 @@ Note that the user is responsible for ensuring that the scoring scheme is compat
 ...type:Tag.Pairwise Global Alignment Algorithms.tag.Hirschberg
 ...type:Tag.Pairwise Global Alignment Algorithms.tag.MyersHirschberg
 ...type:Tag.Pairwise Global Alignment Algorithms.tag.MyersBitVector
+..param.dpContext:Workspace whose buffers are reused for the dynamic programming of repeated calls.
+...type:Class.DPContext
 ..returns:An integer with the alignment score, as given by the @Metafunction.Value@ metafunction of the @Class.Score@ type.
 ..remarks:
 This function does not perform the (linear time) traceback step after the (mostly quadratic time) dynamic programming step.
-Note that Myers' bit-vector algorithm does not compute an alignment (only in the Myers-Hirschberg variant) but scores can be computed using $globalAlignmentScore$.
+Use @Function.globalAlignment@ with $MyersBitVector$ or $MyersHirschberg$ to compute the alignment itself.
 ..remarks:
 The same limitations to algorithms as in @Function.globalAlignment@ apply.
 Furthermore, the $MyersBitVector$ and $MyersHirschberg$ variants can only be used without any other parameter.
+The band of the @Tag.BandDoubling@ variant is widened as described in @Function.globalAlignment@.
+..remarks:
+Given two @Class.StringSet|StringSets@ $stringsH$ and $stringsV$, the pairs $(stringsH[i], stringsV[i])$ are aligned and a @Class.String@ with one score per pair is returned.
+The pairs are computed in batches with one pair per lane of a SIMD register (8 bit, 16 bit or 32 bit lanes depending on the sequence lengths and scores), and the batches are distributed over all OpenMP threads.
+Vector instructions are used if SeqAn is compiled with SSE2 (16 bit lanes), SSE4.1 or AVX2 support; otherwise the batches are computed with scalar instructions.
 ..see:Function.globalAlignment
 ..wiki:Tutorial/PairwiseSequenceAlignment
 */
@@ -518,6 +658,13 @@ TScoreValue globalAlignmentScore(String<TAlphabetH, TSpecH> const & seqH,
                                  AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & alignConfig,
                                  TAlgoTag const & algoTag)
 {
+    // Very large matrices are computed in parallel tiles along the anti-diagonals.
+    if (_dpWavefrontEnabled() && _dpWavefrontSupports(scoringScheme, algoTag))
+    {
+        size_t tileSize = _dpWavefrontTileSize(length(seqV), length(seqH));
+        if (tileSize != 0)
+            return _globalAlignmentScoreWavefront(seqH, seqV, scoringScheme, alignConfig, tileSize);
+    }
     return _setUpAndRunAlignment(seqH, seqV, scoringScheme, alignConfig, algoTag);
 }
 
@@ -566,6 +713,42 @@ TScoreValue globalAlignmentScore(String<TAlphabetH, TSpecH> const & seqH,
     return globalAlignmentScore(seqH, seqV, scoringScheme, alignConfig);
 }
 
+// ----------------------------------------------------------------------------
+// Function globalAlignmentScore()             [unbanded, 2 Strings, DPContext]
+// ----------------------------------------------------------------------------
+
+template <typename TAlphabetH, typename TSpecH,
+          typename TAlphabetV, typename TSpecV,
+          typename TScoreValue, typename TScoreSpec,
+          bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec,
+          typename TAlgoTag>
+TScoreValue globalAlignmentScore(String<TAlphabetH, TSpecH> const & seqH,
+                                 String<TAlphabetV, TSpecV> const & seqV,
+                                 Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                 AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & alignConfig,
+                                 TAlgoTag const & algoTag,
+                                 DPContext<TScoreValue> & dpContext)
+{
+    return _setUpAndRunAlignment(dpContext, seqH, seqV, scoringScheme, alignConfig, algoTag);
+}
+
+// Interface without AlignConfig<> and algorithm tag.
+
+template <typename TAlphabetH, typename TSpecH,
+          typename TAlphabetV, typename TSpecV,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue globalAlignmentScore(String<TAlphabetH, TSpecH> const & seqH,
+                                 String<TAlphabetV, TSpecV> const & seqV,
+                                 Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                 DPContext<TScoreValue> & dpContext)
+{
+    AlignConfig<> alignConfig;
+    if (scoreGapOpen(scoringScheme) == scoreGapExtend(scoringScheme))
+        return globalAlignmentScore(seqH, seqV, scoringScheme, alignConfig, NeedlemanWunsch(), dpContext);
+    else
+        return globalAlignmentScore(seqH, seqV, scoringScheme, alignConfig, Gotoh(), dpContext);
+}
+
 // ----------------------------------------------------------------------------
 // Function globalAlignmentScore()                        [unbanded, StringSet]
 // ----------------------------------------------------------------------------
@@ -628,6 +811,37 @@ TScoreValue globalAlignmentScore(StringSet<TString, TSpec> const & strings,
     return globalAlignmentScore(strings[0], strings[1], scoringScheme, alignConfig);
 }
 
+// ----------------------------------------------------------------------------
+// Function globalAlignmentScore()                      [unbanded, batch of pairs]
+// ----------------------------------------------------------------------------
+
+template <typename TStringH, typename TSpecH,
+          typename TStringV, typename TSpecV,
+          typename TScoreValue, typename TScoreSpec,
+          bool TOP, bool LEFT, bool RIGHT, bool BOTTOM, typename TACSpec>
+String<TScoreValue> globalAlignmentScore(StringSet<TStringH, TSpecH> const & stringsH,
+                                         StringSet<TStringV, TSpecV> const & stringsV,
+                                         Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                                         AlignConfig<TOP, LEFT, RIGHT, BOTTOM, TACSpec> const & alignConfig)
+{
+    String<TScoreValue> scores;
+    _computeBatchScores(scores, stringsH, stringsV, scoringScheme, alignConfig, Tag<GlobalAlignment_<> >());
+    return scores;
+}
+
+// Interface without AlignConfig<>.
+
+template <typename TStringH, typename TSpecH,
+          typename TStringV, typename TSpecV,
+          typename TScoreValue, typename TScoreSpec>
+String<TScoreValue> globalAlignmentScore(StringSet<TStringH, TSpecH> const & stringsH,
+                                         StringSet<TStringV, TSpecV> const & stringsV,
+                                         Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    AlignConfig<> alignConfig;
+    return globalAlignmentScore(stringsH, stringsV, scoringScheme, alignConfig);
+}
+
 }  // namespace seqan
 
 #endif  // #ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_GLOBAL_ALIGNMENT_UNBANDED_H_
@@ -0,0 +1,762 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Striped Smith-Waterman (Farrar, 2007) for aligning one query against many
+// database sequences.
+//
+// The query is the vertical sequence.  Its rows are distributed over the
+// lanes of a SSE2 register in a striped layout: lane l of segment j holds
+// row l * segLength + j.  A query profile stores the substitution scores of
+// each alphabet character against all rows in this layout, so a column of
+// the matrix needs one profile lookup per segment instead of one matrix
+// lookup per cell.  The vertical gaps crossing segment boundaries are fixed
+// up by the lazy-F loop.
+//
+// Scores are first computed with 16 unsigned biased 8 bit lanes.  If the
+// score could have saturated, the column scan is repeated with 8 signed
+// 16 bit lanes and, if that overflows as well, with the generic dynamic
+// programming.  Only the score and the end position are computed by the
+// striped kernels; the traceback runs the generic Smith-Waterman on the
+// prefixes ending in that position and is only done on request.
+//
+// For screening a database, the kernels take a score threshold and stop as
+// soon as it is reached or cannot be reached by the remaining columns.
+// ==========================================================================
+
+#ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_LOCAL_ALIGNMENT_STRIPED_H_
+#define SEQAN_CORE_INCLUDE_SEQAN_ALIGN_LOCAL_ALIGNMENT_STRIPED_H_
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif  // #if defined(__SSE2__)
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class StripedQueryProfile
+// ----------------------------------------------------------------------------
+
+/**
+.Class.StripedQueryProfile
+..summary:Query profile for the striped Smith-Waterman algorithm.
+..cat:Alignments
+..signature:StripedQueryProfile<TSequence, TScore>
+..param.TSequence:The type of the query sequence.
+...type:Class.String
+..param.TScore:The type of the scoring scheme.
+...type:Class.Score
+..remarks:
+The profile is built once per query and then used to align the query against many database sequences with @Function.localAlignmentScore@ and @Function.localAlignment@.
+The query is the vertical sequence in the alignment matrix.
+..remarks:
+If SeqAn is compiled with SSE2 support (the default on x86-64), the alignment scores are computed with 16 lanes of 8 bits and, if the scores get too large, with 8 lanes of 16 bits.
+Otherwise, the generic Smith-Waterman implementation is used.
+..example.code:
+Peptide query = "MKVLAAGIVALLLAAG";
+StringSet<Peptide> database;
+// ...
+StripedQueryProfile<Peptide, Blosum62> profile(query, Blosum62(-1, -11));
+for (unsigned i = 0; i < length(database); ++i)
+    std::cout << localAlignmentScore(database[i], profile) << std::endl;
+..include:seqan/align.h
+*/
+
+/**
+.Memfunc.StripedQueryProfile#StripedQueryProfile
+..class:Class.StripedQueryProfile
+..summary:Constructor
+..signature:StripedQueryProfile()
+..signature:StripedQueryProfile(query, scoringScheme)
+..param.query:The query sequence.
+..param.scoringScheme:The scoring scheme to use.
+...remarks:Gap scores must not be positive.
+*/
+
+template <typename TSequence, typename TScore>
+class StripedQueryProfile
+{
+public:
+    Holder<TSequence> data_host;
+    TScore data_scoringScheme;
+
+    // Gap costs, i.e. the negated gap scores.
+    int data_gapOpen;
+    int data_gapExtend;
+    int data_maxScore;
+
+    // Added to all 8 bit scores so they are not negative.
+    int data_bias;
+    bool data_use8Bit;
+
+    unsigned data_segLength8;
+    unsigned data_segLength16;
+    String<unsigned char> data_profile8;
+    String<__int16> data_profile16;
+
+    StripedQueryProfile() :
+        data_gapOpen(0), data_gapExtend(0), data_maxScore(0), data_bias(0), data_use8Bit(false),
+        data_segLength8(0), data_segLength16(0)
+    {}
+
+    StripedQueryProfile(TSequence const & query, TScore const & scoringScheme) :
+        data_scoringScheme(scoringScheme)
+    {
+        setHost(*this, query);
+    }
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Function host()
+// ----------------------------------------------------------------------------
+
+/**
+.Function.StripedQueryProfile#host
+..class:Class.StripedQueryProfile
+..summary:Returns the query sequence of the profile.
+..cat:Alignments
+..signature:host(profile)
+..param.profile:
+...type:Class.StripedQueryProfile
+..returns:The query sequence.
+..include:seqan/align.h
+*/
+
+template <typename TSequence, typename TScore>
+inline TSequence &
+host(StripedQueryProfile<TSequence, TScore> & profile)
+{
+    return value(profile.data_host);
+}
+
+template <typename TSequence, typename TScore>
+inline TSequence const &
+host(StripedQueryProfile<TSequence, TScore> const & profile)
+{
+    return value(profile.data_host);
+}
+
+// ----------------------------------------------------------------------------
+// Function setHost()
+// ----------------------------------------------------------------------------
+
+/**
+.Function.StripedQueryProfile#setHost
+..class:Class.StripedQueryProfile
+..summary:Sets the query sequence and builds the profile.
+..cat:Alignments
+..signature:setHost(profile, query)
+..param.profile:
+...type:Class.StripedQueryProfile
+..param.query:The new query sequence.
+..include:seqan/align.h
+*/
+
+template <typename TSequence, typename TScore>
+inline void
+setHost(StripedQueryProfile<TSequence, TScore> & profile, TSequence const & query)
+{
+    typedef typename Value<TSequence>::Type TValue;
+
+    profile.data_host = query;
+
+    TScore const & scoringScheme = profile.data_scoringScheme;
+    SEQAN_ASSERT_LEQ(scoreGapOpen(scoringScheme), 0);
+    SEQAN_ASSERT_LEQ(scoreGapExtend(scoringScheme), 0);
+    profile.data_gapOpen = -static_cast<int>(scoreGapOpen(scoringScheme));
+    profile.data_gapExtend = -static_cast<int>(scoreGapExtend(scoringScheme));
+
+    int minScore = MaxValue<int>::VALUE;
+    int maxScore = MinValue<int>::VALUE;
+    for (unsigned i = 0; i < ValueSize<TValue>::VALUE; ++i)
+        for (unsigned j = 0; j < ValueSize<TValue>::VALUE; ++j)
+        {
+            int value = static_cast<int>(score(scoringScheme, TValue(i), TValue(j)));
+            minScore = _min(minScore, value);
+            maxScore = _max(maxScore, value);
+        }
+    profile.data_maxScore = maxScore;
+    profile.data_bias = (minScore < 0) ? -minScore : 0;
+    profile.data_use8Bit = (profile.data_bias + maxScore < 255 && profile.data_gapOpen < 256 &&
+                            profile.data_gapExtend < 256);
+
+    // Rows behind the end of the query get the lowest score, they never
+    // exceed the scores of the real rows.
+    unsigned lengthV = length(query);
+    profile.data_segLength8 = (lengthV + 15) / 16;
+    profile.data_segLength16 = (lengthV + 7) / 8;
+    resize(profile.data_profile8, ValueSize<TValue>::VALUE * profile.data_segLength8 * 16, 0, Exact());
+    resize(profile.data_profile16, ValueSize<TValue>::VALUE * profile.data_segLength16 * 8,
+           static_cast<__int16>(-profile.data_bias), Exact());
+
+    for (unsigned c = 0; c < ValueSize<TValue>::VALUE; ++c)
+        for (unsigned row = 0; row < lengthV; ++row)
+        {
+            int value = static_cast<int>(score(scoringScheme, TValue(c), query[row]));
+            if (profile.data_use8Bit)
+                profile.data_profile8[(c * profile.data_segLength8 + row % profile.data_segLength8) * 16 +
+                                      row / profile.data_segLength8] =
+                    static_cast<unsigned char>(value + profile.data_bias);
+            profile.data_profile16[(c * profile.data_segLength16 + row % profile.data_segLength16) * 8 +
+                                   row / profile.data_segLength16] = static_cast<__int16>(value);
+        }
+}
+
+// ----------------------------------------------------------------------------
+// Function _stripedThresholdUnreachable()
+// ----------------------------------------------------------------------------
+
+// Returns true if the given number of columns cannot add up to threshold.  An
+// alignment gains at most the best substitution score per column, so after a
+// column with the maximal value columnMax, no alignment reaches the threshold
+// if threshold - columnMax is unreachable.  The threshold MaxValue<int> is used
+// without screening and is never considered unreachable.
+
+template <typename TSequence, typename TScore>
+inline bool
+_stripedThresholdUnreachable(int threshold,
+                             StripedQueryProfile<TSequence, TScore> const & profile,
+                             unsigned columns)
+{
+    if (threshold == MaxValue<int>::VALUE)
+        return false;
+    return static_cast<__int64>(_max(profile.data_maxScore, 0)) * columns < threshold;
+}
+
+#if defined(__SSE2__)
+
+// ----------------------------------------------------------------------------
+// Function _stripedLocalScore8()
+// ----------------------------------------------------------------------------
+
+// Computes the score with unsigned 8 bit lanes.  Every value is biased by the
+// profile, saturation at 0 gives the local alignment floor.  Returns false if
+// the score may have saturated at 255.
+
+template <typename TScoreValue, typename TPosition, typename TSequenceH, typename TSequence, typename TScore>
+inline bool
+_stripedLocalScore8(TScoreValue & bestScore,
+                    TPosition & endH,
+                    TPosition & endV,
+                    TSequenceH const & seqH,
+                    StripedQueryProfile<TSequence, TScore> const & profile,
+                    int threshold)
+{
+    typedef typename Value<TSequence>::Type TValue;
+    typedef typename Iterator<TSequenceH const, Standard>::Type TIterator;
+
+    unsigned const segLength = profile.data_segLength8;
+    unsigned const lengthV = length(host(profile));
+    unsigned const lengthH = length(seqH);
+    int const overflowScore = 255 - profile.data_bias - profile.data_maxScore;
+
+    __m128i const vZero = _mm_setzero_si128();
+    __m128i const vBias = _mm_set1_epi8(static_cast<char>(profile.data_bias));
+    __m128i const vGapOpen = _mm_set1_epi8(static_cast<char>(profile.data_gapOpen));
+    __m128i const vGapExtend = _mm_set1_epi8(static_cast<char>(profile.data_gapExtend));
+
+    String<unsigned char> buffer;
+    resize(buffer, 3 * segLength * 16, 0, Exact());
+    unsigned char * hStore = begin(buffer, Standard());
+    unsigned char * hLoad = hStore + segLength * 16;
+    unsigned char * eColumn = hLoad + segLength * 16;
+    unsigned char laneValues[16];
+
+    int best = 0;
+    __m128i vBest = vZero;
+    TPosition col = 0;
+    for (TIterator it = begin(seqH, Standard()); it != end(seqH, Standard()); ++it, ++col)
+    {
+        unsigned char const * prof = begin(profile.data_profile8, Standard()) +
+                                     ordValue(TValue(*it)) * segLength * 16;
+
+        // The diagonal value of the first segment comes from the last segment
+        // of the previous column, shifted by one lane.
+        __m128i vF = vZero;
+        __m128i vMaxColumn = vZero;
+        __m128i vH = _mm_slli_si128(_mm_loadu_si128(reinterpret_cast<__m128i const *>(hStore + (segLength - 1) * 16)), 1);
+        unsigned char * tmp = hLoad;
+        hLoad = hStore;
+        hStore = tmp;
+
+        for (unsigned j = 0; j < segLength; ++j)
+        {
+            vH = _mm_adds_epu8(vH, _mm_loadu_si128(reinterpret_cast<__m128i const *>(prof + j * 16)));
+            vH = _mm_subs_epu8(vH, vBias);
+            __m128i vE = _mm_loadu_si128(reinterpret_cast<__m128i const *>(eColumn + j * 16));
+            vH = _mm_max_epu8(vH, vE);
+            vH = _mm_max_epu8(vH, vF);
+            vMaxColumn = _mm_max_epu8(vMaxColumn, vH);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(hStore + j * 16), vH);
+
+            vH = _mm_subs_epu8(vH, vGapOpen);
+            vE = _mm_max_epu8(_mm_subs_epu8(vE, vGapExtend), vH);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(eColumn + j * 16), vE);
+            vF = _mm_max_epu8(_mm_subs_epu8(vF, vGapExtend), vH);
+
+            vH = _mm_loadu_si128(reinterpret_cast<__m128i const *>(hLoad + j * 16));
+        }
+
+        // Lazy-F loop: propagate vertical gaps over the segment boundaries
+        // until they cannot improve any cell anymore.
+        vF = _mm_slli_si128(vF, 1);
+        for (unsigned j = 0; ; )
+        {
+            vH = _mm_loadu_si128(reinterpret_cast<__m128i const *>(hStore + j * 16));
+            __m128i vTemp = _mm_subs_epu8(vF, _mm_subs_epu8(vH, vGapOpen));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(vTemp, vZero)) == 0xffff)
+                break;
+
+            vH = _mm_max_epu8(vH, vF);
+            vMaxColumn = _mm_max_epu8(vMaxColumn, vH);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(hStore + j * 16), vH);
+            __m128i vE = _mm_loadu_si128(reinterpret_cast<__m128i const *>(eColumn + j * 16));
+            vE = _mm_max_epu8(vE, _mm_subs_epu8(vH, vGapOpen));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(eColumn + j * 16), vE);
+
+            vF = _mm_subs_epu8(vF, vGapExtend);
+            if (++j == segLength)
+            {
+                j = 0;
+                vF = _mm_slli_si128(vF, 1);
+            }
+        }
+
+        // Locate the first row with a new best score.
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(vMaxColumn, vBest), vZero)) != 0xffff)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(laneValues), vMaxColumn);
+            int columnMax = 0;
+            for (unsigned lane = 0; lane < 16; ++lane)
+                columnMax = _max(columnMax, static_cast<int>(laneValues[lane]));
+            for (unsigned row = 0; row < lengthV; ++row)
+                if (hStore[(row % segLength) * 16 + row / segLength] == columnMax)
+                {
+                    best = columnMax;
+                    endH = col + 1;
+                    endV = row + 1;
+                    break;
+                }
+            if (best >= threshold)
+                break;
+            if (best >= overflowScore)
+                return false;
+            vBest = _mm_set1_epi8(static_cast<char>(best));
+        }
+
+        if (_stripedThresholdUnreachable(threshold, profile, lengthH - col - 1))
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(laneValues), vMaxColumn);
+            int columnMax = 0;
+            for (unsigned lane = 0; lane < 16; ++lane)
+                columnMax = _max(columnMax, static_cast<int>(laneValues[lane]));
+            if (_stripedThresholdUnreachable(threshold - columnMax, profile, lengthH - col - 1))
+                break;
+        }
+    }
+
+    bestScore = best;
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function _stripedLocalScore16()
+// ----------------------------------------------------------------------------
+
+// Computes the score with signed 16 bit lanes.  Returns false if the score
+// may have saturated.
+
+template <typename TScoreValue, typename TPosition, typename TSequenceH, typename TSequence, typename TScore>
+inline bool
+_stripedLocalScore16(TScoreValue & bestScore,
+                     TPosition & endH,
+                     TPosition & endV,
+                     TSequenceH const & seqH,
+                     StripedQueryProfile<TSequence, TScore> const & profile,
+                     int threshold)
+{
+    typedef typename Value<TSequence>::Type TValue;
+    typedef typename Iterator<TSequenceH const, Standard>::Type TIterator;
+
+    unsigned const segLength = profile.data_segLength16;
+    unsigned const lengthV = length(host(profile));
+    unsigned const lengthH = length(seqH);
+    int const overflowScore = MaxValue<__int16>::VALUE - profile.data_maxScore;
+
+    __m128i const vZero = _mm_setzero_si128();
+    __m128i const vGapOpen = _mm_set1_epi16(static_cast<short>(_min(profile.data_gapOpen, 32767)));
+    __m128i const vGapExtend = _mm_set1_epi16(static_cast<short>(_min(profile.data_gapExtend, 32767)));
+
+    String<__int16> buffer;
+    resize(buffer, 3 * segLength * 8, 0, Exact());
+    __int16 * hStore = begin(buffer, Standard());
+    __int16 * hLoad = hStore + segLength * 8;
+    __int16 * eColumn = hLoad + segLength * 8;
+    __int16 laneValues[8];
+
+    int best = 0;
+    __m128i vBest = vZero;
+    TPosition col = 0;
+    for (TIterator it = begin(seqH, Standard()); it != end(seqH, Standard()); ++it, ++col)
+    {
+        __int16 const * prof = begin(profile.data_profile16, Standard()) + ordValue(TValue(*it)) * segLength * 8;
+
+        __m128i vF = vZero;
+        __m128i vMaxColumn = vZero;
+        __m128i vH = _mm_slli_si128(_mm_loadu_si128(reinterpret_cast<__m128i const *>(hStore + (segLength - 1) * 8)), 2);
+        __int16 * tmp = hLoad;
+        hLoad = hStore;
+        hStore = tmp;
+
+        for (unsigned j = 0; j < segLength; ++j)
+        {
+            vH = _mm_adds_epi16(vH, _mm_loadu_si128(reinterpret_cast<__m128i const *>(prof + j * 8)));
+            __m128i vE = _mm_loadu_si128(reinterpret_cast<__m128i const *>(eColumn + j * 8));
+            vH = _mm_max_epi16(vH, vE);
+            vH = _mm_max_epi16(vH, vF);
+            vH = _mm_max_epi16(vH, vZero);
+            vMaxColumn = _mm_max_epi16(vMaxColumn, vH);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(hStore + j * 8), vH);
+
+            vH = _mm_subs_epi16(vH, vGapOpen);
+            vE = _mm_max_epi16(_mm_subs_epi16(vE, vGapExtend), vH);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(eColumn + j * 8), vE);
+            vF = _mm_max_epi16(_mm_subs_epi16(vF, vGapExtend), vH);
+
+            vH = _mm_loadu_si128(reinterpret_cast<__m128i const *>(hLoad + j * 8));
+        }
+
+        // Lazy-F loop.  Values of vF below zero cannot improve any cell, so the
+        // comparison is against the clamped gap open value.
+        vF = _mm_slli_si128(vF, 2);
+        for (unsigned j = 0; ; )
+        {
+            vH = _mm_loadu_si128(reinterpret_cast<__m128i const *>(hStore + j * 8));
+            __m128i vTemp = _mm_max_epi16(_mm_subs_epi16(vH, vGapOpen), vZero);
+            if (_mm_movemask_epi8(_mm_cmpgt_epi16(vF, vTemp)) == 0)
+                break;
+
+            vH = _mm_max_epi16(vH, vF);
+            vMaxColumn = _mm_max_epi16(vMaxColumn, vH);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(hStore + j * 8), vH);
+            __m128i vE = _mm_loadu_si128(reinterpret_cast<__m128i const *>(eColumn + j * 8));
+            vE = _mm_max_epi16(vE, _mm_subs_epi16(vH, vGapOpen));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(eColumn + j * 8), vE);
+
+            vF = _mm_subs_epi16(vF, vGapExtend);
+            if (++j == segLength)
+            {
+                j = 0;
+                vF = _mm_slli_si128(vF, 2);
+            }
+        }
+
+        if (_mm_movemask_epi8(_mm_cmpgt_epi16(vMaxColumn, vBest)) != 0)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(laneValues), vMaxColumn);
+            int columnMax = 0;
+            for (unsigned lane = 0; lane < 8; ++lane)
+                columnMax = _max(columnMax, static_cast<int>(laneValues[lane]));
+            for (unsigned row = 0; row < lengthV; ++row)
+                if (hStore[(row % segLength) * 8 + row / segLength] == columnMax)
+                {
+                    best = columnMax;
+                    endH = col + 1;
+                    endV = row + 1;
+                    break;
+                }
+            if (best >= threshold)
+                break;
+            if (best >= overflowScore)
+                return false;
+            vBest = _mm_set1_epi16(static_cast<short>(best));
+        }
+
+        if (_stripedThresholdUnreachable(threshold, profile, lengthH - col - 1))
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(laneValues), vMaxColumn);
+            int columnMax = 0;
+            for (unsigned lane = 0; lane < 8; ++lane)
+                columnMax = _max(columnMax, static_cast<int>(laneValues[lane]));
+            if (_stripedThresholdUnreachable(threshold - columnMax, profile, lengthH - col - 1))
+                break;
+        }
+    }
+
+    bestScore = best;
+    return true;
+}
+
+#endif  // #if defined(__SSE2__)
+
+// ----------------------------------------------------------------------------
+// Function _stripedLocalScore()
+// ----------------------------------------------------------------------------
+
+// Computes the best local score and the end position of a best alignment in
+// the horizontal and vertical sequence.  Returns false if the striped kernels
+// are not available or overflow.  With a threshold, the scan stops early and
+// the score only tells whether the best local score reaches the threshold.
+
+template <typename TScoreValue, typename TPosition, typename TSequenceH, typename TSequence, typename TScore>
+inline bool
+_stripedLocalScore(TScoreValue & bestScore,
+                   TPosition & endH,
+                   TPosition & endV,
+                   TSequenceH const & seqH,
+                   StripedQueryProfile<TSequence, TScore> const & profile,
+                   int threshold)
+{
+    endH = 0;
+    endV = 0;
+    bestScore = 0;
+    if (empty(seqH) || empty(host(profile)))
+        return true;
+
+#if defined(__SSE2__)
+    if (profile.data_use8Bit && _stripedLocalScore8(bestScore, endH, endV, seqH, profile, threshold))
+        return true;
+    return _stripedLocalScore16(bestScore, endH, endV, seqH, profile, threshold);
+#else
+    (void)threshold;
+    return false;
+#endif  // #if defined(__SSE2__)
+}
+
+template <typename TScoreValue, typename TPosition, typename TSequenceH, typename TSequence, typename TScore>
+inline bool
+_stripedLocalScore(TScoreValue & bestScore,
+                   TPosition & endH,
+                   TPosition & endV,
+                   TSequenceH const & seqH,
+                   StripedQueryProfile<TSequence, TScore> const & profile)
+{
+    return _stripedLocalScore(bestScore, endH, endV, seqH, profile, MaxValue<int>::VALUE);
+}
+
+// ----------------------------------------------------------------------------
+// Function localAlignmentScore()                          [StripedQueryProfile]
+// ----------------------------------------------------------------------------
+
+/**
+.Function.localAlignmentScore
+..signature:localAlignmentScore(seqH, profile)
+..param.seqH:The horizontal (database) sequence.
+...type:Class.String
+..param.profile:The profile of the vertical (query) sequence.
+...type:Class.StripedQueryProfile
+..returns:The Smith-Waterman score of $seqH$ and the query of $profile$ if called with a @Class.StripedQueryProfile@.
+*/
+
+template <typename TSequenceH, typename TSequence, typename TScore>
+typename Value<TScore>::Type
+localAlignmentScore(TSequenceH const & seqH,
+                    StripedQueryProfile<TSequence, TScore> const & profile)
+{
+    typedef typename Value<TScore>::Type TScoreValue;
+    typedef typename Position<TSequenceH>::Type TPosition;
+
+    TScoreValue score = 0;
+    TPosition endH = 0;
+    TPosition endV = 0;
+    if (_stripedLocalScore(score, endH, endV, seqH, profile))
+        return score;
+
+    return _setUpAndRunAlignment(seqH, host(profile), profile.data_scoringScheme, AlignConfig<>(), SmithWaterman());
+}
+
+// ----------------------------------------------------------------------------
+// Function localAlignmentScan()                           [StripedQueryProfile]
+// ----------------------------------------------------------------------------
+
+/**
+.Function.localAlignmentScan
+..summary:Screens a database for sequences with a local alignment score of at least a threshold.
+..cat:Alignments
+..signature:localAlignmentScan(hits, database, profile, threshold)
+..param.hits:A @Class.String@ to append the positions of the qualifying database sequences to.
+...type:Class.String
+..param.database:The database sequences, aligned as horizontal sequences.
+...type:Class.StringSet
+..param.profile:The profile of the vertical (query) sequence.
+...type:Class.StripedQueryProfile
+..param.threshold:The minimal local alignment score of a hit.
+...type:nolink:$int$
+..returns:The number of hits appended to $hits$.
+..remarks:
+Only the score is computed, keeping one column of the dynamic programming matrix.
+The alignment of a database sequence is stopped as soon as the threshold is reached or cannot be reached anymore, i.e. if the best score in the current column plus the best substitution score for each remaining column is below the threshold.
+The alignments of the hits can be computed afterwards with @Function.localAlignment@ and the same profile.
+..remarks:
+The database sequences are distributed over all OpenMP threads; the hits are appended in increasing order.
+If the striped kernels are not available or overflow, the full Smith-Waterman score is computed for a sequence.
+..example.code:
+String<unsigned> hits;
+localAlignmentScan(hits, database, profile, 50);
+for (unsigned i = 0; i < length(hits); ++i)
+{
+    Align<Peptide> align;
+    resize(rows(align), 2);
+    assignSource(row(align, 0), database[hits[i]]);
+    assignSource(row(align, 1), host(profile));
+    localAlignment(align, profile);
+}
+..see:Function.localAlignmentScore
+..include:seqan/align.h
+*/
+
+template <typename TSequenceH, typename TSequence, typename TScore>
+inline bool
+_localAlignmentScanHit(TSequenceH const & seqH,
+                       StripedQueryProfile<TSequence, TScore> const & profile,
+                       int threshold)
+{
+    typedef typename Value<TScore>::Type TScoreValue;
+    typedef typename Position<TSequenceH>::Type TPosition;
+
+    // Local alignments score at least 0.
+    if (threshold <= 0)
+        return true;
+
+    TScoreValue score = 0;
+    TPosition endH = 0;
+    TPosition endV = 0;
+    if (_stripedLocalScore(score, endH, endV, seqH, profile, threshold))
+        return score >= threshold;
+
+    return _setUpAndRunAlignment(seqH, host(profile), profile.data_scoringScheme, AlignConfig<>(),
+                                 SmithWaterman()) >= threshold;
+}
+
+template <typename TPosition, typename TSpec, typename TStringSet, typename TSequence, typename TScore>
+typename Size<TStringSet>::Type
+localAlignmentScan(String<TPosition, TSpec> & hits,
+                   TStringSet const & database,
+                   StripedQueryProfile<TSequence, TScore> const & profile,
+                   int threshold)
+{
+    typedef typename Size<TStringSet>::Type TSize;
+
+    TSize numSeqs = length(database);
+    String<bool> isHit;
+    resize(isHit, numSeqs, false, Exact());
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic, 64))
+    for (int i = 0; i < static_cast<int>(numSeqs); ++i)
+        isHit[i] = _localAlignmentScanHit(database[i], profile, threshold);
+
+    TSize numHits = 0;
+    for (TSize i = 0; i < numSeqs; ++i)
+        if (isHit[i])
+        {
+            appendValue(hits, static_cast<TPosition>(i));
+            ++numHits;
+        }
+    return numHits;
+}
+
+// ----------------------------------------------------------------------------
+// Function localAlignment()                        [StripedQueryProfile, Gaps]
+// ----------------------------------------------------------------------------
+
+/**
+.Function.localAlignment
+..signature:localAlignment(gapsH, gapsV, profile)
+..signature:localAlignment(align,        profile)
+..param.profile:A @Class.StripedQueryProfile@ of the vertical sequence.
+The sources of $gapsV$ and $align[1]$ must equal the query of the profile.
+...type:Class.StripedQueryProfile
+..remarks:
+When called with a @Class.StripedQueryProfile@, the score and the end of the alignment are computed with the striped algorithm.
+The traceback is then computed only on the prefixes of both sequences that end at the alignment end.
+*/
+
+template <typename TSequenceH, typename TGapsSpecH,
+          typename TSequenceV, typename TGapsSpecV,
+          typename TSequence, typename TScore>
+typename Value<TScore>::Type
+localAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+               Gaps<TSequenceV, TGapsSpecV> & gapsV,
+               StripedQueryProfile<TSequence, TScore> const & profile)
+{
+    typedef typename Value<TScore>::Type TScoreValue;
+    typedef typename Position<TSequenceH>::Type TPosition;
+    typedef typename Size<TSequenceH>::Type TSize;
+    typedef TraceSegment_<TPosition, TSize> TTraceSegment;
+
+    SEQAN_ASSERT_EQ(length(source(gapsV)), length(host(profile)));
+
+    TScoreValue score = 0;
+    TPosition endH = 0;
+    TPosition endV = 0;
+    if (!_stripedLocalScore(score, endH, endV, source(gapsH), profile) || score <= 0)
+        return localAlignment(gapsH, gapsV, profile.data_scoringScheme);
+
+    // All best alignments of the prefixes end in (endH, endV) or have the
+    // same score, so the traceback of the prefixes yields a best alignment.
+    String<TTraceSegment> traceSegments;
+    _setUpAndRunAlignment(traceSegments, prefix(source(gapsH), endH), prefix(source(gapsV), endV),
+                          profile.data_scoringScheme, SmithWaterman());
+    _adaptTraceSegmentsTo(gapsH, gapsV, traceSegments);
+    return score;
+}
+
+// ----------------------------------------------------------------------------
+// Function localAlignment()                       [StripedQueryProfile, Align]
+// ----------------------------------------------------------------------------
+
+template <typename TSequence, typename TAlignSpec, typename TQuery, typename TScore>
+typename Value<TScore>::Type
+localAlignment(Align<TSequence, TAlignSpec> & align,
+               StripedQueryProfile<TQuery, TScore> const & profile)
+{
+    SEQAN_ASSERT_EQ(length(rows(align)), 2u);
+    return localAlignment(row(align, 0), row(align, 1), profile);
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_LOCAL_ALIGNMENT_STRIPED_H_
@@ -66,6 +66,8 @@ namespace seqan {
 ..signature:localAlignment(align,          scoringScheme, [lowerDiag, upperDiag])
 ..signature:localAlignment(gapsH, gapsV,   scoringScheme, [lowerDiag, upperDiag])
 ..signature:localAlignment(fragmentString, scoringScheme, [lowerDiag, upperDiag])
+..signature:localAlignment(align,          scoringScheme, dpContext)
+..signature:localAlignment(gapsH, gapsV,   scoringScheme, dpContext)
 ..param.align:
 An @Class.Align@ object that stores the alignment.
 The number of rows must be 2 and the sequences must have already been set.
@@ -86,6 +88,8 @@ Note that the user is responsible for ensuring that the scoring scheme is compat
 ...type:nolink:$int$
 ..param.upperDiag:Optional upper diagonal.
 ...type:nolink:$int$
+..param.dpContext:Workspace whose buffers are reused for the dynamic programming of repeated calls.
+...type:Class.DPContext
 ..returns:An integer with the alignment score, as given by the @Metafunction.Value@ metafunction of the @Class.Score@ type.
 ..remarks:The Waterman-Eggert algorithm (local alignment with declumping) is available through the @Class.LocalAlignmentEnumerator@ class.
 ..remarks:
@@ -179,6 +183,47 @@ TScoreValue localAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
     return score;
 }
 
+// ----------------------------------------------------------------------------
+// Function localAlignment()                       [unbanded, Align, DPContext]
+// ----------------------------------------------------------------------------
+
+template <typename TSequence, typename TAlignSpec,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue localAlignment(Align<TSequence, TAlignSpec> & align,
+                           Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                           DPContext<TScoreValue> & dpContext)
+{
+    SEQAN_ASSERT_EQ(length(rows(align)), 2u);
+    typedef typename DPContext<TScoreValue>::TTraceSegment TTraceSegment;
+
+    String<TTraceSegment> & traceSegments = _dpTraceSegments(dpContext);
+    TScoreValue score = _setUpAndRunAlignment(dpContext, traceSegments, source(row(align, 0)), source(row(align, 1)),
+                                              scoringScheme, AlignConfig<>(), SmithWaterman(), GapsLeft());
+    _adaptTraceSegmentsTo(row(align, 0), row(align, 1), traceSegments);
+    return score;
+}
+
+// ----------------------------------------------------------------------------
+// Function localAlignment()                        [unbanded, Gaps, DPContext]
+// ----------------------------------------------------------------------------
+
+template <typename TSequenceH, typename TGapsSpecH,
+          typename TSequenceV, typename TGapsSpecV,
+          typename TScoreValue, typename TScoreSpec>
+TScoreValue localAlignment(Gaps<TSequenceH, TGapsSpecH> & gapsH,
+                           Gaps<TSequenceV, TGapsSpecV> & gapsV,
+                           Score<TScoreValue, TScoreSpec> const & scoringScheme,
+                           DPContext<TScoreValue> & dpContext)
+{
+    typedef typename DPContext<TScoreValue>::TTraceSegment TTraceSegment;
+
+    String<TTraceSegment> & traceSegments = _dpTraceSegments(dpContext);
+    TScoreValue score = _setUpAndRunAlignment(dpContext, traceSegments, source(gapsH), source(gapsV), scoringScheme,
+                                              AlignConfig<>(), SmithWaterman(), GapsLeft());
+    _adaptTraceSegmentsTo(gapsH, gapsV, traceSegments);
+    return score;
+}
+
 // ----------------------------------------------------------------------------
 // Function localAlignment()                     [unbanded, Graph<Alignment<>>]
 // ----------------------------------------------------------------------------
@@ -227,6 +272,50 @@ TScoreValue localAlignment(String<Fragment<TSize, TFragmentSpec>, TStringSpec> &
     return score;
 }
 
+// ----------------------------------------------------------------------------
+// Function localAlignmentScore()                       [unbanded, batch of pairs]
+// ----------------------------------------------------------------------------
+
+/**
+.Function.localAlignmentScore
+..summary:Computes the best local alignment scores of a batch of sequence pairs.
+..cat:Alignments
+..signature:localAlignmentScore(stringsH, stringsV, scoringScheme)
+..param.stringsH:A @Class.StringSet@ with the horizontal sequences.
+...type:Class.StringSet
+..param.stringsV:A @Class.StringSet@ with the vertical sequences, of the same length as $stringsH$.
+...type:Class.StringSet
+..param.scoringScheme:The scoring scheme to use for the alignments.
+...type:Class.Score
+..returns:A @Class.String@ with the Smith-Waterman score of each pair $(stringsH[i], stringsV[i])$.
+..remarks:
+No traceback is computed.
+The pairs are computed in batches with one pair per lane of a SIMD register, see @Function.globalAlignmentScore@ for details.
+..example.code:
+StringSet<Dna5String> stringsH, stringsV;
+appendValue(stringsH, "CGATT");
+appendValue(stringsV, "CGAAATT");
+appendValue(stringsH, "ACGTACGT");
+appendValue(stringsV, "TACG");
+
+String<int> scores = localAlignmentScore(stringsH, stringsV, Score<int, Simple>(2, -1, -2));
+..see:Function.localAlignment
+..see:Function.globalAlignmentScore
+..include:seqan/align.h
+*/
+
+template <typename TStringH, typename TSpecH,
+          typename TStringV, typename TSpecV,
+          typename TScoreValue, typename TScoreSpec>
+String<TScoreValue> localAlignmentScore(StringSet<TStringH, TSpecH> const & stringsH,
+                                        StringSet<TStringV, TSpecV> const & stringsV,
+                                        Score<TScoreValue, TScoreSpec> const & scoringScheme)
+{
+    String<TScoreValue> scores;
+    _computeBatchScores(scores, stringsH, stringsV, scoringScheme, AlignConfig<>(), Tag<LocalAlignment_<> >());
+    return scores;
+}
+
 }  // namespace seqan
 
 #endif  // #ifndef SEQAN_CORE_INCLUDE_SEQAN_ALIGN_LOCAL_ALIGNMENT_UNBANDED_H_
@@ -80,6 +80,7 @@
 #if SEQAN_HAS_ZLIB
 #include <seqan/bam_io/bam_index_base.h>
 #include <seqan/bam_io/bam_index_bai.h>
+#include <seqan/bam_io/bam_index_regions.h>
 #endif  // #if SEQAN_HAS_ZLIB
 
 // ===========================================================================
@@ -127,6 +127,59 @@ public:
     {}
 };
 
+// ----------------------------------------------------------------------------
+// Helper Class BaiRecordInfo_
+// ----------------------------------------------------------------------------
+
+// Position of a raw BAM record in the buffer of a batch and its virtual offsets in the BAM file.
+
+struct BaiRecordInfo_
+{
+    __uint64 dataPos;
+    __uint32 size;
+    __uint64 offBeg;
+    __uint64 offEnd;
+};
+
+// ----------------------------------------------------------------------------
+// Helper Class BaiPartialRefIndex_
+// ----------------------------------------------------------------------------
+
+// Index data of the alignments of one reference within a slice of a batch.  Linear index entries of 0 are unset.
+
+struct BaiPartialRefIndex_
+{
+    __int32 rID;
+    __int32 firstPos;
+    __int32 lastPos;
+    __uint64 offBeg;
+    __uint64 offEnd;
+    __uint64 numMapped;
+    __uint64 numUnmapped;
+    BamIndex<Bai>::TBinIndex_ binIndex;
+    BamIndex<Bai>::TLinearIndex_ linearIndex;
+
+    BaiPartialRefIndex_() :
+        rID(-1), firstPos(0), lastPos(0), offBeg(0), offEnd(0), numMapped(0), numUnmapped(0)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Helper Class BaiPartialIndex_
+// ----------------------------------------------------------------------------
+
+// Index data built by one thread for a slice of a batch of records.
+
+struct BaiPartialIndex_
+{
+    String<BaiPartialRefIndex_> refs;
+    __uint64 unalignedCount;
+    bool ok;
+
+    BaiPartialIndex_() : unalignedCount(0), ok(true)
+    {}
+};
+
 // ============================================================================
 // Metafunctions
 // ============================================================================
@@ -162,6 +215,8 @@ public:
 ...type:Class.BamIndex
 ..returns:$bool$ indicating success.
 ..remarks:This function may fail if the refId/pos is invalid.
+..remarks:Region queries seek to and decompress the same BGZF blocks repeatedly.
+Enable the stream's block cache with @Function.setMaxCacheSize@ or share a @Class.BgzfBlockCache@ between streams with @Function.setBlockCache@ to decompress these blocks only once.
 ..include:seqan/bam_io.h
 */
 
@@ -522,24 +577,30 @@ read(BamIndex<Bai> & index, char * filename)
 // Function buildIndex()
 // ----------------------------------------------------------------------------
 
-/*DISABLED
+/**
 .Function.BamIndex#buildIndex
 ..class:Class.BamIndex
 ..cat:BAM I/O
-..signature:buildIndex(index, filename)
+..signature:buildIndex(index, filename[, numThreads])
 ..summary:Build index for BAM file with given filename.
 ..remarks:This will create an index file named $filename + ".bai"$.
+The BAM file has to be sorted by coordinate.
+..remarks:The BGZF blocks are decompressed in parallel and the records are indexed in batches.
+Each thread builds a partial index for a slice of a batch and the partial indices are merged in file order, so the resulting index does not depend on the number of threads.
+Parallel index construction requires OpenMP.
 ..param.index:Target data structure.
 ...type:Class.BamIndex
 ..param.filename:Path to BAM file to load.
 ...type:nolink:$char const *$
+..param.numThreads:The number of threads to use.
+...type:nolink:$unsigned$
+...default:1
 ..returns:$bool$ indicating success.
 ..include:seqan/bam_io.h
  */
 
 inline int _writeIndex(BamIndex<Bai> const & index, char const * filename)
 {
-    std::cerr << "WRITE INDEX TO " << filename << std::endl;
     // Open output stream.
     std::ofstream out(filename, std::ios::binary | std::ios::out);
 
@@ -580,7 +641,7 @@ inline int _writeIndex(BamIndex<Bai> const & index, char const * filename)
         }
 
         // Write out linear index.
-        __int32 numIntervals = length(index._linearIndices);
+        __int32 numIntervals = length(linearIndex);
         out.write(reinterpret_cast<char *>(&numIntervals), 4);
         typedef Iterator<String<__uint64> const, Rooted>::Type TLinearIndexIter;
         for (TLinearIndexIter it = begin(linearIndex, Rooted()); !atEnd(it); goNext(it))
@@ -588,49 +649,257 @@ inline int _writeIndex(BamIndex<Bai> const & index, char const * filename)
     }
 
     // Write the number of unaligned reads if set.
-    std::cerr << "UNALIGNED\t" << index._unalignedCount << std::endl;
     if (index._unalignedCount != maxValue<__uint64>())
         out.write(reinterpret_cast<char const *>(&index._unalignedCount), 8);
 
     return !out.good();  // 1 on error, 0 on success.
 }
 
-inline void _baiAddAlignmentChunkToBin(BamIndex<Bai> & index,
-                                       __uint32 currBin,
-                                       __uint32 currOffset,
-                                       __uint64 prevOffset)
+inline __uint32 _baiReadUInt32(char const * ptr)
 {
-    // If this is not the first reference sequence then add previous reference data.
-    Pair<__uint64> newChunk(currOffset, prevOffset);
+    __uint32 result = 0;
+    memcpy(&result, ptr, 4);
+    return result;
+}
+
+// Append the chunk of an alignment to its bin.  Chunks that directly follow each other in the file are joined.
+
+inline void _baiAppendChunk(BamIndex<Bai>::TBinIndex_ & binIndex,
+                            __uint32 bin,
+                            Pair<__uint64> const & chunk)
+{
+    String<Pair<__uint64> > & chunks = binIndex[bin].chunkBegEnds;
+    if (!empty(chunks) && back(chunks).i2 == chunk.i1)
+        back(chunks).i2 = chunk.i2;
+    else
+        appendValue(chunks, chunk);
+}
 
-    // If no interest exists yet for this bin, create one and store alignment chunk.
-    BamIndex<Bai>::TBinIndex_::iterator binIter = back(index._binIndices).find(currBin);
-    if (binIter == back(index._binIndices).end())
+// Store offset for all unset 16kbp windows overlapping with [beginPos, endPos).
+
+inline void _baiUpdateLinearIndex(BamIndex<Bai>::TLinearIndex_ & linearIndex,
+                                  __int32 beginPos,
+                                  __int32 endPos,
+                                  __uint64 offset)
+{
+    unsigned beginWindow = beginPos >> BamIndex<Bai>::BAM_LIDX_SHIFT;
+    unsigned endWindow = (endPos - 1) >> BamIndex<Bai>::BAM_LIDX_SHIFT;
+    if (length(linearIndex) <= endWindow)
+        resize(linearIndex, endWindow + 1, 0);
+    for (unsigned i = beginWindow; i <= endWindow; ++i)
+        if (linearIndex[i] == 0u)
+            linearIndex[i] = offset;
+}
+
+// Build the partial index for the raw records infos[beginIdx..endIdx) of a batch.
+
+inline void _baiBuildPartialIndex(BaiPartialIndex_ & partial,
+                                  String<char> const & data,
+                                  String<BaiRecordInfo_> const & infos,
+                                  unsigned beginIdx,
+                                  unsigned endIdx,
+                                  __int32 numRefSeqs)
+{
+    for (unsigned i = beginIdx; i < endIdx; ++i)
     {
-        BaiBamIndexBinData_ binData;
-        appendValue(binData.chunkBegEnds, newChunk);
-        back(index._binIndices).insert(std::make_pair(currBin, binData));
+        BaiRecordInfo_ const & info = infos[i];
+        char const * ptr = &data[0] + info.dataPos;
+
+        // Decode the fixed-length part of the record.
+        __int32 rID = static_cast<__int32>(_baiReadUInt32(ptr));
+        __int32 pos = static_cast<__int32>(_baiReadUInt32(ptr + 4));
+        __uint32 binMqNl = _baiReadUInt32(ptr + 8);
+        __uint32 flagNc = _baiReadUInt32(ptr + 12);
+        __uint32 bin = binMqNl >> 16;
+        unsigned lReadName = binMqNl & 0xff;
+        unsigned nCigarOp = flagNc & 0xffff;
+        bool unmapped = ((flagNc >> 16) & BAM_FLAG_UNMAPPED) != 0u;
+
+        // Unaligned records have to be at the end of the file.
+        if (rID < 0)
+        {
+            partial.unalignedCount += 1;
+            continue;
+        }
+        if (partial.unalignedCount != 0u || rID >= numRefSeqs || 32u + lReadName + 4u * nCigarOp > info.size)
+        {
+            partial.ok = false;
+            return;
+        }
+
+        // Start a new reference, the records have to be sorted by coordinate.
+        if (empty(partial.refs) || back(partial.refs).rID != rID)
+        {
+            if (!empty(partial.refs) && back(partial.refs).rID > rID)
+            {
+                partial.ok = false;
+                return;
+            }
+            appendValue(partial.refs, BaiPartialRefIndex_());
+            back(partial.refs).rID = rID;
+            back(partial.refs).firstPos = pos;
+            back(partial.refs).lastPos = pos;
+            back(partial.refs).offBeg = info.offBeg;
+        }
+        BaiPartialRefIndex_ & ref = back(partial.refs);
+        if (pos < ref.lastPos)
+        {
+            partial.ok = false;
+            return;
+        }
+        ref.lastPos = pos;
+        ref.offEnd = info.offEnd;
+
+        _baiAppendChunk(ref.binIndex, bin, Pair<__uint64>(info.offBeg, info.offEnd));
+        if (unmapped)
+        {
+            ref.numUnmapped += 1;
+            continue;
+        }
+        ref.numMapped += 1;
+
+        // Compute end position from the CIGAR operations that consume the reference (M, D, N, =, X).
+        __int32 endPos = pos;
+        char const * cigarPtr = ptr + 32 + lReadName;
+        for (unsigned j = 0; j < nCigarOp; ++j, cigarPtr += 4)
+        {
+            __uint32 op = _baiReadUInt32(cigarPtr);
+            switch (op & 0xf)
+            {
+                case 0: case 2: case 3: case 7: case 8:
+                    endPos += op >> 4;
+            }
+        }
+        if (endPos == pos)
+            endPos += 1;
+        if (pos >= 0)
+            _baiUpdateLinearIndex(ref.linearIndex, pos, endPos, info.offBeg);
     }
-    else
+}
+
+// Merge a partial index into the index.  The partial indices have to be merged in file order.
+
+inline bool _baiMergePartialIndex(BamIndex<Bai> & index,
+                                  String<Pair<__uint64> > & refOffsets,
+                                  String<Pair<__uint64> > & refCounts,
+                                  __int32 & lastRefId,
+                                  __int32 & lastPos,
+                                  BaiPartialIndex_ & partial)
+{
+    typedef BamIndex<Bai>::TBinIndex_      TBinIndex;
+    typedef TBinIndex::const_iterator      TBinIndexIter;
+    typedef BamIndex<Bai>::TLinearIndex_   TLinearIndex;
+
+    if (!partial.ok)
+        return false;
+    if (index._unalignedCount != 0u && !empty(partial.refs))
+        return false;  // Aligned records behind unaligned ones.
+
+    for (unsigned i = 0; i < length(partial.refs); ++i)
+    {
+        BaiPartialRefIndex_ & ref = partial.refs[i];
+        if (ref.rID < lastRefId || (ref.rID == lastRefId && ref.firstPos < lastPos))
+            return false;  // Not sorted by coordinate.
+        lastRefId = ref.rID;
+        lastPos = ref.lastPos;
+
+        // Update offset range and alignment counts of the reference.
+        if (refCounts[ref.rID].i1 + refCounts[ref.rID].i2 == 0u)
+            refOffsets[ref.rID].i1 = ref.offBeg;
+        refOffsets[ref.rID].i2 = ref.offEnd;
+        refCounts[ref.rID].i1 += ref.numMapped;
+        refCounts[ref.rID].i2 += ref.numUnmapped;
+
+        // Append chunks, a chunk at the begin of the slice may continue the last chunk of the previous slice.
+        TBinIndex & binIndex = index._binIndices[ref.rID];
+        if (binIndex.empty())
+        {
+            binIndex.swap(ref.binIndex);
+        }
+        else
+        {
+            for (TBinIndexIter itB = ref.binIndex.begin(), itBEnd = ref.binIndex.end(); itB != itBEnd; ++itB)
+                for (unsigned j = 0; j < length(itB->second.chunkBegEnds); ++j)
+                    _baiAppendChunk(binIndex, itB->first, itB->second.chunkBegEnds[j]);
+        }
+
+        // The first offset stored for a window wins.
+        TLinearIndex & linearIndex = index._linearIndices[ref.rID];
+        if (length(linearIndex) < length(ref.linearIndex))
+            resize(linearIndex, length(ref.linearIndex), 0);
+        for (unsigned j = 0; j < length(ref.linearIndex); ++j)
+            if (linearIndex[j] == 0u)
+                linearIndex[j] = ref.linearIndex[j];
+    }
+
+    index._unalignedCount += partial.unalignedCount;
+    return true;
+}
+
+// Merge chunks within the same BGZF block, add the pseudo-bin with the reference statistics and fill holes in the
+// linear index.
+
+inline void _baiFinalizeIndex(BamIndex<Bai> & index,
+                              String<Pair<__uint64> > const & refOffsets,
+                              String<Pair<__uint64> > const & refCounts)
+{
+    typedef BamIndex<Bai>::TBinIndex_      TBinIndex;
+    typedef TBinIndex::iterator            TBinIndexIter;
+    typedef BamIndex<Bai>::TLinearIndex_   TLinearIndex;
+
+    // The pseudo-bin 37450 contains the offset range and the numbers of mapped and unmapped alignments.
+    __uint32 const PSEUDO_BIN = 37450;
+
+    for (unsigned rID = 0; rID < length(index._binIndices); ++rID)
     {
-        // Otherwise, just append alignment chunk.
-        appendValue(binIter->second.chunkBegEnds, newChunk);
+        if (refCounts[rID].i1 + refCounts[rID].i2 == 0u)
+            continue;  // No alignments on this reference.
+
+        TBinIndex & binIndex = index._binIndices[rID];
+        for (TBinIndexIter itB = binIndex.begin(), itBEnd = binIndex.end(); itB != itBEnd; ++itB)
+        {
+            String<Pair<__uint64> > & chunks = itB->second.chunkBegEnds;
+            unsigned m = 0;
+            for (unsigned j = 1; j < length(chunks); ++j)
+            {
+                if (chunks[m].i2 >> 16 == chunks[j].i1 >> 16)
+                    chunks[m].i2 = chunks[j].i2;
+                else
+                    chunks[++m] = chunks[j];
+            }
+            resize(chunks, m + 1);
+        }
+
+        String<Pair<__uint64> > & pseudoChunks = binIndex[PSEUDO_BIN].chunkBegEnds;
+        appendValue(pseudoChunks, refOffsets[rID]);
+        appendValue(pseudoChunks, refCounts[rID]);
+
+        TLinearIndex & linearIndex = index._linearIndices[rID];
+        for (unsigned j = 1; j < length(linearIndex); ++j)
+            if (linearIndex[j] == 0u)
+                linearIndex[j] = linearIndex[j - 1];
     }
 }
 
 inline bool
-buildIndex(BamIndex<Bai> & index, char const * filename)
+buildIndex(BamIndex<Bai> & index, char const * filename, unsigned numThreads)
 {
-    SEQAN_FAIL("This does not work ye!");
+    // Number of bytes of raw records that are indexed in one batch.
+    size_t const BATCH_SIZE = 64 * 1024 * 1024;
+
+    if (numThreads == 0u)
+        numThreads = 1;
 
     index._unalignedCount = 0;
     clear(index._binIndices);
     clear(index._linearIndices);
     
-    // Open BAM file for reading.
+    // Open BAM file for reading, the BGZF blocks are decompressed in parallel.
     Stream<Bgzf> bamStream;
     if (!open(bamStream, filename, "r"))
         return false;  // Could not open BAM file.
+    if (numThreads > 1u)
+        setNumThreads(bamStream, numThreads);
 
     // Initialize BamIOContext.
     typedef StringSet<CharString>      TNameStore;
@@ -645,141 +914,80 @@ buildIndex(BamIndex<Bai> & index, char const * filename)
     int res = readRecord(header, bamIOContext, bamStream, Bam());
     if (res != 0)
         return false;  // Could not read BAM header.
-    __uint32 numRefSeqs = length(header.sequenceInfos);
-
-    // Scan over BAM file and create index.
-    BamAlignmentRecord record;
-    __uint32 currBin    = maxValue<__uint32>();
-    __uint32 prevBin    = maxValue<__uint32>();
-    __int32 currRefId   = BamAlignmentRecord::INVALID_REFID;
-    __int32 prevRefId   = BamAlignmentRecord::INVALID_REFID;
-    __uint64 currOffset = streamTell(bamStream);
-    __uint64 prevOffset = currOffset;
-    __int32 prevPos     = minValue<__int32>();
-
-    while (!atEnd(bamStream))
+    __int32 numRefSeqs = length(header.sequenceInfos);
+
+    resize(index._binIndices, numRefSeqs);
+    resize(index._linearIndices, numRefSeqs);
+    String<Pair<__uint64> > refOffsets;
+    resize(refOffsets, numRefSeqs, Pair<__uint64>(0, 0));
+    String<Pair<__uint64> > refCounts;
+    resize(refCounts, numRefSeqs, Pair<__uint64>(0, 0));
+
+    // Scan over BAM file and create index batch by batch.  The batch buffer grows with the records read, so
+    // small files do not allocate a full batch.
+    String<char> data;
+    String<BaiRecordInfo_> infos;
+    String<BaiPartialIndex_> partials;
+    String<unsigned> splitters;
+    __int32 lastRefId = BamAlignmentRecord::INVALID_REFID;
+    __int32 lastPos = minValue<__int32>();
+    __uint64 eofOffset = 0;
+
+    bool eof = false;
+    while (!eof)
     {
-        // Load next record.
-        res = readRecord(record, bamIOContext, bamStream, Bam());
-        if (res != 0)
-            return false;
-        
-        // Check ordering.
-        if (prevRefId == record.rID && prevPos > record.beginPos)
-            return false;
-
-        // The reference sequence changed, close bins for previous reference.
-        if (prevRefId != record.rID)
+        // Read the raw records of the next batch and their virtual offsets.
+        clear(data);
+        clear(infos);
+        while (length(data) < BATCH_SIZE)
         {
-            if (prevRefId != BamAlignmentRecord::INVALID_REFID)
-            {
-                _baiAddAlignmentChunkToBin(index, currBin, currOffset, prevOffset);
-
-                // Add an index for all empty references between prevRefId (excluded) and record.rID (included).
-                for (int i = prevRefId + 1; i < record.rID; ++i)
-                {
-                    BamIndex<Bai>::TBinIndex_ binIndex;
-                    appendValue(index._binIndices, binIndex);
-                    BamIndex<Bai>::TLinearIndex_ linearIndex;
-                    appendValue(index._linearIndices, linearIndex);
-                }
-
-                // Update bin book keeping.
-                currOffset = prevOffset;
-                currBin    = record.bin;
-                prevBin    = record.bin;
-                currRefId  = record.rID;
-            }
-            else
+            if (streamEof(bamStream))
             {
-                // Otherwise, this is the first pass.  Create an index for all empty references up to and including
-                // current refId.
-                for (int i = 0; i < record.rID; ++i)
-                {
-                    BamIndex<Bai>::TBinIndex_ binIndex;
-                    appendValue(index._binIndices, binIndex);
-                    BamIndex<Bai>::TLinearIndex_ linearIndex;
-                    appendValue(index._linearIndices, linearIndex);
-                }
+                eofOffset = static_cast<__uint64>(_bgzfTell(bamStream)) << 16;
+                eof = true;
+                break;
             }
 
-            // Update reference book keeping.
-            prevRefId = record.rID;
-            prevBin = minValue<__int32>();
-        }
-
-        // If the alignment's reference id is valid and its bin is not a leaf.
-        if (record.rID >= 0 && record.bin < 4681)
-        {
-            __int32 beginOffset = record.beginPos >> BamIndex<Bai>::BAM_LIDX_SHIFT;
-            __int32 endPos      = getAlignmentLengthInRef(record);
-            __int32 endOffset   = (endPos - 1) >> BamIndex<Bai>::BAM_LIDX_SHIFT;
-
-            // Resize linear index if necessary.
-            unsigned oldSize = length(index._linearIndices);
-            unsigned newSize = endOffset + 1;
-            if (oldSize < newSize)
-                resize(back(index._linearIndices), newSize, 0);
-
-            // Store offset.
-            for (int i = beginOffset + 1; i <= endOffset; ++i)
-                if (back(index._linearIndices)[i] == 0u)
-                    back(index._linearIndices)[i] = prevOffset;
-        }
-
-        // Handle the case if we changed to a new BAI bin.
-        if (record.bin != prevBin)
-        {
-            // If not first bin of reference, save previous bin data.
-            if (currBin != maxValue<__uint32>())
-                _baiAddAlignmentChunkToBin(index, currBin, currOffset, prevOffset);
-
-            // Update markers.
-            currOffset = prevOffset;
-            currBin    = record.bin;
-            prevBin    = record.bin;
-            currRefId  = record.rID;
-
-            // If the reference id is invalid then break out.
-            if (currRefId < 0)
-                break;
+            BaiRecordInfo_ info;
+            info.offBeg = streamTell(bamStream);
+            __int32 blockSize = 0;
+            if (streamReadBlock(reinterpret_cast<char *>(&blockSize), bamStream, 4) != 4 || blockSize < 32)
+                return false;  // Could not read record.
+            info.dataPos = length(data);
+            info.size = blockSize;
+            resize(data, length(data) + blockSize);
+            if (streamReadBlock(&data[info.dataPos], bamStream, blockSize) != (size_t)blockSize)
+                return false;  // Could not read record.
+            info.offEnd = streamTell(bamStream);
+            appendValue(infos, info);
         }
 
-        // Make sure that the current file pointer is beyond prevOffset.
-        if (streamTell(bamStream) <= static_cast<__int64>(prevOffset))
-            return false;  // Calculating offsets failed.
-
-        // Update prevOffset and prevPos.
-        prevOffset = streamTell(bamStream);
-        prevPos    = record.beginPos;
-    }
-
-    // Count remaining unaligned records.
-    while (!streamEof(bamStream))
-    {
-        SEQAN_ASSERT_GT(index._unalignedCount, 0u);
-
-        res = readRecord(record, bamIOContext, bamStream, Bam());
-        if (res != 0 || record.rID >= 0)
-            return false;  // Could not read record.
-
-        index._unalignedCount += 1;
+        // Build partial indices for slices of the batch in parallel.
+        clear(partials);
+        resize(partials, numThreads);
+        computeSplitters(splitters, length(infos), numThreads);
+        SEQAN_OMP_PRAGMA(parallel for num_threads(numThreads) schedule(static))
+        for (int i = 0; i < static_cast<int>(numThreads); ++i)
+            _baiBuildPartialIndex(partials[i], data, infos, splitters[i], splitters[i + 1], numRefSeqs);
+
+        // Merge partial indices in file order.
+        for (unsigned i = 0; i < numThreads; ++i)
+            if (!_baiMergePartialIndex(index, refOffsets, refCounts, lastRefId, lastPos, partials[i]))
+                return false;  // Invalid or unsorted records.
     }
 
-    // After loading all alignments, if any data was read, perform checks.
-    if (currRefId >= 0)
+    // As in samtools, the last chunk ends at the end of the file if there are no unaligned records.
+    if (lastRefId >= 0 && index._unalignedCount == 0u)
     {
-        // Store last alignment chunk to its bin and then write last reference entry with data.
-        _baiAddAlignmentChunkToBin(index, currBin, currOffset, prevOffset);
-
-        // Finally, write any empty references remaining at end of file.
-        SEQAN_ASSERT_GEQ(numRefSeqs, length(index._binIndices));
-        BamIndex<Bai>::TBinIndex_ binIndex;
-        resize(index._binIndices, numRefSeqs, binIndex);  // TODO(holtgrew): binIndex is unnecessary if resize used T() as default value as vector.resize() does.
+        typedef BamIndex<Bai>::TBinIndex_::iterator TBinIndexIter;
+        BamIndex<Bai>::TBinIndex_ & binIndex = index._binIndices[lastRefId];
+        for (TBinIndexIter itB = binIndex.begin(), itBEnd = binIndex.end(); itB != itBEnd; ++itB)
+            if (back(itB->second.chunkBegEnds).i2 == refOffsets[lastRefId].i2)
+                back(itB->second.chunkBegEnds).i2 = eofOffset;
+        refOffsets[lastRefId].i2 = eofOffset;
     }
 
-    // Merge small bins if possible.
-    SEQAN_FAIL("TODO: Merge bins!");
+    _baiFinalizeIndex(index, refOffsets, refCounts);
 
     // Write out index.
     CharString baiFilename(filename);
@@ -789,6 +997,12 @@ buildIndex(BamIndex<Bai> & index, char const * filename)
     return (res == 0);
 }
 
+inline bool
+buildIndex(BamIndex<Bai> & index, char const * filename)
+{
+    return buildIndex(index, filename, 1u);
+}
+
 }  // namespace seqan
 
 #endif  // #ifndef CORE_INCLUDE_SEQAN_BAM_IO_BAM_INDEX_BAI_H_
@@ -0,0 +1,363 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Splitting of the references into regions of balanced size using a BAI
+// index and parallel processing of the regions' alignments.
+// ==========================================================================
+
+#ifndef CORE_INCLUDE_SEQAN_BAM_IO_BAM_INDEX_REGIONS_H_
+#define CORE_INCLUDE_SEQAN_BAM_IO_BAM_INDEX_REGIONS_H_
+
+namespace seqan {
+
+// ============================================================================
+// Forwards
+// ============================================================================
+
+// ============================================================================
+// Tags, Classes, Enums
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Class BamRegion
+// ----------------------------------------------------------------------------
+
+/**
+.Class.BamRegion
+..cat:BAM I/O
+..summary:A region on a reference sequence of a BAM file.
+..signature:BamRegion
+..remarks:The region contains the alignments with a begin position in $[beginPos, endPos)$ on the reference with id $rID$.
+..include:seqan/bam_io.h
+
+.Memfunc.BamRegion#BamRegion
+..class:Class.BamRegion
+..signature:BamRegion()
+..signature:BamRegion(rID, beginPos, endPos)
+..param.rID:The reference id.
+...type:nolink:$__int32$
+..param.beginPos:Zero-based begin position of the region.
+...type:nolink:$__int32$
+..param.endPos:Zero-based (exclusive, C-style) end position of the region.
+...type:nolink:$__int32$
+
+.Memvar.BamRegion#rID
+..class:Class.BamRegion
+..summary:The reference id, $-1$ for invalid.
+..type:nolink:$__int32$
+
+.Memvar.BamRegion#beginPos
+..class:Class.BamRegion
+..summary:The zero-based begin position.
+..type:nolink:$__int32$
+
+.Memvar.BamRegion#endPos
+..class:Class.BamRegion
+..summary:The zero-based end position, exclusive.
+..type:nolink:$__int32$
+*/
+
+struct BamRegion
+{
+    __int32 rID;
+    __int32 beginPos;
+    __int32 endPos;
+
+    BamRegion() : rID(BamAlignmentRecord::INVALID_REFID), beginPos(0), endPos(0)
+    {}
+
+    BamRegion(__int32 rID, __int32 beginPos, __int32 endPos) : rID(rID), beginPos(beginPos), endPos(endPos)
+    {}
+};
+
+// ============================================================================
+// Metafunctions
+// ============================================================================
+
+// ============================================================================
+// Functions
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// Helper Function _baiRefEndOffset()
+// ----------------------------------------------------------------------------
+
+// Returns the largest chunk end offset of all bins of the given reference, 0 if there is none.
+
+inline __uint64
+_baiRefEndOffset(BamIndex<Bai> const & index, unsigned refId)
+{
+    // The pseudo-bin 37450 contains statistics and no chunks.
+    __uint32 const PSEUDO_BIN = 37450;
+
+    __uint64 result = 0;
+    typedef BamIndex<Bai>::TBinIndex_::const_iterator TBinIter;
+    for (TBinIter it = index._binIndices[refId].begin(); it != index._binIndices[refId].end(); ++it)
+    {
+        if (it->first == PSEUDO_BIN)
+            continue;
+        for (unsigned i = 0; i < length(it->second.chunkBegEnds); ++i)
+            result = std::max(result, static_cast<__uint64>(it->second.chunkBegEnds[i].i2));
+    }
+    return result;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _baiWindowSizes()
+// ----------------------------------------------------------------------------
+
+// Estimate the amount of data for each 16 kbp window of the linear index of the given reference.  The estimate is the
+// difference between consecutive virtual offsets, i.e. roughly proportional to the number of compressed bytes.
+
+inline void
+_baiWindowSizes(String<__uint64> & sizes, BamIndex<Bai> const & index, unsigned refId)
+{
+    BamIndex<Bai>::TLinearIndex_ const & linearIndex = index._linearIndices[refId];
+    clear(sizes);
+    if (empty(linearIndex))
+        return;
+    resize(sizes, length(linearIndex), 0);
+
+    // Empty windows have offset 0, their data is attributed to the previous non-empty window.
+    __uint64 endOffset = _baiRefEndOffset(index, refId);
+    __uint64 nextOffset = endOffset;
+    for (unsigned i = length(linearIndex); i > 0; --i)
+    {
+        __uint64 offset = linearIndex[i - 1];
+        if (offset == 0u && i > 1u)
+            continue;
+        if (nextOffset > offset)
+            sizes[i - 1] = nextOffset - offset;
+        nextOffset = offset;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function computeBalancedRegions()
+// ----------------------------------------------------------------------------
+
+/**
+.Function.BamIndex#computeBalancedRegions
+..class:Class.BamIndex
+..cat:BAM I/O
+..signature:computeBalancedRegions(regions, bamIndex, count)
+..summary:Split the references into regions with approximately the same amount of alignment data.
+..param.regions:The resulting regions, sorted by reference id and position.
+...type:Class.String
+...remarks:String of @Class.BamRegion@ objects.
+..param.bamIndex:The index of the BAM file.
+...type:Spec.BAI BamIndex
+..param.count:The desired number of regions.
+...type:nolink:$unsigned$
+..remarks:
+The amount of data per 16 kbp window is estimated from the linear index and the chunks of the bins.
+Region boundaries are placed at window boundaries such that each region contains approximately $1 / count$ of the data.
+A region never spans two references, so there may be more than $count$ regions.
+References without alignments get no region and the last region of a reference extends to the reference's end.
+Unaligned alignments without a reference are not covered.
+..remarks:Use @Function.BamIndex#processBamRegions@ to process the alignments of the regions in parallel.
+..include:seqan/bam_io.h
+*/
+
+template <typename TRegions>
+inline void
+computeBalancedRegions(TRegions & regions, BamIndex<Bai> const & index, unsigned count)
+{
+    clear(regions);
+    if (count == 0u)
+        count = 1;
+
+    // Compute window sizes and total size.
+    String<String<__uint64> > sizes;
+    resize(sizes, length(index._linearIndices));
+    __uint64 total = 0;
+    for (unsigned refId = 0; refId < length(index._linearIndices); ++refId)
+    {
+        _baiWindowSizes(sizes[refId], index, refId);
+        for (unsigned i = 0; i < length(sizes[refId]); ++i)
+            total += sizes[refId][i];
+    }
+    __uint64 target = (total + count - 1) / count;
+
+    // Greedily close regions once they reach the target size.
+    for (unsigned refId = 0; refId < length(sizes); ++refId)
+    {
+        if (empty(sizes[refId]))
+            continue;  // No alignments on this reference.
+
+        __uint64 regionSize = 0;
+        __int32 beginPos = 0;
+        for (unsigned i = 0; i + 1 < length(sizes[refId]); ++i)
+        {
+            regionSize += sizes[refId][i];
+            if (regionSize < target || regionSize == 0u)
+                continue;
+            __int32 endPos = static_cast<__int32>(i + 1) << BamIndex<Bai>::BAM_LIDX_SHIFT;
+            appendValue(regions, BamRegion(refId, beginPos, endPos));
+            beginPos = endPos;
+            regionSize = 0;
+        }
+        appendValue(regions, BamRegion(refId, beginPos, MaxValue<__int32>::VALUE));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _processBamRegion()
+// ----------------------------------------------------------------------------
+
+template <typename TNameStore, typename TNameStoreCache, typename TFunctor>
+inline int
+_processBamRegion(Stream<Bgzf> & stream,
+                  BamAlignmentRecord & record,
+                  BamIOContext<TNameStore, TNameStoreCache> & bamIOContext,
+                  BamIndex<Bai> const & index,
+                  BamRegion const & region,
+                  unsigned regionId,
+                  TFunctor & functor)
+{
+    bool hasAlignments = false;
+    if (!jumpToRegion(stream, hasAlignments, bamIOContext, region.rID, region.beginPos, region.endPos, index))
+        return 1;  // Could not jump to region.
+    if (!hasAlignments)
+        return 0;
+
+    while (!atEnd(stream))
+    {
+        if (readRecord(record, bamIOContext, stream, Bam()) != 0)
+            return 1;  // Could not read record.
+        if (record.rID != region.rID || record.beginPos >= region.endPos)
+            break;  // Behind region.
+        if (record.beginPos < region.beginPos)
+            continue;  // Overlaps with region but belongs to previous one.
+        functor(record, regionId);
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Function processBamRegions()
+// ----------------------------------------------------------------------------
+
+/**
+.Function.BamIndex#processBamRegions
+..class:Class.BamIndex
+..cat:BAM I/O
+..signature:processBamRegions(filename, bamIndex, regions, functor, numThreads)
+..summary:Process the alignments of BAM regions in parallel.
+..param.filename:Path to the BAM file.
+...type:nolink:$char const *$
+..param.bamIndex:The index of the BAM file.
+...type:Spec.BAI BamIndex
+..param.regions:The regions to process, e.g. computed by @Function.BamIndex#computeBalancedRegions@.
+...type:Class.String
+...remarks:String of @Class.BamRegion@ objects.
+..param.functor:Functor that is called as $functor(record, regionId)$ for each alignment of each region.
+$record$ is a @Class.BamAlignmentRecord@ and $regionId$ is the index of the region in $regions$.
+..param.numThreads:The number of threads to use, $0$ is treated as $1$.
+...type:nolink:$unsigned$
+..returns:$int$ status code, $0$ indicating success.
+..remarks:
+Each thread opens its own reader on the BAM file and processes regions until all regions have been processed.
+All alignments of one region are passed to the functor by the same thread in file order.
+An alignment belongs to the region that contains its begin position, so each alignment is passed exactly once if the regions do not overlap.
+..remarks:The functor is called concurrently from several threads, access to shared data has to be synchronized.
+Collecting results in a string with one entry per region needs no synchronization.
+..remarks:Parallel processing requires OpenMP, the regions are processed sequentially otherwise.
+..example.code:
+struct CountAlignments
+{
+    String<unsigned> counts;
+
+    void operator()(BamAlignmentRecord const &, unsigned regionId)
+    {
+        counts[regionId] += 1;
+    }
+};
+
+String<BamRegion> regions;
+computeBalancedRegions(regions, baiIndex, 64);
+CountAlignments counter;
+resize(counter.counts, length(regions), 0);
+int res = processBamRegions("example.bam", baiIndex, regions, counter, 8);
+..include:seqan/bam_io.h
+*/
+
+template <typename TRegions, typename TFunctor>
+inline int
+processBamRegions(char const * filename,
+                  BamIndex<Bai> const & index,
+                  TRegions const & regions,
+                  TFunctor & functor,
+                  unsigned numThreads)
+{
+    typedef StringSet<CharString>      TNameStore;
+    typedef NameStoreCache<TNameStore> TNameStoreCache;
+
+    int result = 0;
+    int numRegions = length(regions);
+    numThreads = _max(numThreads, 1u);  // 0 is no valid thread count.
+
+    SEQAN_OMP_PRAGMA(parallel num_threads(numThreads))
+    {
+        // Open reader for this thread and read header.
+        TNameStore nameStore;
+        TNameStoreCache nameStoreCache(nameStore);
+        BamIOContext<TNameStore> bamIOContext(nameStore, nameStoreCache);
+        BamHeader header;
+        BamAlignmentRecord record;
+
+        Stream<Bgzf> stream;
+        int res = 1;
+        if (open(stream, filename, "r"))
+            res = readRecord(header, bamIOContext, stream, Bam());
+
+        SEQAN_OMP_PRAGMA(for schedule(dynamic))
+        for (int i = 0; i < numRegions; ++i)
+        {
+            if (res != 0)
+                continue;  // Skip remaining regions after errors.
+            res = _processBamRegion(stream, record, bamIOContext, index, regions[i], i, functor);
+        }
+
+        if (res != 0)
+        {
+            SEQAN_OMP_PRAGMA(critical (processBamRegions))
+            result = res;
+        }
+    }
+
+    return result;
+}
+
+}  // namespace seqan
+
+#endif  // #ifndef CORE_INCLUDE_SEQAN_BAM_IO_BAM_INDEX_REGIONS_H_
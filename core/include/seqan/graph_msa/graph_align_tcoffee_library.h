@@ -833,6 +833,52 @@ _setDistanceValue(String<TFragment, TSpec>&,
 
 //////////////////////////////////////////////////////////////////////////////
 
+// Delegate of alignPairs() that records the matches, the scores and the
+// distance of each pair in the order of the pair list.
+template<typename TStringSet, typename TPairList, typename TSegmentMatches, typename TScoreValues, typename TDistance>
+struct GlobalPairwiseLibraryDelegate_
+{
+	TStringSet const& str;
+	TPairList const& pList;
+	TSegmentMatches& matches;
+	TScoreValues& scores;
+	TDistance& dist;
+
+	GlobalPairwiseLibraryDelegate_(TStringSet const& _str,
+								   TPairList const& _pList,
+								   TSegmentMatches& _matches,
+								   TScoreValues& _scores,
+								   TDistance& _dist) :
+		str(_str), pList(_pList), matches(_matches), scores(_scores), dist(_dist)
+	{}
+
+	template<typename TPos, typename TScoreValue, typename TFragments>
+	inline void
+	operator()(TPos pos, TScoreValue myScore, TFragments const& fragments)
+	{
+		typedef typename Id<TStringSet>::Type TId;
+		typedef typename Size<TStringSet>::Type TSize;
+		typedef typename Value<TScoreValues>::Type TValue;
+
+		// Make a pairwise string-set
+		TStringSet pairSet;
+		TId id1 = positionToId(str, pList[2 * pos]);
+		TId id2 = positionToId(str, pList[2 * pos + 1]);
+		assignValueById(pairSet, const_cast<TStringSet&>(str), id1);
+		assignValueById(pairSet, const_cast<TStringSet&>(str), id2);
+
+		// Record the matches and the scores
+		TSize from = length(matches);
+		append(matches, fragments);
+		resize(scores, length(matches), static_cast<TValue>(myScore));
+
+		// Get the alignment statistics
+		_setDistanceValue(matches, pairSet, dist, (TSize) pList[2 * pos], (TSize) pList[2 * pos + 1], (TSize) length(str), from);
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+
 template<typename TString, typename TSpec, typename TSize2, typename TSpec2, typename TScore, typename TSegmentMatches, typename TScoreValues, typename TDistance, typename TAlignConfig>
 inline void 
 appendSegmentMatches(StringSet<TString, Dependent<TSpec> > const& str,
@@ -846,42 +892,22 @@ appendSegmentMatches(StringSet<TString, Dependent<TSpec> > const& str,
 {
 	SEQAN_CHECKPOINT
 	typedef StringSet<TString, Dependent<TSpec> > TStringSet;
-	typedef typename Id<TStringSet>::Type TId;
 	typedef typename Size<TStringSet>::Type TSize;
-	typedef typename Value<TScoreValues>::Type TScoreValue;
 	typedef typename Iterator<String<TSize2, TSpec2> const, Standard>::Type TPairIter;
 
 	// Initialization
 	TSize nseq = length(str);
 	_resizeWithRespectToDistance(dist, nseq);
-	
-	// Pairwise alignments
+
+	String<Pair<TSize> > pairs;
 	TPairIter itPair = begin(pList, Standard());
 	TPairIter itPairEnd = end(pList, Standard());
-	for(;itPair != itPairEnd; ++itPair) {
-		// Make a pairwise string-set
-		TStringSet pairSet;
-		TId id1 = positionToId(str, *itPair); ++itPair;
-		TId id2 = positionToId(str, *itPair);
-		assignValueById(pairSet, const_cast<TStringSet&>(str), id1);
-		assignValueById(pairSet, const_cast<TStringSet&>(str), id2);
-				
-		// Alignment
-		TSize from = length(matches);
-		TScoreValue myScore = globalAlignment(matches, pairSet, score_type, ac, Gotoh() );
-		TSize to = length(matches);
+	for(;itPair != itPairEnd; itPair += 2)
+		appendValue(pairs, Pair<TSize>(*itPair, *(itPair + 1)));
 
-		// Record the scores
-		resize(scores, to);
-		typedef typename Iterator<TScoreValues, Standard>::Type TScoreIter;
-		TScoreIter itScore = begin(scores, Standard());
-		TScoreIter itScoreEnd = end(scores, Standard());
-		itScore+=from;
-		for(;itScore != itScoreEnd; ++itScore) *itScore = myScore;
-			
-		// Get the alignment statistics
-		_setDistanceValue(matches, pairSet, dist, (TSize) *(itPair-1), (TSize) *itPair, (TSize) nseq, (TSize)from);
-	}
+	// Pairwise alignments, the results are recorded in the order of the pairs
+	GlobalPairwiseLibraryDelegate_<TStringSet, String<TSize2, TSpec2>, TSegmentMatches, TScoreValues, TDistance> delegate(str, pList, matches, scores, dist);
+	alignPairs(delegate, str, pairs, score_type, ac, Gotoh(), Ordered());
 }
 
 
@@ -78,6 +78,7 @@
 #include <seqan/index/shape_threshold.h>
 #include <seqan/index/index_qgram.h>
 #include <seqan/index/index_qgram_openaddressing.h>
+#include <seqan/index/index_qgram_minimizer.h>
 //#include <seqan/index/index_qgram_nested.h>
 
 //____________________________________________________________________________
@@ -88,6 +89,7 @@
 #include <seqan/index/index_sa_lss.h>
 #include <seqan/index/index_sa_mm.h>
 #include <seqan/index/index_sa_qsort.h>
+#include <seqan/index/index_sa_sais.h>
 #include <seqan/index/index_sa_bwtwalk.h>
 
 #include <seqan/index/pump_extender3.h>
@@ -174,9 +176,11 @@
 // #include <seqan/index/index_fm_wavelet_tree.h>
 #include <seqan/index/index_fm_rank_dictionary_wt.h>
 #include <seqan/index/index_fm_rank_dictionary_bms.h>
+#include <seqan/index/index_fm_rank_dictionary_ib.h>
 #include <seqan/index/index_fm_sentinel_rank_dictionary.h>
 #include <seqan/index/index_fm_lf_table.h>
 #include <seqan/index/index_fm.h>
 #include <seqan/index/index_fm_stree.h>
+#include <seqan/index/index_fm_bidirectional.h>
 
 #endif //#ifndef SEQAN_HEADER_...
@@ -49,11 +49,15 @@ namespace SEQAN_NAMESPACE_MAIN
 	struct LarssonSadakane;
 	struct ManberMyers;
 	struct SAQSort;
+	struct Sais;
+	struct ParallelSais;
 	struct QGramAlg;
 
 	// lcp table construction algorithms
 	struct Kasai;
 	struct KasaiOriginal;	// original, but more space-consuming algorithm
+	struct Plcp;
+	struct ParallelPlcp;
 
 	// enhanced suffix array construction algorithms
 	struct Childtab;
@@ -93,6 +97,25 @@ for @Class.Index@ based substring searches.
 	template <typename TSpec = void>
 	struct IndexEsa {};
 
+/**
+.Tag.MMapFibres
+..cat:Index
+..summary:Index specialization that keeps the fibres in memory mapped strings.
+..signature:IndexEsa<MMapFibres>
+..signature:FMIndex<TOccSpec, MMapFibres>
+..remarks:The fibre strings of such an index are @Spec.MMap String@s. @Function.open@ maps the fibres of a saved index
+into memory instead of reading them, and processes that open the same index with $OPEN_RDONLY$ share a single copy in
+the page cache. The file layout is the same as without this tag, so indices saved from main memory can be mapped.
+..remarks:Each fibre is stored in a file of its own beginning at offset 0, so mapped fibres are page aligned.
+..remarks:The file bundle is versioned. @Function.open@ rejects bundles of a newer version, and for an @Spec.IndexEsa@
+also bundles whose suffix array, lcp or child table values have a different size than those of the index.
+..remarks:For a @Spec.FMIndex@ the suffix array samples and an @Tag.IB@ occurrence table are mapped, all other fibres are
+read into main memory. The text is mapped if it is a @Spec.MMap String@ itself.
+..include:seqan/index.h
+*/
+	struct MMapFibres_;
+	typedef Tag<MMapFibres_> const MMapFibres;
+
 
 //////////////////////////////////////////////////////////////////////////////
 /**
@@ -410,6 +433,11 @@ should use the functions @Function.posLocalize@, @Function.posGlobalize@, @Funct
 	struct DefaultIndexStringSpec< Index<TObject, TSpec> >:
 		DefaultIndexStringSpec<TObject> {};
 
+	template < typename TObject >
+	struct DefaultIndexStringSpec< Index<TObject, IndexEsa<MMapFibres> > > {
+		typedef MMap<> Type;
+	};
+
 //////////////////////////////////////////////////////////////////////////////
 // value and size type of an index
 
@@ -323,6 +323,39 @@ The entries are the characters left of the corresponding suffix in the suffix ar
 	}
 
 
+//////////////////////////////////////////////////////////////////////////////
+// file bundle info
+
+	// Stores the layout of an ESA file bundle and is written to the .esa file.
+	struct EsaIndexInfo_
+	{
+		__uint32 version;			// the version of the file bundle layout, see EsaIndexFileVersion_
+		__uint32 sizeOfSAEntry;		// sizeof of the suffix array values
+		__uint32 sizeOfLcpEntry;	// sizeof of the lcp table values
+		__uint32 sizeOfChildEntry;	// sizeof of the child table values
+	};
+
+	// The current version of the file bundle layout.  Bundles without .esa file
+	// are accepted as version 0, bundles of newer versions are rejected by open().
+	struct EsaIndexFileVersion_
+	{
+		static const __uint32 VALUE = 1;
+	};
+
+	template < typename TObject, typename TSpec >
+	inline EsaIndexInfo_
+	_esaIndexInfo(Index< TObject, IndexEsa<TSpec> > const &)
+	{
+		typedef Index< TObject, IndexEsa<TSpec> > TIndex;
+
+		EsaIndexInfo_ info = {
+			EsaIndexFileVersion_::VALUE,
+			sizeof(typename Value<typename Fibre<TIndex, EsaSA>::Type>::Type),
+			sizeof(typename Value<typename Fibre<TIndex, EsaLcp>::Type>::Type),
+			sizeof(typename Value<typename Fibre<TIndex, EsaChildtab>::Type>::Type) };
+		return info;
+	}
+
 //////////////////////////////////////////////////////////////////////////////
 // open
 
@@ -334,6 +367,21 @@ The entries are the characters left of the corresponding suffix in the suffix ar
 	{
 		String<char> name;
 
+		// a bundle saved with other fibre value types must not be reinterpreted
+		String<char> infoString;
+		name = fileName;	append(name, ".esa");
+		if (open(infoString, toCString(name), OPEN_RDONLY))
+		{
+			EsaIndexInfo_ expected = _esaIndexInfo(index);
+			EsaIndexInfo_ info;
+			if (length(infoString) != sizeof(EsaIndexInfo_)) return false;
+			std::memcpy(&info, begin(infoString, Standard()), sizeof(EsaIndexInfo_));
+			if (info.version > EsaIndexFileVersion_::VALUE) return false;
+			if (info.sizeOfSAEntry != expected.sizeOfSAEntry ||
+				info.sizeOfLcpEntry != expected.sizeOfLcpEntry ||
+				info.sizeOfChildEntry != expected.sizeOfChildEntry) return false;
+		}
+
 		name = fileName;	append(name, ".txt");
 		if ((!open(getFibre(index, EsaText()), toCString(name), openMode)) && 
 			(!open(getFibre(index, EsaText()), fileName, openMode))) return false;
@@ -388,6 +436,11 @@ The entries are the characters left of the corresponding suffix in the suffix ar
 		name = fileName;	append(name, ".bwt");
         if (!save(getFibre(index, EsaBwt()), toCString(name), openMode)) return false;
 
+		String<EsaIndexInfo_> infoString;
+		appendValue(infoString, _esaIndexInfo(index));
+		name = fileName;	append(name, ".esa");
+		if (!save(infoString, toCString(name), openMode)) return false;
+
 		return true;
 	}
 	template < typename TObject, typename TSpec >
@@ -150,6 +150,24 @@ To get a reference or the type of a specific fibre use @Function.getFibre@ or @M
 ..include:seqan/index.h
 */
 
+// ----------------------------------------------------------------------------
+// Metafunction FmIndexStringSpec_
+// ----------------------------------------------------------------------------
+
+// The string specialization of the suffix array samples and the interleaved occurrence table blocks.
+// With MMapFibres these fibres are memory mapped, such that open() maps a saved index instead of reading it.
+template <typename TSpec>
+struct FmIndexStringSpec_
+{
+    typedef Alloc<> Type;
+};
+
+template <>
+struct FmIndexStringSpec_<MMapFibres>
+{
+    typedef MMap<> Type;
+};
+
 template <typename TText, typename TWaveletTreeSpec, typename TSpec>
 struct Fibre<Index<TText, FMIndex<WT<TWaveletTreeSpec>, TSpec> >, FibreOccTable>
 {
@@ -178,6 +196,22 @@ struct Fibre<Index<StringSet<TText, TStringSetSpec>, FMIndex<SBM<TWaveletTreeSpe
     typedef SentinelRankDictionary<RankDictionary<SequenceBitMask<TValue_> >, Sentinels> Type;
 };
 
+template <typename TText, typename TIBSpec, typename TSpec>
+struct Fibre<Index<TText, FMIndex<IB<TIBSpec>, TSpec> >, FibreOccTable>
+{
+    typedef typename Value<TText>::Type TValue_;
+    typedef typename FmIndexStringSpec_<TSpec>::Type TStringSpec_;
+	typedef SentinelRankDictionary<RankDictionary<InterleavedBlocks<TValue_, TStringSpec_> >, Sentinel> Type;
+};
+
+template <typename TText, typename TStringSetSpec, typename TIBSpec, typename TSpec>
+struct Fibre<Index<StringSet<TText, TStringSetSpec>, FMIndex<IB<TIBSpec>, TSpec > >, FibreOccTable>
+{
+    typedef typename Value<TText>::Type TValue_;
+    typedef typename FmIndexStringSpec_<TSpec>::Type TStringSpec_;
+    typedef SentinelRankDictionary<RankDictionary<InterleavedBlocks<TValue_, TStringSpec_> >, Sentinels> Type;
+};
+
 template <typename TText, typename TOccSpec, typename TSpec>
 struct Fibre<Index<TText, FMIndex<TOccSpec, TSpec> >, FibreLfTable>
 {
@@ -214,7 +248,8 @@ template <typename TText, typename TOccSpec, typename TSpec>
 struct Fibre<Index<TText, FMIndex<TOccSpec, TSpec> >, FibreSA>
 {
 	typedef typename SAValue<Index<TText, FMIndex<TOccSpec, TSpec> > >::Type                TSAValue_;
-	typedef SparseString<String<TSAValue_>, void>                                           TSparseString_;
+	typedef typename FmIndexStringSpec_<TSpec>::Type                                        TStringSpec_;
+	typedef SparseString<String<TSAValue_, TStringSpec_>, void>                             TSparseString_;
 	typedef typename Fibre<Index<TText, FMIndex<TOccSpec, TSpec> >, FibreLfTable>::Type     TLfTable_;
 	typedef CompressedSA<TSparseString_, TLfTable_, void>                                   Type;
 };
@@ -248,6 +283,8 @@ struct FmIndexInfo_
     __uint32 sizeOfSAEntry;
     // The length of the genome.
     __uint64 genomeLength;
+    // The version of the file bundle layout, see FmIndexFileVersion_.
+    __uint32 version;
 }
 
 #ifndef PLATFORM_WINDOWS
@@ -258,6 +295,14 @@ struct FmIndexInfo_
       #pragma pack(pop)
 #endif
 
+// The current version of the file bundle layout, stored in the .fma file. Version 0 bundles lack
+// the version field, their fibre files are the same as in version 1. Bundles of newer versions
+// are rejected by open().
+struct FmIndexFileVersion_
+{
+    static const __uint32 VALUE = 1;
+};
+
 // ----------------------------------------------------------------------------
 // Spec FMIndex 
 // ----------------------------------------------------------------------------
@@ -274,6 +319,7 @@ struct FmIndexInfo_
 ..param.TOccSpec:Occurrence table specialisation. 
 ...type:Tag.WT
 ...type:Tag.SBM
+...type:Tag.IB
 ...remarks:The tags are really shortcuts for the different @Class.SentinelRankDictionary@s
 ...default:Tag.WT
 ..param.TSpec:FM index specialisation.
@@ -349,37 +395,46 @@ unsigned _computeBwtLength(StringSet<TText, TSetSpec> const & text)
 // ----------------------------------------------------------------------------
 
 // This function computes the BWT of a text. Note that the sentinel sign is substituted and its position stored.
+// The suffix array is processed in chunks, the BWT entries of each chunk are computed in parallel.
 // The function is tested implicitly in lfTableLfMapping() in test_index_fm.h
 template <typename TBwt, typename TSentinelPosition, typename TText, typename TSA, typename TSentinelSub>
 inline void _createBwTable(TBwt & bwt, TSentinelPosition & sentinelPos, TText const & text, TSA const & sa,
 		                   TSentinelSub const sentinelSub)
 {
 	//typedefs
-	typedef typename GetValue<TSA>::Type                    TSAValue;
+	typedef typename Value<TSA>::Type                       TSAValue;
+    typedef typename Size<TSA>::Type                        TSize;
     typedef typename Iterator<TSA const, Standard>::Type    TSAIter;
-    typedef typename Iterator<TBwt, Standard>::Type         TBwtIter;
 
 	//little helpers
     TSAIter saIt = begin(sa, Standard());
-    TSAIter saItEnd = end(sa, Standard());
-    TBwtIter bwtIt = begin(bwt, Standard());
-    
-	assignValue(bwtIt, back(text));
-	for (; saIt != saItEnd; ++saIt)
-	{
-        ++bwtIt;
-		TSAValue pos = getValue(saIt);
-		if (pos != 0)
-			assignValue(bwtIt, getValue(text, pos - 1));
-		else
-		{
-			assignValue(bwtIt, sentinelSub);
-			sentinelPos = bwtIt - begin(bwt, Standard());
-		}
+    TSize saLen = length(sa);
+    String<TSAValue> buffer;
+
+	assignValue(bwt, 0, back(text));
+    for (TSize chunkBegin = 0; chunkBegin < saLen; chunkBegin += SaChunk_::SIZE)
+    {
+        TSize chunkSize = std::min(saLen - chunkBegin, (TSize)SaChunk_::SIZE);
+        _copySaChunk(buffer, saIt, chunkSize);
+
+        SEQAN_OMP_PRAGMA(parallel for schedule(static))
+        for (__int64 i = 0; i < (__int64)chunkSize; ++i)
+        {
+            TSAValue pos = buffer[i];
+            if (pos != 0)
+                assignValue(bwt, chunkBegin + i + 1, getValue(text, pos - 1));
+            else
+            {
+                assignValue(bwt, chunkBegin + i + 1, sentinelSub);
+                sentinelPos = chunkBegin + i + 1;
+            }
+        }
 	}
 }
 
 // This function computes the BWT of a text. Note that the sentinel sign is substituted and its position stored.
+// The suffix array is processed in chunks, the BWT entries of each chunk are computed in parallel.  Each thread
+// processes whole words of the sentinel position bit string.
 // The function is tested implicitly in lfTableLfMapping() in test_index_fm.h
 template <typename TBwt, typename TSentinelPosition, typename TText, typename TSetSpec, typename TSA, typename TSentinelSub>
 inline void _createBwTable(TBwt & bwt, TSentinelPosition & sentinelPos, StringSet<TText, TSetSpec> const & text,
@@ -388,34 +443,48 @@ inline void _createBwTable(TBwt & bwt, TSentinelPosition & sentinelPos, StringSe
     typedef typename Value<TSA>::Type                       TSAValue;
     typedef typename Size<TSA>::Type                        TSize;
     typedef typename Iterator<TSA const, Standard>::Type    TSAIter;
-    typedef typename Iterator<TBwt, Standard>::Type         TBwtIter;
 
     // little Helpers
     TSize seqNum = countSequences(text);
     TSize totalLen = lengthSum(text);
+    TSize saLen = length(sa);
 
     resize(sentinelPos, seqNum + totalLen, Exact());
-    
-    TSAIter saIt = begin(sa, Standard());
-    TSAIter saItEnd = end(sa, Standard());
-    TBwtIter bwtItBeg = begin(bwt, Standard());
-    TBwtIter bwtIt = bwtItBeg;
 
     // fill the sentinel positions (they are all at the beginning of the bwt)
-    for (TSize i = 1; i <= seqNum; ++i, ++bwtIt)
-        assignValue(bwtIt, back(text[seqNum - i]));
+    for (TSize i = 1; i <= seqNum; ++i)
+        assignValue(bwt, i - 1, back(text[seqNum - i]));
 
     // compute the rest of the bwt
-    for (; saIt != saItEnd; ++saIt, ++bwtIt)
+    __int64 const bitsPerWord = BitsPerValue<typename Value<typename Fibre<TSentinelPosition, FibreBits>::Type>::Type>::VALUE;
+    typename StringSetLimits<StringSet<TText, TSetSpec> const>::Type & limits = stringSetLimits(text);
+    TSAIter saIt = begin(sa, Standard());
+    String<TSAValue> buffer;
+    for (TSize chunkBegin = 0; chunkBegin < saLen; chunkBegin += SaChunk_::SIZE)
     {
-        TSAValue pos;    // = SA[i];
-        posLocalize(pos, getValue(saIt), stringSetLimits(text));
-        if (getSeqOffset(pos) != 0)
-            assignValue(bwtIt, getValue(getValue(text, getSeqNo(pos)), getSeqOffset(pos) - 1));
-        else
+        TSize chunkSize = std::min(saLen - chunkBegin, (TSize)SaChunk_::SIZE);
+        _copySaChunk(buffer, saIt, chunkSize);
+
+        __int64 beginPos = seqNum + chunkBegin;
+        __int64 endPos = beginPos + chunkSize;
+        __int64 beginWord = beginPos / bitsPerWord;
+        __int64 endWord = (endPos + bitsPerWord - 1) / bitsPerWord;
+        SEQAN_OMP_PRAGMA(parallel for schedule(static))
+        for (__int64 w = beginWord; w < endWord; ++w)
         {
-            assignValue(bwtIt, sentinelSub);
-            setBit(sentinelPos, bwtIt - bwtItBeg);
+            __int64 end = std::min(endPos, (w + 1) * bitsPerWord);
+            for (__int64 bwtPos = std::max(beginPos, w * bitsPerWord); bwtPos < end; ++bwtPos)
+            {
+                TSAValue pos;    // = SA[i];
+                posLocalize(pos, buffer[bwtPos - beginPos], limits);
+                if (getSeqOffset(pos) != 0)
+                    assignValue(bwt, bwtPos, getValue(getValue(text, getSeqNo(pos)), getSeqOffset(pos) - 1));
+                else
+                {
+                    assignValue(bwt, bwtPos, sentinelSub);
+                    setBit(sentinelPos, bwtPos);
+                }
+            }
         }
     }
 
@@ -435,8 +504,8 @@ inline void _determineSentinelSubstitute(TPrefixSumTable const & pst, TChar & su
     typedef typename RemoveConst<TPrefixSumTable>::Type TNonConstPrefixSumTable;
 	typedef typename Value<TNonConstPrefixSumTable>::Type TValue;
 
-	TValue min = getPrefixSum(pst, length(pst) - 1);
-	unsigned pos = length(pst) - 1;
+	TValue min = MaxValue<TValue>::VALUE;
+	unsigned pos = 0;
 	for (unsigned i = 0; i < length(pst) - 1; ++i)
 	{
 		unsigned diff = pst[i + 1] - pst[i];
@@ -660,18 +729,22 @@ inline bool _indexCreateLfTables(Index<TText, FMIndex<TIndexSpec, TSpec> > & ind
 /**
 .Function.FMIndex#indexCreate
 ..summary:Creates a specific @Metafunction.Fibre@.
-..signature:indexCreate(index, fibreTag)
+..signature:indexCreate(index, fibreTag[, algoTag])
 ..param.index:The index to be created.
 ...type:Spec.FMIndex
 ..param.fibreTag:The fibre of the index to be computed.
 ...type:Tag.FM Index Fibres.tag.FibreSaLfTable
+..param.algoTag:The algorithm used to create the temporary full suffix array.
+...default:The result of @Metafunction.DefaultIndexCreator@ for the fibre $FibreSA$.
 ..remarks:If you call this function on the compressed text version of the FM index
 you will get an error message: "Logic error. It is not possible to create this index without a text."
+..remarks:If OpenMP is enabled, the BWT, the occurrence table and the compressed suffix array are built in parallel
+using the number of threads given by OpenMP (e.g. set by $OMP_NUM_THREADS$).
 */
 
 // This function creates the index.
-template <typename TText, typename TIndexSpec, typename TSpec>
-inline bool _indexCreate(Index<TText, FMIndex<TIndexSpec, TSpec > > & index, TText & text)
+template <typename TText, typename TIndexSpec, typename TSpec, typename TAlgoSpec>
+inline bool _indexCreate(Index<TText, FMIndex<TIndexSpec, TSpec > > & index, TText & text, TAlgoSpec const algoTag)
 {
 	typedef Index<TText, FMIndex<TIndexSpec, TSpec> >   TIndex;
 	typedef typename Fibre<TIndex, FibreTempSA>::Type   TTempSA;
@@ -682,10 +755,7 @@ inline bool _indexCreate(Index<TText, FMIndex<TIndexSpec, TSpec > > & index, TTe
     TTempSA tempSA;
     
 	resize(tempSA, length(text), Exact());
-	createSuffixArray(tempSA,
-			text,
-			Skew7());
-
+	createSuffixArray(tempSA, text, algoTag);
 
 	// create the compressed SA
 	_indexCreateSA(index, tempSA, text);
@@ -696,6 +766,19 @@ inline bool _indexCreate(Index<TText, FMIndex<TIndexSpec, TSpec > > & index, TTe
 	return true;
 }
 
+template <typename TText, typename TIndexSpec, typename TSpec>
+inline bool _indexCreate(Index<TText, FMIndex<TIndexSpec, TSpec > > & index, TText & text)
+{
+	typedef Index<TText, FMIndex<TIndexSpec, TSpec> >   TIndex;
+
+    return _indexCreate(index, text, typename DefaultIndexCreator<TIndex, FibreSA>::Type());
+}
+
+template <typename TText, typename TIndexSpec, typename TSpec, typename TAlgoSpec>
+inline bool indexCreate(Index<TText, FMIndex<TIndexSpec, TSpec> > & index, FibreSaLfTable const, TAlgoSpec const algoTag)
+{
+    return _indexCreate(index, getFibre(index, FibreText()), algoTag);
+}
 
 template <typename TText, typename TIndexSpec, typename TSpec>
 inline bool indexCreate(Index<TText, FMIndex<TIndexSpec, TSpec> > & index, FibreSaLfTable const)
@@ -776,6 +859,132 @@ inline void _range(const Index<TText, FMIndex<TOccSpec, TSpec> > & index, const
 	setPosition(range.i2, ep + 1);
 }
 
+// ----------------------------------------------------------------------------
+// Function findRanges
+// ----------------------------------------------------------------------------
+
+struct FindRangesBatch_
+{
+    static const unsigned SIZE = 16;
+};
+
+// This function performs the backward search of the patterns [batchBegin, batchEnd) in lockstep.
+// In every round the occurrence table entries needed by all active patterns are prefetched
+// before the first of them is read, such that the cache misses of the batch overlap.
+template <typename TRanges, typename TText, typename TOccSpec, typename TSpec, typename TPatterns, typename TSize>
+inline void _findRangesBatch(TRanges & ranges, Index<TText, FMIndex<TOccSpec, TSpec> > const & index,
+                             TPatterns const & patterns, TSize const batchBegin, TSize const batchEnd)
+{
+    typedef Index<TText, FMIndex<TOccSpec, TSpec> >             TIndex;
+    typedef typename Value<TIndex>::Type                        TAlphabet;
+    typedef typename ValueSize<TAlphabet>::Type                 TAlphabetSize;
+    typedef typename Value<TRanges>::Type                       TRange;
+    typedef typename Value<typename Value<TPatterns>::Type>::Type TChar;
+
+    TSize sp[FindRangesBatch_::SIZE];
+    TSize ep[FindRangesBatch_::SIZE];
+    TSize remaining[FindRangesBatch_::SIZE];
+    unsigned active[FindRangesBatch_::SIZE];
+    unsigned activeCount = 0;
+
+    // initialization with the last character of each pattern
+    for (unsigned k = 0; k < batchEnd - batchBegin; ++k)
+    {
+        TSize patternLength = length(patterns[batchBegin + k]);
+        if (patternLength == 0)
+        {
+            sp[k] = countSequences(index);
+            ep[k] = index.n;
+            continue;
+        }
+
+        TChar letter = patterns[batchBegin + k][patternLength - 1];
+        TAlphabetSize letterPosition = getCharacterPosition(index.lfTable.prefixSumTable, letter);
+        sp[k] = getPrefixSum(index.lfTable.prefixSumTable, letterPosition);
+        ep[k] = getPrefixSum(index.lfTable.prefixSumTable, letterPosition + 1);
+        remaining[k] = patternLength - 1;
+        if (sp[k] < ep[k] && remaining[k] > 0)
+            active[activeCount++] = k;
+    }
+
+    // the search as proposed by Ferragina and Manzini, one character of every active pattern per round
+    while (activeCount > 0)
+    {
+        for (unsigned a = 0; a < activeCount; ++a)
+        {
+            unsigned k = active[a];
+            TChar letter = patterns[batchBegin + k][remaining[k] - 1];
+            _prefetchOccurrences(index.lfTable.occTable, letter, sp[k] - 1);
+            _prefetchOccurrences(index.lfTable.occTable, letter, ep[k] - 1);
+        }
+
+        unsigned stillActive = 0;
+        for (unsigned a = 0; a < activeCount; ++a)
+        {
+            unsigned k = active[a];
+            TChar letter = patterns[batchBegin + k][--remaining[k]];
+            TAlphabetSize letterPosition = getCharacterPosition(index.lfTable.prefixSumTable, letter);
+            TSize prefixSum = getPrefixSum(index.lfTable.prefixSumTable, letterPosition);
+            sp[k] = prefixSum + countOccurrences(index.lfTable.occTable, letter, sp[k] - 1);
+            ep[k] = prefixSum + countOccurrences(index.lfTable.occTable, letter, ep[k] - 1);
+            if (sp[k] < ep[k] && remaining[k] > 0)
+                active[stillActive++] = k;
+        }
+        activeCount = stillActive;
+    }
+
+    for (unsigned k = 0; k < batchEnd - batchBegin; ++k)
+        ranges[batchBegin + k] = TRange(sp[k], ep[k]);
+}
+
+/**
+.Function.FMIndex#findRanges
+..summary:Computes the suffix array ranges of many patterns at once.
+..signature:findRanges(ranges, index, patterns)
+..class:Spec.FMIndex
+..cat:Index
+..param.ranges:The resulting ranges, one per pattern.
+...remarks:Each range is a @Class.Pair@ $(i1, i2)$ of suffix array positions such that the entries
+$i1$ to $i2 - 1$ point to the occurrences of the pattern. A pattern without occurrences has $i1 == i2$.
+...type:Class.String
+..param.index:The FM index.
+...type:Spec.FMIndex
+..param.patterns:A @Class.StringSet@ of patterns.
+..remarks:The patterns are searched in small batches whose backward searches advance in lockstep.
+Before each step, the occurrence table entries of all patterns in the batch are prefetched, which hides
+most of the memory latency of single pattern searches on large indices.
+The batches are distributed over all available threads if OpenMP is enabled.
+..include:seqan/index.h
+..example.code:
+StringSet<DnaString> patterns;
+appendValue(patterns, "ACG");
+appendValue(patterns, "TTA");
+
+String<Pair<unsigned> > ranges;
+findRanges(ranges, index, patterns);
+*/
+
+template <typename TRanges, typename TText, typename TOccSpec, typename TSpec, typename TPatterns>
+inline void findRanges(TRanges & ranges, Index<TText, FMIndex<TOccSpec, TSpec> > & index, TPatterns const & patterns)
+{
+    typedef typename Size<Index<TText, FMIndex<TOccSpec, TSpec> > >::Type TSize;
+
+    indexRequire(index, FibreSaLfTable());
+    resize(ranges, length(patterns), Exact());
+
+    TSize numPatterns = length(patterns);
+    __int64 numBatches = (numPatterns + FindRangesBatch_::SIZE - 1) / FindRangesBatch_::SIZE;
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(dynamic))
+    for (__int64 batch = 0; batch < numBatches; ++batch)
+    {
+        TSize batchBegin = batch * FindRangesBatch_::SIZE;
+        TSize batchEnd = std::min(batchBegin + (TSize)FindRangesBatch_::SIZE, numPatterns);
+        _findRangesBatch(ranges, const_cast<Index<TText, FMIndex<TOccSpec, TSpec> > const &>(index),
+                         patterns, batchBegin, batchEnd);
+    }
+}
+
 // ----------------------------------------------------------------------------
 // Function open
 // ----------------------------------------------------------------------------
@@ -795,6 +1004,9 @@ inline void _range(const Index<TText, FMIndex<TOccSpec, TSpec> > & index, const
 ...remarks:To circumvent problems, files are always opened in binary mode.
 ...default:$OPEN_RDWR | OPEN_CREATE | OPEN_APPEND$
 ..returns:A $bool$ which is $true$ on success.
+..remarks:An index specialized with @Tag.MMapFibres@ maps the suffix array samples and an @Tag.IB@ occurrence table
+into memory instead of reading them, a @Spec.MMap String@ text is mapped as well. Processes that open the same index
+with $OPEN_RDONLY$ share a single copy in the page cache. All other fibres are read into main memory.
 ..include:seqan/index.h
 */
 
@@ -808,7 +1020,7 @@ inline bool open(Index<TText, FMIndex<TOccSpec, TSpec> > & index, const char * f
 //    typedef typename Fibre<TIndex, FibreSA>::Type TSAFibre;
 //    typedef typename Value<TSAFibre>::Type TSAValue;
 
-    String<FmIndexInfo_> infoString;
+    String<char> infoString;
 
     name = fileName;    append(name, ".txt");
     if (!open(getFibre(index, FibreText()), toCString(name), openMode)) return false;
@@ -828,8 +1040,16 @@ inline bool open(Index<TText, FMIndex<TOccSpec, TSpec> > & index, const char * f
 //    if (infoString[0].sizeOfSAEntry != 0 && infoString[0].sizeOfSAEntry != sizeof(TSAValue))
 //        return false;
 
-    index.compressionFactor = infoString[0].compressionFactor;
-    index.n = infoString[0].genomeLength;
+    // Version 0 bundles store the info without the version field.
+    FmIndexInfo_ info = { 0, 0, 0, 0 };
+    if (length(infoString) != sizeof(FmIndexInfo_) && length(infoString) != sizeof(FmIndexInfo_) - sizeof(info.version))
+        return false;
+    std::memcpy(&info, begin(infoString, Standard()), length(infoString));
+    if (info.version > FmIndexFileVersion_::VALUE)
+        return false;
+
+    index.compressionFactor = info.compressionFactor;
+    index.n = info.genomeLength;
     getFibre(index, FibreSA()).lfTable = & getFibre(index, FibreLfTable());
 
     return true;
@@ -874,7 +1094,7 @@ inline bool save(Index<TText, FMIndex<TOccSpec, TSpec> > const & index, const ch
     typedef typename Value<TSAFibre>::Type TSAValue;
 
     String<FmIndexInfo_> infoString;
-    FmIndexInfo_ info = { index.compressionFactor, sizeof(TSAValue), index.n };
+    FmIndexInfo_ info = { index.compressionFactor, sizeof(TSAValue), index.n, FmIndexFileVersion_::VALUE };
     appendValue(infoString, info);
 
     name = fileName;    append(name, ".txt");
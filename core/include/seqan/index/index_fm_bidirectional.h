@@ -0,0 +1,694 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+
+#ifndef INDEX_FM_BIDIRECTIONAL_H_
+#define INDEX_FM_BIDIRECTIONAL_H_
+
+namespace seqan {
+
+// ==========================================================================
+// Forwards
+// ==========================================================================
+
+template <typename TOccSpec = WT<>, typename TSpec = void>
+class BidirectionalFMIndex;
+
+// ==========================================================================
+// Metafunctions
+// ==========================================================================
+
+// ----------------------------------------------------------------------------
+// Metafunction ReversedText_
+// ----------------------------------------------------------------------------
+
+// The type of the reversed text the backward index is built from.
+template <typename TText>
+struct ReversedText_
+{
+    typedef String<typename Value<TText>::Type> Type;
+};
+
+template <typename TString, typename TSSetSpec>
+struct ReversedText_<StringSet<TString, TSSetSpec> >
+{
+    typedef StringSet<String<typename Value<TString>::Type> > Type;
+};
+
+// ----------------------------------------------------------------------------
+// Metafunction Fibre
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TOccSpec, typename TSpec>
+struct Fibre<Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> >, FibreLfTable> :
+    public Fibre<Index<TText, FMIndex<TOccSpec, TSpec> >, FibreLfTable> {};
+
+template <typename TText, typename TOccSpec, typename TSpec>
+struct Fibre<Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> >, FibreSA> :
+    public Fibre<Index<TText, FMIndex<TOccSpec, TSpec> >, FibreSA> {};
+
+// ----------------------------------------------------------------------------
+// Metafunction VertexDescriptor                                        [Index]
+// ----------------------------------------------------------------------------
+
+template <typename TSize>
+struct VertexBidirectionalFmi;
+
+template <typename TText, typename TOccSpec, typename TIndexSpec>
+struct VertexDescriptor<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> > >
+{
+    typedef VertexBidirectionalFmi<typename Size<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> > >::Type> Type;
+};
+
+// ----------------------------------------------------------------------------
+// Metafunction HistoryStackEntry_                                      [Index]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TIterSpec>
+struct HistoryStackEntry_<Iter<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> >,
+                               VSTree<TopDown<ParentLinks<TIterSpec> > > > > :
+    public VertexDescriptor<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> > > {};
+
+// ==========================================================================
+// Classes
+// ==========================================================================
+
+// ----------------------------------------------------------------------------
+// Class VertexBidirectionalFmi
+// ----------------------------------------------------------------------------
+
+// The suffix array interval of the representative in the index of the text (range)
+// and the interval of the reversed representative in the index of the reversed text.
+template <typename TSize>
+struct VertexBidirectionalFmi
+{
+    Pair<TSize> range;
+    Pair<TSize> revRange;
+    TSize       repLen;
+
+    VertexBidirectionalFmi() :
+        range(0, 0),
+        revRange(0, 0),
+        repLen(0)
+    {}
+
+    VertexBidirectionalFmi(MinimalCtor) :
+        range(0, 0),
+        revRange(0, 0),
+        repLen(0)
+    {}
+};
+
+// ----------------------------------------------------------------------------
+// Spec BidirectionalFMIndex
+// ----------------------------------------------------------------------------
+
+/**
+.Spec.BidirectionalFMIndex:
+..summary:An FM index that can extend a pattern both to the left and to the right.
+..cat:Index
+..general:Class.Index
+..signature:Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> >
+..param.TText:The text type.
+...type:Class.String
+...type:Class.StringSet
+..param.TOccSpec:Occurrence table specialisation.
+...type:Tag.WT
+...type:Tag.SBM
+...type:Tag.IB
+...default:Tag.WT
+..param.TSpec:FM index specialisation.
+...default:void
+..remarks:The index consists of an @Spec.FMIndex@ of the text and the occurrence and prefix sum tables of an FM index
+of the reversed text. No suffix array is stored for the reversed text.
+A top-down iterator keeps the suffix array intervals of the representative in both indices in sync, such that
+@Function.extendLeft@ and @Function.extendRight@ can be mixed arbitrarily. This allows to search with schemes that
+start in the middle of a pattern (e.g. pigeonhole or 01*0 seeds) using a single index.
+..include:seqan/index.h
+*/
+
+template <typename TText, typename TOccSpec, typename TSpec>
+class Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> >
+{
+public:
+    typedef typename ReversedText_<TText>::Type TRevText;
+
+    Index<TText, FMIndex<TOccSpec, TSpec> >     fwd;
+    Index<TRevText, FMIndex<TOccSpec, TSpec> >  rev;
+
+    Index() {}
+
+    Index(TText & text, unsigned compressionFactor = 10) :
+        fwd(text, compressionFactor)
+    {
+        rev.n = fwd.n;
+        rev.compressionFactor = compressionFactor;
+    }
+
+    inline bool operator==(const Index & b) const
+    {
+        return fwd == b.fwd &&
+               rev.lfTable == b.rev.lfTable;
+    }
+};
+
+// ==========================================================================
+// Functions
+// ==========================================================================
+
+// ----------------------------------------------------------------------------
+// Function clear
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TOccSpec, typename TSpec>
+inline void clear(Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > & index)
+{
+    clear(index.fwd);
+    clear(index.rev);
+}
+
+// ----------------------------------------------------------------------------
+// Function empty
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TOccSpec, typename TSpec>
+inline bool empty(Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > const & index)
+{
+    return empty(index.fwd) && empty(getFibre(index.rev, FibreLfTable()));
+}
+
+// ----------------------------------------------------------------------------
+// Function getFibre
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TOccSpec, typename TSpec>
+inline typename Fibre<Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> >, FibreText>::Type &
+getFibre(Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > & index, FibreText)
+{
+    return getFibre(index.fwd, FibreText());
+}
+
+template <typename TText, typename TOccSpec, typename TSpec>
+inline typename Fibre<Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > const, FibreText>::Type &
+getFibre(Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > const & index, FibreText)
+{
+    return getFibre(index.fwd, FibreText());
+}
+
+template <typename TText, typename TOccSpec, typename TSpec>
+inline typename Fibre<Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> >, FibreLfTable>::Type &
+getFibre(Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > & index, FibreLfTable)
+{
+    return getFibre(index.fwd, FibreLfTable());
+}
+
+template <typename TText, typename TOccSpec, typename TSpec>
+inline typename Fibre<Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> >, FibreLfTable>::Type const &
+getFibre(Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > const & index, FibreLfTable)
+{
+    return getFibre(index.fwd, FibreLfTable());
+}
+
+template <typename TText, typename TOccSpec, typename TSpec>
+inline typename Fibre<Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> >, FibreSA>::Type &
+getFibre(Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > & index, FibreSA)
+{
+    return getFibre(index.fwd, FibreSA());
+}
+
+template <typename TText, typename TOccSpec, typename TSpec>
+inline typename Fibre<Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> >, FibreSA>::Type const &
+getFibre(Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > const & index, FibreSA)
+{
+    return getFibre(index.fwd, FibreSA());
+}
+
+// ----------------------------------------------------------------------------
+// Helper function _reverseText
+// ----------------------------------------------------------------------------
+
+template <typename TRevText, typename TText>
+inline void _reverseText(TRevText & revText, TText const & text)
+{
+    assign(revText, text);
+    reverse(revText);
+}
+
+// The sequences are reversed individually such that the sequence numbers are kept.
+template <typename TRevText, typename TString, typename TSSetSpec>
+inline void _reverseText(TRevText & revText, StringSet<TString, TSSetSpec> const & text)
+{
+    typedef typename Size<StringSet<TString, TSSetSpec> >::Type TSize;
+
+    clear(revText);
+    reserve(revText, length(text), Exact());
+    for (TSize i = 0; i < length(text); ++i)
+        appendValue(revText, text[i]);
+    reverse(revText);
+}
+
+// ----------------------------------------------------------------------------
+// Function indexCreate
+// ----------------------------------------------------------------------------
+
+/**
+.Function.BidirectionalFMIndex#indexCreate
+..summary:Creates a specific @Metafunction.Fibre@.
+..signature:indexCreate(index, fibreTag[, algoTag])
+..param.index:The index to be created.
+...type:Spec.BidirectionalFMIndex
+..param.fibreTag:The fibre of the index to be computed.
+...type:Tag.FM Index Fibres.tag.FibreSaLfTable
+..param.algoTag:The algorithm used to create the temporary full suffix arrays.
+...default:The result of @Metafunction.DefaultIndexCreator@ for the fibre $FibreSA$.
+..remarks:The FM index of the text is created as usual. Of the FM index of the reversed text only the lf table is kept.
+*/
+
+template <typename TText, typename TOccSpec, typename TSpec, typename TAlgoSpec>
+inline bool indexCreate(Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > & index, FibreSaLfTable const,
+                        TAlgoSpec const algoTag)
+{
+    typedef Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> >    TIndex;
+    typedef typename TIndex::TRevText                               TRevText;
+    typedef Index<TRevText, FMIndex<TOccSpec, TSpec> >              TRevIndex;
+    typedef typename Fibre<TRevIndex, FibreTempSA>::Type            TTempSA;
+
+    if (!indexCreate(index.fwd, FibreSaLfTable(), algoTag))
+        return false;
+
+    TRevText revText;
+    _reverseText(revText, getFibre(index, FibreText()));
+
+    TTempSA tempSA;
+    resize(tempSA, length(revText), Exact());
+    createSuffixArray(tempSA, revText, algoTag);
+
+    index.rev.n = index.fwd.n;
+    index.rev.compressionFactor = index.fwd.compressionFactor;
+    return _indexCreateLfTables(index.rev, revText, tempSA);
+}
+
+template <typename TText, typename TOccSpec, typename TSpec>
+inline bool indexCreate(Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > & index, FibreSaLfTable const)
+{
+    typedef Index<TText, FMIndex<TOccSpec, TSpec> > TFwdIndex;
+
+    return indexCreate(index, FibreSaLfTable(), typename DefaultIndexCreator<TFwdIndex, FibreSA>::Type());
+}
+
+template <typename TText, typename TOccSpec, typename TSpec>
+inline bool indexCreate(Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > & index)
+{
+    return indexCreate(index, FibreSaLfTable());
+}
+
+// ----------------------------------------------------------------------------
+// Function indexSupplied
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TOccSpec, typename TSpec>
+inline bool indexSupplied(Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > const & index, FibreSaLfTable const)
+{
+    return indexSupplied(index.fwd, FibreSaLfTable()) && !empty(getFibre(index.rev, FibreLfTable()));
+}
+
+template <typename TText, typename TOccSpec, typename TSpec>
+inline bool indexSupplied(Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > & index, FibreSaLfTable const)
+{
+    return indexSupplied(const_cast<Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > const &>(index),
+                         FibreSaLfTable());
+}
+
+// ----------------------------------------------------------------------------
+// Function _indexRequireTopDownIteration()                             [Index]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TOccSpec, typename TIndexSpec>
+void _indexRequireTopDownIteration(Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> > & index)
+{
+    indexRequire(index, FibreSaLfTable());
+}
+
+// ----------------------------------------------------------------------------
+// Function open
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TOccSpec, typename TSpec>
+inline bool open(Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > & index, const char * fileName, int openMode)
+{
+    String<char> name;
+
+    if (!open(index.fwd, fileName, openMode)) return false;
+
+    name = fileName;    append(name, ".rev.lf");
+    if (!open(getFibre(index.rev, FibreLfTable()), toCString(name), openMode)) return false;
+
+    index.rev.n = index.fwd.n;
+    index.rev.compressionFactor = index.fwd.compressionFactor;
+
+    return true;
+}
+
+template <typename TText, typename TOccSpec, typename TSpec>
+inline bool open(Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > & index, const char * fileName)
+{
+    return open(index, fileName, DefaultOpenMode<Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > >::VALUE);
+}
+
+// ----------------------------------------------------------------------------
+// Function save
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TOccSpec, typename TSpec>
+inline bool save(Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > const & index, const char * fileName,
+                 int openMode)
+{
+    String<char> name;
+
+    if (!save(index.fwd, fileName, openMode)) return false;
+
+    name = fileName;    append(name, ".rev.lf");
+    if (!save(getFibre(index.rev, FibreLfTable()), toCString(name), openMode)) return false;
+
+    return true;
+}
+
+template <typename TText, typename TOccSpec, typename TSpec>
+inline bool save(Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > const & index, const char * fileName)
+{
+    return save(index, fileName, DefaultOpenMode<Index<TText, BidirectionalFMIndex<TOccSpec, TSpec> > >::VALUE);
+}
+
+// ----------------------------------------------------------------------------
+// Function goRoot()                                                 [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TSpec>
+inline void goRoot(Iter<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> >, VSTree<TSpec> > & it)
+{
+    _historyClear(it);
+    clear(it);
+
+    if (!empty(indexSA(container(it))))
+    {
+        value(it).range.i1 = container(it).fwd.lfTable.prefixSumTable[0];
+        value(it).revRange.i1 = value(it).range.i1;
+        _setSizeInval(value(it).range.i2);
+        _setSizeInval(value(it).revRange.i2);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function _isRoot()                                                [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TSize>
+inline bool _isRoot(VertexBidirectionalFmi<TSize> const & value)
+{
+    return _isSizeInval(value.range.i2);
+}
+
+// ----------------------------------------------------------------------------
+// Function repLength()                                              [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TIndex, typename TSize>
+inline typename Size<TIndex>::Type
+repLength(TIndex const &, VertexBidirectionalFmi<TSize> const & vDesc)
+{
+    return vDesc.repLen;
+}
+
+// ----------------------------------------------------------------------------
+// Function _historyPush()                                           [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TSpec>
+inline void _historyPush(Iter<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> >, VSTree<TopDown<TSpec> > > & it)
+{
+    it._parentDesc = value(it);
+}
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TSpec>
+inline void
+_historyPush(Iter<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> >, VSTree<TopDown<ParentLinks<TSpec> > > > & it)
+{
+    appendValue(it.history, value(it));
+}
+
+// ----------------------------------------------------------------------------
+// Function _goUp()                                                  [Iterator]
+// ----------------------------------------------------------------------------
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TSpec>
+inline bool _goUp(Iter<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> >, VSTree<TopDown<TSpec> > > & it)
+{
+    if (!isRoot(it))
+    {
+        value(it) = it._parentDesc;
+        return true;
+    }
+
+    return false;
+}
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TSpec>
+inline bool
+_goUp(Iter<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> >, VSTree<TopDown<ParentLinks<TSpec> > > > & it)
+{
+    if (!empty(it.history))
+    {
+        value(it) = back(it.history);
+        pop(it.history);
+        return true;
+    }
+
+    return false;
+}
+
+// ----------------------------------------------------------------------------
+// Helper function _countSentinels
+// ----------------------------------------------------------------------------
+
+// Returns the number of sentinels in the interval [i1, i2) of the BWT.
+template <typename TRankDictionary, typename TPos>
+inline TPos _countSentinels(SentinelRankDictionary<TRankDictionary, Sentinel> const & dictionary,
+                            TPos const i1, TPos const i2)
+{
+    return (dictionary.sentinelPosition >= i1 && dictionary.sentinelPosition < i2) ? 1 : 0;
+}
+
+template <typename TRankDictionary, typename TPos>
+inline TPos _countSentinels(SentinelRankDictionary<TRankDictionary, Sentinels> const & dictionary,
+                            TPos const i1, TPos const i2)
+{
+    TPos occ = getRank(getFibre(dictionary, FibreSentinelPosition()), i2 - 1);
+    if (i1 > 0)
+        occ -= getRank(getFibre(dictionary, FibreSentinelPosition()), i1 - 1);
+    return occ;
+}
+
+// ----------------------------------------------------------------------------
+// Helper function _extendRange
+// ----------------------------------------------------------------------------
+
+// Computes the new interval of cP in the index (range) and the one of (cP)^r in the index of the
+// reversed text (mirrorRange). The latter is a subinterval of the current mirrorRange, preceded by
+// all representatives extended with a sentinel or a character smaller than c.
+template <typename TLfTable, typename TSize, typename TChar>
+inline bool _extendRange(TLfTable const & lfTable, Pair<TSize> & range, Pair<TSize> & mirrorRange, TChar c)
+{
+    typedef typename Fibre<TLfTable, FibrePrefixSumTable>::Type TPrefixSumTable;
+    typedef typename Value<TPrefixSumTable>::Type               TPrefixSumValue;
+    typedef typename Fibre<TLfTable, FibreOccTable>::Type       TOccTable;
+    typedef typename Value<TOccTable>::Type                     TAlphabet;
+
+    TPrefixSumTable const & pst = getFibre(lfTable, FibrePrefixSumTable());
+    TOccTable const & occTable = getFibre(lfTable, FibreOccTable());
+
+    unsigned cPosition = getCharacterPosition(pst, c);
+
+    if (_isSizeInval(range.i2))
+    {
+        range.i1 = getPrefixSum(pst, cPosition);
+        range.i2 = getPrefixSum(pst, cPosition + 1);
+        mirrorRange = range;
+        return range.i1 < range.i2;
+    }
+
+    TSize prefixSum = getPrefixSum(pst, cPosition);
+    TSize i1 = prefixSum + countOccurrences(occTable, c, range.i1 - 1);
+    TSize i2 = prefixSum + countOccurrences(occTable, c, range.i2 - 1);
+
+    if (i1 >= i2)
+        return false;
+
+    TSize smaller = _countSentinels(occTable, range.i1, range.i2);
+    for (unsigned a = 0; a < cPosition; ++a)
+    {
+        TAlphabet d = static_cast<TAlphabet>(static_cast<TPrefixSumValue>(getCharacter(pst, a)));
+        smaller += countOccurrences(occTable, d, range.i2 - 1) - countOccurrences(occTable, d, range.i1 - 1);
+    }
+
+    range.i1 = i1;
+    range.i2 = i2;
+    mirrorRange.i1 += smaller;
+    mirrorRange.i2 = mirrorRange.i1 + (i2 - i1);
+
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Function extendLeft()                                             [Iterator]
+// ----------------------------------------------------------------------------
+
+/**
+.Function.extendLeft:
+..summary:Prepends a character or a string to the representative of a bidirectional FM index iterator.
+..cat:Index
+..signature:extendLeft(iterator, object)
+..class:Spec.BidirectionalFMIndex
+..param.iterator:A top-down iterator of a @Spec.BidirectionalFMIndex@.
+..param.object:The character or string to prepend.
+..returns:$true$ if the extended representative occurs in the text, otherwise $false$.
+If a string cannot be prepended completely, the iterator represents the longest suffix of the string that was prepended.
+...type:nolink:bool
+..see:Function.extendRight
+..include:seqan/index.h
+*/
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TSpec, typename TChar>
+inline bool _extendLeftChar(Iter<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+                            TChar c)
+{
+    typedef typename VertexDescriptor<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> > >::Type TVertexDesc;
+
+    TVertexDesc vDesc = value(it);
+    if (!_extendRange(container(it).fwd.lfTable, vDesc.range, vDesc.revRange, c))
+        return false;
+
+    _historyPush(it);
+    value(it) = vDesc;
+    ++value(it).repLen;
+    return true;
+}
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TSpec, typename TObject>
+inline bool _extendLeftObject(Iter<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+                              TObject const & obj, False)
+{
+    return _extendLeftChar(it, obj);
+}
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TSpec, typename TObject>
+inline bool _extendLeftObject(Iter<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+                              TObject const & obj, True)
+{
+    typedef typename Iterator<TObject const, Standard>::Type TObjectIter;
+
+    for (TObjectIter objIt = end(obj, Standard()); objIt != begin(obj, Standard());)
+        if (!_extendLeftChar(it, value(--objIt)))
+            return false;
+
+    return true;
+}
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TSpec, typename TObject>
+inline bool extendLeft(Iter<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+                       TObject const & obj)
+{
+    return _extendLeftObject(it, obj, typename IsSequence<TObject>::Type());
+}
+
+// ----------------------------------------------------------------------------
+// Function extendRight()                                            [Iterator]
+// ----------------------------------------------------------------------------
+
+/**
+.Function.extendRight:
+..summary:Appends a character or a string to the representative of a bidirectional FM index iterator.
+..cat:Index
+..signature:extendRight(iterator, object)
+..class:Spec.BidirectionalFMIndex
+..param.iterator:A top-down iterator of a @Spec.BidirectionalFMIndex@.
+..param.object:The character or string to append.
+..returns:$true$ if the extended representative occurs in the text, otherwise $false$.
+If a string cannot be appended completely, the iterator represents the longest prefix of the string that was appended.
+...type:nolink:bool
+..see:Function.extendLeft
+..include:seqan/index.h
+*/
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TSpec, typename TChar>
+inline bool _extendRightChar(Iter<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+                             TChar c)
+{
+    typedef typename VertexDescriptor<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> > >::Type TVertexDesc;
+
+    TVertexDesc vDesc = value(it);
+    if (!_extendRange(container(it).rev.lfTable, vDesc.revRange, vDesc.range, c))
+        return false;
+
+    _historyPush(it);
+    value(it) = vDesc;
+    ++value(it).repLen;
+    return true;
+}
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TSpec, typename TObject>
+inline bool _extendRightObject(Iter<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+                               TObject const & obj, False)
+{
+    return _extendRightChar(it, obj);
+}
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TSpec, typename TObject>
+inline bool _extendRightObject(Iter<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+                               TObject const & obj, True)
+{
+    typedef typename Iterator<TObject const, Standard>::Type TObjectIter;
+
+    for (TObjectIter objIt = begin(obj, Standard()); objIt != end(obj, Standard()); ++objIt)
+        if (!_extendRightChar(it, value(objIt)))
+            return false;
+
+    return true;
+}
+
+template <typename TText, typename TOccSpec, typename TIndexSpec, typename TSpec, typename TObject>
+inline bool extendRight(Iter<Index<TText, BidirectionalFMIndex<TOccSpec, TIndexSpec> >, VSTree<TopDown<TSpec> > > & it,
+                        TObject const & obj)
+{
+    return _extendRightObject(it, obj, typename IsSequence<TObject>::Type());
+}
+
+}
+#endif  // INDEX_FM_BIDIRECTIONAL_H_
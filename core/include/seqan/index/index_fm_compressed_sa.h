@@ -278,6 +278,24 @@ inline bool entryStored(CompressedSA<TSparseString, TLfTable, TSpec> & compresse
     return entryStored(getFibre(compressedSA, FibreSparseString()), pos);
 }
 
+// ==========================================================================
+// Number of suffix array entries that are copied into memory and processed in parallel at once during the
+// construction of an FM index.  The suffix array may be an external string, which must not be accessed concurrently.
+struct SaChunk_
+{
+    static const unsigned SIZE = 4 * 1024 * 1024;
+};
+
+// This function copies the next chunk of a suffix array into memory and advances the iterator.
+template <typename TBuffer, typename TSAIter, typename TSize>
+inline void _copySaChunk(TBuffer & buffer, TSAIter & saIt, TSize chunkSize)
+{
+    resize(buffer, chunkSize, Exact());
+    typename Iterator<TBuffer, Standard>::Type bufIt = begin(buffer, Standard());
+    for (TSize i = 0; i < chunkSize; ++i, ++saIt, ++bufIt)
+        *bufIt = getValue(saIt);
+}
+
 // ==========================================================================
 // This function creates a compressed suffix array using a normal one.
 /**
@@ -291,6 +309,7 @@ inline bool entryStored(CompressedSA<TSparseString, TLfTable, TSpec> & compresse
 ...type:Concept.UnsignedIntegerConcept
 ...remarks:A compression factor of x means that the compressed suffix array specifically stores a value for every x values in the complete suffix array.
 ..param:offset:Number of elements at the beginning which should contain the default value.
+..remarks:The suffix array is processed in chunks, the entries of each chunk are sampled in parallel if OpenMP is enabled.
 ..include:seqan/index.h
 */
 template <typename TSparseString, typename TLfTable, typename TSpec, typename TSA, typename TCompression, typename TSize>
@@ -301,6 +320,7 @@ void createCompressedSa(CompressedSA<TSparseString, TLfTable, TSpec> & compresse
 {
     typedef CompressedSA<TSparseString, TLfTable, TSpec>            TCompressedSA;
     typedef typename Size<TSA>::Type                                TSASize;
+    typedef typename Value<TSA>::Type                               TSAValue;
     typedef typename Fibre<TCompressedSA, FibreSparseString>::Type  TSparseSA;
     typedef typename Fibre<TSparseSA, FibreIndicatorString>::Type   TIndicatorString;
     typedef typename Iterator<TSA const, Standard>::Type            TSAIter;
@@ -310,29 +330,50 @@ void createCompressedSa(CompressedSA<TSparseString, TLfTable, TSpec> & compresse
 
     TSASize saLen = length(sa);
     resize(compressedSA, saLen + offset, Exact());
-    
-    TSAIter saIt = begin(sa, Standard());
-    TSAIter saItEnd = end(sa, Standard());
 
-    for (TSASize pos = offset; saIt != saItEnd; ++saIt, ++pos)
+    __int64 const bitsPerWord = BitsPerValue<typename Value<typename Fibre<TIndicatorString, FibreBits>::Type>::Type>::VALUE;
+    String<TSAValue> buffer;
+
+    // Mark the sampled entries.  Each thread sets the bits of whole words of the indicator string.
+    TSAIter saIt = begin(sa, Standard());
+    for (TSASize chunkBegin = 0; chunkBegin < saLen; chunkBegin += SaChunk_::SIZE)
     {
-        if (getSeqOffset(getValue(saIt)) % compressionFactor == 0)
-            setBit(indicatorString, pos);
-        else
-            clearBit(indicatorString, pos);
+        TSASize chunkSize = std::min(saLen - chunkBegin, (TSASize)SaChunk_::SIZE);
+        _copySaChunk(buffer, saIt, chunkSize);
+
+        __int64 beginPos = offset + chunkBegin;
+        __int64 endPos = beginPos + chunkSize;
+        __int64 beginWord = beginPos / bitsPerWord;
+        __int64 endWord = (endPos + bitsPerWord - 1) / bitsPerWord;
+        SEQAN_OMP_PRAGMA(parallel for schedule(static))
+        for (__int64 w = beginWord; w < endWord; ++w)
+        {
+            __int64 end = std::min(endPos, (w + 1) * bitsPerWord);
+            for (__int64 pos = std::max(beginPos, w * bitsPerWord); pos < end; ++pos)
+            {
+                if (getSeqOffset(buffer[pos - beginPos]) % compressionFactor == 0)
+                    setBit(indicatorString, pos);
+                else
+                    clearBit(indicatorString, pos);
+            }
+        }
     }
     _updateRanks(indicatorString);
 
     resize(sparseString.valueString, getRank(indicatorString, length(indicatorString) - 1), Exact());
 
+    // Store the sampled entries, their positions in the value string are given by the ranks.
     saIt = begin(sa, Standard());
-    for (TSASize pos = offset, counter = 0; saIt != saItEnd; ++saIt, ++pos)
+    for (TSASize chunkBegin = 0; chunkBegin < saLen; chunkBegin += SaChunk_::SIZE)
     {
-        if (isBitSet(indicatorString, pos))
-        {
-            assignValue(compressedSA.sparseString.valueString, counter, getValue(saIt));
-            ++counter;
-        }
+        TSASize chunkSize = std::min(saLen - chunkBegin, (TSASize)SaChunk_::SIZE);
+        _copySaChunk(buffer, saIt, chunkSize);
+
+        __int64 beginPos = offset + chunkBegin;
+        SEQAN_OMP_PRAGMA(parallel for schedule(static))
+        for (__int64 i = 0; i < (__int64)chunkSize; ++i)
+            if (isBitSet(indicatorString, beginPos + i))
+                assignValue(sparseString.valueString, getRank(indicatorString, beginPos + i) - 1, buffer[i]);
     }
 }
 
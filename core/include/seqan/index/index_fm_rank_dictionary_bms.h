@@ -258,6 +258,18 @@ getFibre(RankDictionary<SequenceBitMask<TValue> > const &dictionary, FibreBitStr
     return dictionary.bitStrings;
 }
 
+// ----------------------------------------------------------------------------
+// Function _prefetchOccurrences
+// ----------------------------------------------------------------------------
+
+// This function prefetches the entries read by countOccurrences().
+template <typename TValue, typename TCharIn, typename TPos>
+inline void _prefetchOccurrences(RankDictionary<SequenceBitMask<TValue> > const & dictionary,
+                                 TCharIn const character, TPos const pos)
+{
+    _prefetchRank(dictionary.bitStrings[ordValue(TValue(character))], pos);
+}
+
 // ----------------------------------------------------------------------------
 // Function countOccurrences
 // ----------------------------------------------------------------------------
@@ -297,9 +309,18 @@ inline void createRankDictionary(RankDictionary<SequenceBitMask<TValue> > & dict
 
     for (unsigned i = 0; i < ValueSize<TValue>::VALUE; ++i)
         resize(bitStrings[i], length(text), 0, Exact());
-    
-    for (unsigned i = 0; i < length(text); ++i)
-        setBitTo(bitStrings[ordValue(text[i])], i, 1);
+
+    // The text is processed in parallel, each thread sets the bits of whole words.
+    __int64 const bitsPerWord = BitsPerValue<typename Value<typename Fibre<RankSupportBitString<void>, FibreBits>::Type>::Type>::VALUE;
+    __int64 textLength = length(text);
+    __int64 numWords = (textLength + bitsPerWord - 1) / bitsPerWord;
+    SEQAN_OMP_PRAGMA(parallel for schedule(static))
+    for (__int64 w = 0; w < numWords; ++w)
+    {
+        __int64 end = std::min(textLength, (w + 1) * bitsPerWord);
+        for (__int64 i = w * bitsPerWord; i < end; ++i)
+            setBitTo(bitStrings[ordValue(text[i])], i, 1);
+    }
 
     for (unsigned i = 0; i < ValueSize<TValue>::VALUE; ++i)
         _updateRanks(bitStrings[i]);
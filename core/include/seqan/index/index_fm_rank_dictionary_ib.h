@@ -0,0 +1,534 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+
+#ifndef INDEX_FM_RANKDICTIONARY_IB
+#define INDEX_FM_RANKDICTIONARY_IB
+
+namespace seqan {
+
+// ==========================================================================
+// Forwards
+// ==========================================================================
+
+template <typename TValue, typename TSpec = Alloc<> >
+class InterleavedBlocks;
+
+template<typename TSpec>
+class RankDictionary;
+
+template <typename TValue>
+struct InterleavedBlock_;
+
+// ==========================================================================
+// Tags
+// ==========================================================================
+
+/**
+.Tag.IB
+..summary:Tag that specifies the @Spec.FMIndex@ to use an interleaved block rank dictionary as the occurrence table.
+..cat:Index
+..remarks:IB = InterleavedBlocks. Only applicable to small alphabets, such as @Spec.Dna@ or @Spec.Dna5@.
+*/
+template <typename TSpec = void>
+class IB;
+
+// ==========================================================================
+// Metafunctions
+// ==========================================================================
+
+/**
+.Spec.InterleavedBlocks Fibres
+..cat:Index
+..summary:Tag to select a specific fibre of an InterleavedBlocks rank dictionary.
+..remarks:These tags can be used to get @Metafunction.Fibre.Fibres@ of an InterleavedBlocks rank dictionary.
+
+..DISABLED.tag.FibreBlocks:The string of blocks, each storing the counters and the packed characters.
+
+..see:Metafunction.Fibre
+..see:Function.getFibre
+..include:seqan/index.h
+*/
+
+// ----------------------------------------------------------------------------
+// Metafunction Fibre
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec>
+struct Fibre<RankDictionary<InterleavedBlocks<TValue, TSpec> >, FibreBlocks>
+{
+    typedef String<InterleavedBlock_<TValue>, TSpec> Type;
+};
+
+template <typename TValue, typename TSpec>
+struct Fibre<RankDictionary<InterleavedBlocks<TValue, TSpec> > const, FibreBlocks>
+{
+    typedef typename Fibre<RankDictionary<InterleavedBlocks<TValue, TSpec> >, FibreBlocks>::Type const Type;
+};
+
+// ----------------------------------------------------------------------------
+// Metafunction Size
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec>
+struct Size<RankDictionary<InterleavedBlocks<TValue, TSpec> > >
+{
+    typedef typename Size<String<TValue> >::Type Type;
+};
+
+template <typename TValue, typename TSpec>
+struct Size<RankDictionary<InterleavedBlocks<TValue, TSpec> > const> :
+    public Size<RankDictionary<InterleavedBlocks<TValue, TSpec> > > {};
+
+// ----------------------------------------------------------------------------
+// Metafunction Value
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec>
+struct Value<RankDictionary<InterleavedBlocks<TValue, TSpec> > >
+{
+    typedef TValue Type;
+};
+
+template <typename TValue, typename TSpec>
+struct Value<RankDictionary<InterleavedBlocks<TValue, TSpec> > const> :
+    public Value<RankDictionary<InterleavedBlocks<TValue, TSpec> > > {};
+
+// ----------------------------------------------------------------------------
+// Metafunction InterleavedFieldOnes_
+// ----------------------------------------------------------------------------
+
+// A word with the lowest bit of each of the COUNT fields of BITS bits set.
+template <unsigned BITS, unsigned COUNT>
+struct InterleavedFieldOnes_
+{
+    static const __uint64 VALUE = (InterleavedFieldOnes_<BITS, COUNT - 1>::VALUE << BITS) | 1ull;
+};
+
+template <unsigned BITS>
+struct InterleavedFieldOnes_<BITS, 0>
+{
+    static const __uint64 VALUE = 0ull;
+};
+
+// ==========================================================================
+// Classes
+// ==========================================================================
+
+// ----------------------------------------------------------------------------
+// Class InterleavedBlock_
+// ----------------------------------------------------------------------------
+
+// A block occupies exactly one cache line (64 bytes). The first ValueSize words
+// store the number of occurrences of each character before the block, the
+// remaining words store the characters of the block with BitsPerValue bits each.
+// A rank query therefore touches a single cache line.
+template <typename TValue>
+struct InterleavedBlock_
+{
+    enum
+    {
+        SIGMA = ValueSize<TValue>::VALUE,
+        BITS_PER_VALUE = BitsPerValue<TValue>::VALUE,
+        WORDS = 8 - SIGMA,
+        VALUES_PER_WORD = 64 / BITS_PER_VALUE,
+        VALUES = WORDS * VALUES_PER_WORD
+    };
+
+    __uint64 counts[SIGMA];
+    __uint64 words[WORDS];
+};
+
+// ----------------------------------------------------------------------------
+// Spec InterleavedBlocks
+// ----------------------------------------------------------------------------
+
+/**
+.Spec.InterleavedBlocks:
+..cat:Index
+..summary:A rank dictionary storing the text and the occurrence counters interleaved in cache line sized blocks.
+..signature:InterleavedBlocks<TValue[, TSpec]>
+..param.TValue:The value type of the rank dictionary.
+..param.TSpec:The @Class.String@ specialization of the blocks.
+...remarks:With @Spec.MMap String@ a saved dictionary is mapped into memory by @Function.open@ instead of being read.
+...default:$Alloc<>$
+..include:seqan/index.h
+..remarks:Each block of 64 bytes stores the number of occurrences of every character before the block followed by
+the bit packed characters of the block (128 characters for @Spec.Dna@, 63 for @Spec.Dna5@). A call of
+@Function.RankDictionary#countOccurrences@ loads only one cache line and counts the matching characters inside the
+block with popcount instructions.
+..remarks:This data structure is only applicable to very small alphabets, such as @Spec.Dna@ or @Spec.Dna5@. Consider
+using a @Spec.SequenceBitMask@ or a @Spec.WaveletTree@ otherwise.
+*/
+template <typename TValue, typename TSpec>
+class RankDictionary<InterleavedBlocks<TValue, TSpec> >
+{
+    typedef typename Fibre<RankDictionary<InterleavedBlocks<TValue, TSpec> >, FibreBlocks>::Type   TBlocks;
+
+    SEQAN_STATIC_ASSERT_MSG(ValueSize<TValue>::VALUE < 8, "InterleavedBlocks only supports alphabets of size < 8.");
+
+public:
+    TBlocks blocks;
+
+    RankDictionary() {}
+
+    template <typename TText>
+    RankDictionary(TText const & text)
+    {
+        createRankDictionary(*this, text);
+    }
+
+    RankDictionary & operator=(RankDictionary const & other)
+    {
+        blocks = other.blocks;
+        return *this;
+    }
+
+    bool operator==(RankDictionary const & b) const
+    {
+        typedef typename Size<TBlocks>::Type TSize;
+
+        if (length(blocks) != length(b.blocks))
+            return false;
+
+        for (TSize i = 0; i < length(blocks); ++i)
+        {
+            for (unsigned j = 0; j < InterleavedBlock_<TValue>::SIGMA; ++j)
+                if (blocks[i].counts[j] != b.blocks[i].counts[j])
+                    return false;
+            for (unsigned j = 0; j < InterleavedBlock_<TValue>::WORDS; ++j)
+                if (blocks[i].words[j] != b.blocks[i].words[j])
+                    return false;
+        }
+
+        return true;
+    }
+};
+
+// ==========================================================================
+//Functions
+// ==========================================================================
+
+// ----------------------------------------------------------------------------
+// Function allocate
+// ----------------------------------------------------------------------------
+
+// The blocks are aligned to cache lines.
+template <typename TValue, typename TSpec, typename TSize, typename TUsage>
+inline void
+allocate(String<InterleavedBlock_<TValue>, Alloc<TSpec> > const &,
+         InterleavedBlock_<TValue> * & data,
+         TSize count,
+         Tag<TUsage> const &)
+{
+#ifdef PLATFORM_WINDOWS_VS
+    data = (InterleavedBlock_<TValue> *) _aligned_malloc(count * sizeof(InterleavedBlock_<TValue>), 64);
+#else
+    if (posix_memalign(&(void* &)data, 64, count * sizeof(InterleavedBlock_<TValue>)))
+        data = NULL;
+#endif
+
+#ifdef SEQAN_PROFILE
+    if (data)
+        SEQAN_PROADD(SEQAN_PROMEMORY, count * sizeof(InterleavedBlock_<TValue>));
+#endif
+}
+
+template <typename TValue, typename TSpec, typename TSize, typename TUsage>
+inline void
+allocate(String<InterleavedBlock_<TValue>, Alloc<TSpec> > & me,
+         InterleavedBlock_<TValue> * & data,
+         TSize count,
+         Tag<TUsage> const & tag)
+{
+    allocate(const_cast<String<InterleavedBlock_<TValue>, Alloc<TSpec> > const &>(me), data, count, tag);
+}
+
+// ----------------------------------------------------------------------------
+// Function deallocate
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TSize, typename TUsage>
+inline void
+deallocate(String<InterleavedBlock_<TValue>, Alloc<TSpec> > const &,
+           InterleavedBlock_<TValue> * data,
+#ifdef SEQAN_PROFILE
+           TSize count,
+#else
+           TSize,
+#endif
+           Tag<TUsage> const)
+{
+#ifdef SEQAN_PROFILE
+    if (data && count)
+        SEQAN_PROSUB(SEQAN_PROMEMORY, count * sizeof(InterleavedBlock_<TValue>));
+#endif
+#ifdef PLATFORM_WINDOWS_VS
+    _aligned_free((void *) data);
+#else
+    free((void *) data);
+#endif
+}
+
+template <typename TValue, typename TSpec, typename TSize, typename TUsage>
+inline void
+deallocate(String<InterleavedBlock_<TValue>, Alloc<TSpec> > & me,
+           InterleavedBlock_<TValue> * data,
+           TSize count,
+           Tag<TUsage> const tag)
+{
+    deallocate(const_cast<String<InterleavedBlock_<TValue>, Alloc<TSpec> > const &>(me), data, count, tag);
+}
+
+// ----------------------------------------------------------------------------
+// Function clear
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec>
+inline void clear(RankDictionary<InterleavedBlocks<TValue, TSpec> > & dictionary)
+{
+    clear(getFibre(dictionary, FibreBlocks()));
+}
+
+// ----------------------------------------------------------------------------
+// Function empty
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec>
+inline bool empty(RankDictionary<InterleavedBlocks<TValue, TSpec> > const & dictionary)
+{
+    return empty(getFibre(dictionary, FibreBlocks()));
+}
+
+// ----------------------------------------------------------------------------
+// Function getValue
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TPos>
+inline TValue
+getValue(RankDictionary<InterleavedBlocks<TValue, TSpec> > const & dictionary, TPos pos)
+{
+    typedef InterleavedBlock_<TValue> TBlock;
+
+    TBlock const & block = dictionary.blocks[pos / TBlock::VALUES];
+    unsigned posInBlock = pos % TBlock::VALUES;
+    __uint64 word = block.words[posInBlock / TBlock::VALUES_PER_WORD];
+    unsigned shift = (posInBlock % TBlock::VALUES_PER_WORD) * TBlock::BITS_PER_VALUE;
+
+    return TValue((unsigned)((word >> shift) & ((1ull << TBlock::BITS_PER_VALUE) - 1)));
+}
+
+template <typename TValue, typename TSpec, typename TPos>
+inline TValue
+getValue(RankDictionary<InterleavedBlocks<TValue, TSpec> > & dictionary, TPos pos)
+{
+    return getValue(const_cast<RankDictionary<InterleavedBlocks<TValue, TSpec> > const &>(dictionary), pos);
+}
+
+// ----------------------------------------------------------------------------
+// Function getFibre
+// ----------------------------------------------------------------------------
+
+///.Function.RankDictionary#getFibre.param.fibreTag.type:Spec.InterleavedBlocks Fibres
+template <typename TValue, typename TSpec>
+inline typename Fibre<RankDictionary<InterleavedBlocks<TValue, TSpec> >, FibreBlocks>::Type &
+getFibre(RankDictionary<InterleavedBlocks<TValue, TSpec> > & dictionary, FibreBlocks)
+{
+    return dictionary.blocks;
+}
+
+template <typename TValue, typename TSpec>
+inline typename Fibre<RankDictionary<InterleavedBlocks<TValue, TSpec> >, FibreBlocks>::Type const &
+getFibre(RankDictionary<InterleavedBlocks<TValue, TSpec> > const & dictionary, FibreBlocks)
+{
+    return dictionary.blocks;
+}
+
+// ----------------------------------------------------------------------------
+// Function _matchFields
+// ----------------------------------------------------------------------------
+
+// Returns a word with the lowest bit of every field set that equals the character.
+template <typename TValue>
+inline __uint64
+_matchFields(__uint64 word, unsigned ordChar)
+{
+    typedef InterleavedBlock_<TValue> TBlock;
+    __uint64 const ones = InterleavedFieldOnes_<TBlock::BITS_PER_VALUE, TBlock::VALUES_PER_WORD>::VALUE;
+
+    // Fields equal to the character become all ones.
+    __uint64 x = ~(word ^ (ones * ordChar));
+    __uint64 result = x;
+    for (unsigned i = 1; i < (unsigned)TBlock::BITS_PER_VALUE; ++i)
+        result &= x >> i;
+    return result & ones;
+}
+
+// ----------------------------------------------------------------------------
+// Function _prefetchOccurrences
+// ----------------------------------------------------------------------------
+
+// This function prefetches the single cache line read by countOccurrences().
+template <typename TValue, typename TSpec, typename TCharIn, typename TPos>
+inline void _prefetchOccurrences(RankDictionary<InterleavedBlocks<TValue, TSpec> > const & dictionary,
+                                 TCharIn const /*character*/, TPos const pos)
+{
+    _prefetchAddress(begin(dictionary.blocks, Standard()) + pos / InterleavedBlock_<TValue>::VALUES);
+}
+
+// ----------------------------------------------------------------------------
+// Function countOccurrences
+// ----------------------------------------------------------------------------
+
+// This functions computes the number of occurrences of a specified character
+// up to a specified position.
+template <typename TValue, typename TSpec, typename TCharIn, typename TPos>
+inline typename Size<RankDictionary<InterleavedBlocks<TValue, TSpec> > const>::Type
+countOccurrences(RankDictionary<InterleavedBlocks<TValue, TSpec> > const & dictionary,
+                 TCharIn const character, TPos const pos)
+{
+    typedef InterleavedBlock_<TValue> TBlock;
+
+    unsigned ordChar = ordValue(TValue(character));
+    TBlock const & block = dictionary.blocks[pos / TBlock::VALUES];
+    unsigned posInBlock = pos % TBlock::VALUES;
+    unsigned wordPos = posInBlock / TBlock::VALUES_PER_WORD;
+    unsigned posInWord = posInBlock % TBlock::VALUES_PER_WORD;
+
+    typename Size<RankDictionary<InterleavedBlocks<TValue, TSpec> > const>::Type occ = block.counts[ordChar];
+    for (unsigned i = 0; i < wordPos; ++i)
+        occ += popCount(_matchFields<TValue>(block.words[i], ordChar));
+
+    __uint64 mask = ~0ull >> (64 - (posInWord + 1) * TBlock::BITS_PER_VALUE);
+    return occ + popCount(_matchFields<TValue>(block.words[wordPos], ordChar) & mask);
+}
+
+template <typename TValue, typename TSpec, typename TCharIn, typename TPos>
+inline typename Size<RankDictionary<InterleavedBlocks<TValue, TSpec> > >::Type
+countOccurrences(RankDictionary<InterleavedBlocks<TValue, TSpec> > & dictionary, TCharIn const character,
+                 TPos const pos)
+{
+    return countOccurrences(const_cast<RankDictionary<InterleavedBlocks<TValue, TSpec> > const &>(dictionary), character, pos);
+}
+
+// ----------------------------------------------------------------------------
+// Function createRankDictionary
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec, typename TText>
+inline void createRankDictionary(RankDictionary<InterleavedBlocks<TValue, TSpec> > & dictionary, TText const & text)
+{
+    typedef InterleavedBlock_<TValue> TBlock;
+    typedef typename Fibre<RankDictionary<InterleavedBlocks<TValue, TSpec> >, FibreBlocks>::Type TBlocks;
+
+    TBlocks & blocks = getFibre(dictionary, FibreBlocks());
+
+    __int64 textLength = length(text);
+    __int64 numBlocks = (textLength + TBlock::VALUES - 1) / TBlock::VALUES;
+    resize(blocks, numBlocks, Exact());
+
+    // The blocks are filled in parallel, each one counting its own characters.
+    SEQAN_OMP_PRAGMA(parallel for schedule(static))
+    for (__int64 b = 0; b < numBlocks; ++b)
+    {
+        TBlock & block = blocks[b];
+        for (unsigned j = 0; j < TBlock::SIGMA; ++j)
+            block.counts[j] = 0;
+        for (unsigned j = 0; j < TBlock::WORDS; ++j)
+            block.words[j] = 0;
+
+        __int64 end = std::min(textLength, (b + 1) * (__int64)TBlock::VALUES);
+        for (__int64 i = b * TBlock::VALUES; i < end; ++i)
+        {
+            unsigned posInBlock = i - b * TBlock::VALUES;
+            unsigned ordChar = ordValue(TValue(text[i]));
+            block.words[posInBlock / TBlock::VALUES_PER_WORD] |=
+                (__uint64)ordChar << ((posInBlock % TBlock::VALUES_PER_WORD) * TBlock::BITS_PER_VALUE);
+            ++block.counts[ordChar];
+        }
+    }
+
+    // Turn the per block counts into the number of occurrences before each block.
+    __uint64 sums[TBlock::SIGMA] = {0};
+    for (__int64 b = 0; b < numBlocks; ++b)
+        for (unsigned j = 0; j < TBlock::SIGMA; ++j)
+        {
+            __uint64 count = blocks[b].counts[j];
+            blocks[b].counts[j] = sums[j];
+            sums[j] += count;
+        }
+}
+
+template <typename TValue, typename TSpec, typename TSentinelSpec, typename TPrefixSumTable, typename TText>
+inline void createRankDictionary(LfTable<SentinelRankDictionary<RankDictionary<InterleavedBlocks<TValue, TSpec> >, TSentinelSpec >, TPrefixSumTable> & lfTable,
+                                 TText const & text)
+{
+    createRankDictionary(getFibre(getFibre(lfTable, FibreOccTable()), FibreRankDictionary()), text);
+}
+
+// ----------------------------------------------------------------------------
+// Function open
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec>
+inline bool open(RankDictionary<InterleavedBlocks<TValue, TSpec> > & dictionary, const char * fileName, int openMode)
+{
+    String<char> name;
+    name = fileName;    append(name, ".rd"); if (!open(getFibre(dictionary, FibreBlocks()), toCString(name), openMode)) return false;
+    return true;
+}
+
+template <typename TValue, typename TSpec>
+inline bool open(RankDictionary<InterleavedBlocks<TValue, TSpec> > & dictionary, const char * fileName)
+{
+    return open(dictionary, fileName, DefaultOpenMode<RankDictionary<InterleavedBlocks<TValue, TSpec> > >::VALUE);
+}
+
+// ----------------------------------------------------------------------------
+// Function save
+// ----------------------------------------------------------------------------
+
+template <typename TValue, typename TSpec>
+inline bool save(RankDictionary<InterleavedBlocks<TValue, TSpec> > const & dictionary, const char * fileName, int openMode)
+{
+    String<char> name;
+    name = fileName;    append(name, ".rd"); if (!save(getFibre(dictionary, FibreBlocks()), toCString(name), openMode)) return false;
+    return true;
+}
+
+template <typename TValue, typename TSpec>
+inline bool save(RankDictionary<InterleavedBlocks<TValue, TSpec> > const & dictionary, const char * fileName)
+{
+    return save(dictionary, fileName, DefaultOpenMode<RankDictionary<InterleavedBlocks<TValue, TSpec> > >::VALUE);
+}
+
+}
+#endif  // INDEX_FM_RANKDICTIONARY_IB
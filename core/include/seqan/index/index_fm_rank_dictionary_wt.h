@@ -172,6 +172,7 @@ sequence.
 ..param.TSpec:The rank dictionary specialisation.
 ...type:Spec.WaveletTree
 ...type:Spec.SequenceBitMask
+...type:Spec.InterleavedBlocks
 ...default:@Spec.WaveletTree@
 ..include:seqan/index.h
 */
@@ -402,6 +403,20 @@ getFibre(RankDictionary<WaveletTree<TValue> > const & dictionary, const FibreTre
     return dictionary.waveletTreeStructure;
 }
 
+// ----------------------------------------------------------------------------
+// Function _prefetchOccurrences
+// ----------------------------------------------------------------------------
+
+// This function prefetches the root node entries read first by countOccurrences().
+// Deeper levels depend on the rank computed at the root and cannot be prefetched.
+template <typename TValue, typename TCharIn, typename TPos>
+inline void _prefetchOccurrences(RankDictionary<WaveletTree<TValue> > const & tree, TCharIn const /*character*/,
+                                 TPos const pos)
+{
+    if (!empty(tree.bitStrings))
+        _prefetchRank(tree.bitStrings[0], pos);
+}
+
 // ----------------------------------------------------------------------------
 // Function countOccurrences
 // ----------------------------------------------------------------------------
@@ -470,46 +485,122 @@ inline unsigned countOccurrences(RankDictionary<WaveletTree<TValue> > const & tr
 // Function _fillWaveletTree
 // ----------------------------------------------------------------------------
 
-// This function is used to fill the bit strings of the wavelet tree.
+// This function is used to fill the bit strings of the wavelet tree.  The text is split into one chunk per thread.
+// The characters of each chunk are counted first to determine the positions of the chunk's bits in the bit string of
+// each node, then the chunks are processed in parallel.  Words shared by two chunks are written atomically.
 template <typename TValue, typename TText>
 inline void _fillWaveletTree(RankDictionary<WaveletTree<TValue> > & tree, TText const & text)
 {
     typedef typename Fibre<RankDictionary<WaveletTree<TValue> >, FibreBitStrings>::Type     TFibreRankSupportBitStrings;
     typedef typename Value<TFibreRankSupportBitStrings>::Type                               TFibreRankSupportBitString;
     typedef typename Fibre<TFibreRankSupportBitString, FibreBits>::Type                     TFibreBitString;
-    typedef typename Size<TFibreBitString>::Type                                            TSize;
+    typedef typename Value<TFibreBitString>::Type                                           TFibreBitStringValue;
     typedef typename Fibre<RankDictionary<WaveletTree<TValue> >, FibreTreeStructure>::Type  TWaveletTreeStructure;
 
-    resize(tree.bitStrings, _length(tree.waveletTreeStructure), Exact());
-
-    for (TSize i = 0; i < length(text); ++i)
+    unsigned const sigma = ValueSize<TValue>::VALUE;
+    unsigned const bitsPerWord = BitsPerValue<TFibreBitStringValue>::VALUE;
+    unsigned numNodes = _length(tree.waveletTreeStructure);
+    TFibreRankSupportBitStrings & bitStrings = getFibre(tree, FibreBitStrings());
+    resize(bitStrings, numNodes, Exact());
+    if (numNodes == 0u)
+        return;
+
+    // Count the characters in each chunk.
+#ifdef _OPENMP
+    int numChunks = omp_get_max_threads();
+#else
+    int numChunks = 1;
+#endif
+    __int64 textLength = length(text);
+    String<__int64> splitters;
+    computeSplitters(splitters, textLength, numChunks);
+    String<__int64> counts;
+    resize(counts, numChunks * sigma, 0, Exact());
+    SEQAN_OMP_PRAGMA(parallel for schedule(static))
+    for (int t = 0; t < numChunks; ++t)
+        for (__int64 i = splitters[t]; i < splitters[t + 1]; ++i)
+            ++counts[t * sigma + ordValue(getValue(text, i))];
+
+    // Compute the path of each occurring character through the tree, an entry is (node << 1) | bit.
+    String<String<unsigned> > paths;
+    resize(paths, sigma, Exact());
+    for (unsigned c = 0; c < sigma; ++c)
     {
-        typename Iterator<TWaveletTreeStructure, TopDown<> >::Type it(tree.waveletTreeStructure, 0);
-        bool bit;
+        bool occurs = false;
+        for (int t = 0; t < numChunks && !occurs; ++t)
+            occurs = counts[t * sigma + c] != 0;
+        if (!occurs)
+            continue;
 
+        typename Iterator<TWaveletTreeStructure, TopDown<> >::Type it(tree.waveletTreeStructure, 0);
         while (true)
         {
-            // decide whether the character is smaller then the pivot element of the current node 
-            if (ordGreater(getCharacter(it), getValue(text, i)))
-            {
-                bit = 0;
-                appendValue(getFibre(tree, FibreBitStrings())[getPosition(it)], bit);
-                if (!goLeftChild(it))
-                    break;
-            }
-            else
+            bool bit = !(ordValue(getCharacter(it)) > c);
+            appendValue(paths[c], (getPosition(it) << 1) | bit);
+            if (!(bit ? goRightChild(it) : goLeftChild(it)))
+                break;
+        }
+    }
+
+    // Compute the begin position of each chunk in the bit string of each node.
+    String<__int64> offsets;
+    resize(offsets, numChunks * numNodes, 0, Exact());
+    for (int t = 0; t < numChunks; ++t)
+        for (unsigned c = 0; c < sigma; ++c)
+            for (unsigned j = 0; j < length(paths[c]); ++j)
+                offsets[t * numNodes + (paths[c][j] >> 1)] += counts[t * sigma + c];
+    for (unsigned node = 0; node < numNodes; ++node)
+    {
+        __int64 sum = 0;
+        for (int t = 0; t < numChunks; ++t)
+        {
+            __int64 count = offsets[t * numNodes + node];
+            offsets[t * numNodes + node] = sum;
+            sum += count;
+        }
+        resize(bitStrings[node], sum, 0, Exact());
+    }
+
+    // Set the bits of each chunk, each thread collects the bits of the current word of each node.
+    SEQAN_OMP_PRAGMA(parallel for schedule(static))
+    for (int t = 0; t < numChunks; ++t)
+    {
+        String<__int64> pos;
+        resize(pos, numNodes, Exact());
+        String<__int64> wordPos;
+        resize(wordPos, numNodes, 0, Exact());
+        String<TFibreBitStringValue> words;
+        resize(words, numNodes, 0, Exact());
+        for (unsigned node = 0; node < numNodes; ++node)
+            pos[node] = offsets[t * numNodes + node];
+
+        for (__int64 i = splitters[t]; i < splitters[t + 1]; ++i)
+        {
+            String<unsigned> const & path = paths[ordValue(getValue(text, i))];
+            for (unsigned j = 0; j < length(path); ++j)
             {
-                bit = 1;
-                appendValue(getFibre(tree, FibreBitStrings())[getPosition(it)], bit);
-                if (!goRightChild(it))
-                    break;
+                unsigned node = path[j] >> 1;
+                __int64 p = pos[node]++;
+                if (!(path[j] & 1u))
+                    continue;
+                if (p / bitsPerWord != wordPos[node])
+                {
+                    if (words[node] != 0u)
+                        atomicOr(bitStrings[node].bits[wordPos[node]], words[node]);
+                    wordPos[node] = p / bitsPerWord;
+                    words[node] = 0;
+                }
+                words[node] |= (TFibreBitStringValue)1u << (p % bitsPerWord);
             }
         }
+
+        for (unsigned node = 0; node < numNodes; ++node)
+            if (words[node] != 0u)
+                atomicOr(bitStrings[node].bits[wordPos[node]], words[node]);
     }
 
-    TFibreRankSupportBitStrings & bitStrings = getFibre(tree, FibreBitStrings());
-    for (TSize i = 0; i < length(bitStrings); ++i)
-        _updateRanks(bitStrings[i]);
+    for (unsigned node = 0; node < numNodes; ++node)
+        _updateRanks(bitStrings[node]);
 }
 
 // ----------------------------------------------------------------------------
@@ -37,6 +37,10 @@
 
 #include <seqan/misc/misc_bit_twiddling.h>
 
+#ifdef PLATFORM_WINDOWS_VS
+#include <xmmintrin.h>
+#endif
+
 namespace seqan {
 
 //Rank Support Bit String
@@ -296,6 +300,30 @@ getRank(RankSupportBitString<TSpec> const & bitString, TPos const pos)
          + _getRankInBlock(bitString, pos);
 }
 
+// ==========================================================================
+// This function hints the processor to load the cache line containing the
+// given address. It is a no-op on compilers without a prefetch intrinsic.
+inline void _prefetchAddress(void const * address)
+{
+#if defined(PLATFORM_WINDOWS_VS)
+    _mm_prefetch(static_cast<char const *>(address), _MM_HINT_T0);
+#elif defined(__GNUC__)
+    __builtin_prefetch(address, 0, 3);
+#else
+    (void)address;
+#endif
+}
+
+// ==========================================================================
+// This function prefetches all entries read by getRank(bitString, pos).
+template <typename TSpec, typename TPos>
+inline void _prefetchRank(RankSupportBitString<TSpec> const & bitString, TPos const pos)
+{
+    _prefetchAddress(begin(bitString.superBlocks, Standard()) + _getSuperBlockPos(bitString, pos));
+    _prefetchAddress(begin(bitString.blocks, Standard()) + _getBlockPos(bitString, pos));
+    _prefetchAddress(begin(bitString.bits, Standard()) + _getBlockPos(bitString, pos));
+}
+
 
 /**
 .Function.empty
@@ -506,10 +534,47 @@ inline void _updateRanks(RankSupportBitString<TSpec> & bitString, TPos pos)
     _updateRanksImpl(bitString, pos);
 }
 
+// This function recomputes all block and super block ranks. The super blocks are processed in parallel, each one
+// computes its block ranks and its number of set bits, which are summed up afterwards.
+template <typename TSpec>
+inline void _updateAllRanks(RankSupportBitString<TSpec> & bitString)
+{
+    typedef RankSupportBitString<TSpec>                                     TRankSupportBitString;
+    typedef typename Fibre<TRankSupportBitString, FibreBits>::Type          TFibreBits;
+    typedef typename Fibre<TRankSupportBitString, FibreSuperBlocks>::Type   TFibreSuperBlocks;
+    typedef typename Value<TFibreBits>::Type                                TFibreBitsValue;
+    typedef typename Value<TFibreSuperBlocks>::Type                         TFibreSuperBlocksValue;
+
+    if (empty(bitString))
+        return;
+
+    __int64 const bitsPerValue = BitsPerValue<TFibreBitsValue>::VALUE;
+    __int64 numBlocks = length(bitString.bits);
+    __int64 numSuperBlocks = (numBlocks + bitsPerValue - 1) / bitsPerValue;
+    String<TFibreSuperBlocksValue> superBlockCounts;
+    resize(superBlockCounts, numSuperBlocks, Exact());
+
+    SEQAN_OMP_PRAGMA(parallel for schedule(static))
+    for (__int64 k = 0; k < numSuperBlocks; ++k)
+    {
+        __int64 blockEnd = std::min(numBlocks, (k + 1) * bitsPerValue);
+        TFibreSuperBlocksValue blockSum = 0;
+        for (__int64 i = k * bitsPerValue; i < blockEnd; ++i)
+        {
+            bitString.blocks[i] = blockSum;
+            blockSum += _getRankInBlock(bitString.bits[i]);
+        }
+        superBlockCounts[k] = blockSum;
+    }
+
+    for (__int64 k = 1; k < numSuperBlocks; ++k)
+        bitString.superBlocks[k] = bitString.superBlocks[k - 1] + superBlockCounts[k - 1];
+}
+
 template <typename TSpec>
 inline void _updateRanks(RankSupportBitString<TSpec> & bitString)
 {
-    _updateRanksImpl(bitString, 0u);
+    _updateAllRanks(bitString);
 }
 
 // This function update the rank information of the last block.
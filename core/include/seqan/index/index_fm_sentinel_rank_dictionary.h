@@ -105,6 +105,12 @@ struct Fibre<SentinelRankDictionary<RankDictionary<SequenceBitMask<TValue> >, TS
     typedef RankDictionary<SequenceBitMask<TValue> > Type;
 };
 
+template <typename TValue, typename TStringSpec, typename TSpec>
+struct Fibre<SentinelRankDictionary<RankDictionary<InterleavedBlocks<TValue, TStringSpec> >, TSpec>, FibreRankDictionary>
+{
+    typedef RankDictionary<InterleavedBlocks<TValue, TStringSpec> > Type;
+};
+
 template <typename TRankDictionary, typename TSpec>
 struct Fibre<SentinelRankDictionary<TRankDictionary, TSpec> const, FibreRankDictionary>
 {
@@ -448,6 +454,34 @@ getFibre(SentinelRankDictionary<TRankDictionary, TSpec> const & dictionary, Fibr
     return dictionary.sentinelPosition;
 }
 
+// ----------------------------------------------------------------------------
+// Function _prefetchOccurrences
+// ----------------------------------------------------------------------------
+
+// This function hints the processor to load the memory read by a subsequent call
+// of countOccurrences() with the same arguments. Rank dictionaries without a
+// specialization do not prefetch anything.
+template <typename TRankDictionary, typename TChar, typename TPos>
+inline void _prefetchOccurrences(TRankDictionary const & /*dictionary*/, TChar const /*character*/,
+                                 TPos const /*pos*/)
+{}
+
+template <typename TRankDictionary, typename TChar, typename TPos>
+inline void _prefetchOccurrences(SentinelRankDictionary<TRankDictionary, Sentinel> const & dictionary,
+                                 TChar const character, TPos const pos)
+{
+    _prefetchOccurrences(getFibre(dictionary, FibreRankDictionary()), character, pos);
+}
+
+template <typename TRankDictionary, typename TChar, typename TPos>
+inline void _prefetchOccurrences(SentinelRankDictionary<TRankDictionary, Sentinels> const & dictionary,
+                                 TChar const character, TPos const pos)
+{
+    _prefetchOccurrences(getFibre(dictionary, FibreRankDictionary()), character, pos);
+    if (ordEqual(getSentinelSubstitute(dictionary), character))
+        _prefetchRank(getFibre(dictionary, FibreSentinelPosition()), pos);
+}
+
 // ----------------------------------------------------------------------------
 // Function countOccurrences
 // ----------------------------------------------------------------------------
@@ -528,6 +528,233 @@ namespace SEQAN_NAMESPACE_MAIN
 	}
 
 
+	//////////////////////////////////////////////////////////////////////////////
+    // Phi algorithm (Kaerkkaeinen, Manzini and Puglisi, "Permuted Longest-
+    // Common-Prefix Array", CPM 2009)
+    //////////////////////////////////////////////////////////////////////////////
+
+/**
+.Tag.Plcp
+..cat:Index
+..summary:Lcp table construction via the permuted lcp table (PLCP) and the Phi array.
+..signature:Plcp
+..remarks:For each text position $i$ the Phi array stores the position of the suffix that follows suffix $i$ in the suffix array.
+The lcp values are computed in text order, as in @Tag.Kasai@, but the inverse suffix array is not needed and
+the suffix array and the lcp table are only scanned sequentially.
+Besides the text, the algorithm holds one integer per character in main memory.
+..remarks:If the suffix array or the lcp table are external strings (e.g. $String<TValue, External<> >$), they are streamed from
+and to disk (semi-external construction). The text must reside in main memory.
+..see:Tag.ParallelPlcp
+..include:seqan/index.h
+
+.Tag.ParallelPlcp
+..cat:Index
+..summary:Multi-threaded lcp table construction via the permuted lcp table (PLCP) and the Phi array.
+..signature:ParallelPlcp
+..remarks:Produces the same lcp table as @Tag.Plcp@.
+If SeqAn is compiled with OpenMP, the text is split into ranges whose PLCP values are computed by different threads.
+Suffix arrays and lcp tables in main memory are also scanned in parallel.
+..include:seqan/index.h
+*/
+
+	struct Plcp {};
+	struct ParallelPlcp {};
+
+	template < 
+        typename TLCP,
+		typename TText,
+		typename TSA >
+    struct LcpCreatorRandomAccess_<TLCP, TText, TSA, Plcp>
+    {
+        typedef True Type;	// only the text is accessed randomly
+    };
+
+	template < 
+        typename TLCP,
+		typename TText,
+		typename TSA >
+    struct LcpCreatorRandomAccess_<TLCP, TText, TSA, ParallelPlcp>
+    {
+        typedef True Type;
+    };
+
+	inline unsigned _plcpThreads(Plcp const &)
+	{
+		return 1;
+	}
+
+	inline unsigned _plcpThreads(ParallelPlcp const &)
+	{
+#ifdef _OPENMP
+		return omp_get_max_threads();
+#else
+		return 1;
+#endif
+	}
+
+	// end of the sequence that contains position i
+	template < typename TSize >
+	inline TSize _plcpSeqEnd(Nothing const &, TSize n, TSize)
+	{
+		return n;
+	}
+
+	template < typename TLimitsString, typename TSize >
+	inline TSize _plcpSeqEnd(TLimitsString const &limits, TSize, TSize i)
+	{
+		return *::std::upper_bound(begin(limits, Standard()), end(limits, Standard()), i);
+	}
+
+	// Replaces Phi by PLCP.  The text is split into ranges and each range
+	// starts with an lcp of 0 instead of the lcp carried over from its left.
+	template < typename TPLCP, typename TText, typename TLimitsString, typename TSize >
+	void _createPlcpFromPhi(
+		TPLCP &PLCP,
+		TText const &s,
+		TLimitsString const &limits,
+		TSize n,
+		unsigned threads)
+	{
+		typedef typename Iterator<TText const, Standard>::Type TIter;
+
+		TSize const UNDEF = MaxValue<TSize>::VALUE;
+		String<TSize> splitters;
+		computeSplitters(splitters, n, threads);
+
+		SEQAN_OMP_PRAGMA(parallel for schedule(static))
+		for (int t = 0; t < (int)threads; ++t)
+		{
+			TIter Ibegin = begin(s, Standard());
+			TSize seqEnd = 0;
+			for (TSize i = splitters[t], h = 0, j; i < splitters[t + 1]; ++i)
+			{
+				if (i >= seqEnd)
+					seqEnd = _plcpSeqEnd(limits, n, i);
+				if ((j = PLCP[i]) == UNDEF)
+				{
+					PLCP[i] = 0;		// i is the greatest suffix
+					h = 0;
+					continue;
+				}
+				TIter I = Ibegin + (i + h);
+				TIter J = Ibegin + (j + h);
+				for (TSize hMax = _min(seqEnd - i, n - j); h < hMax && *I == *J; ++I, ++J, ++h)
+					;
+				PLCP[i] = h;
+				if (h) --h;
+			}
+		}
+	}
+
+	// suffix array and lcp table in main memory
+	template < typename TLCPTable, typename TText, typename TSA, typename TLimitsString, typename TSize >
+	void _createLCPTablePlcp(
+		TLCPTable &LCP,
+		TText const &s,
+		TSA const &SA,
+		TLimitsString const &limits,
+		TSize n,
+		unsigned threads,
+		True)
+	{
+		TSize const UNDEF = MaxValue<TSize>::VALUE;
+		String<TSize, Alloc<> > PLCP;
+		resize(PLCP, n, Exact());
+
+		SEQAN_OMP_PRAGMA(parallel for schedule(static) num_threads(threads))
+		for (__int64 k = 0; k < (__int64)n; ++k)
+			PLCP[posGlobalize(SA[k], limits)] = ((TSize)k + 1 < n)? (TSize)posGlobalize(SA[k + 1], limits): UNDEF;
+
+		_createPlcpFromPhi(PLCP, s, limits, n, threads);
+
+		SEQAN_OMP_PRAGMA(parallel for schedule(static) num_threads(threads))
+		for (__int64 k = 0; k < (__int64)n; ++k)
+			LCP[k] = PLCP[posGlobalize(SA[k], limits)];
+	}
+
+	// semi-external: suffix array and lcp table are streamed
+	template < typename TLCPTable, typename TText, typename TSA, typename TLimitsString, typename TSize >
+	void _createLCPTablePlcp(
+		TLCPTable &LCP,
+		TText const &s,
+		TSA const &SA,
+		TLimitsString const &limits,
+		TSize n,
+		unsigned threads,
+		False)
+	{
+		typedef typename Iterator<TSA const, Standard>::Type	TSAIter;
+		typedef typename Iterator<TLCPTable, Standard>::Type	TLCPIter;
+
+		TSize const UNDEF = MaxValue<TSize>::VALUE;
+		String<TSize, Alloc<> > PLCP;
+		resize(PLCP, n, Exact());
+
+		TSAIter itSA = begin(SA, Standard());
+		TSAIter itSAEnd = itSA + n;
+		TSize prev = posGlobalize(*itSA, limits);
+		for (++itSA; itSA != itSAEnd; ++itSA)
+		{
+			TSize cur = posGlobalize(*itSA, limits);
+			PLCP[prev] = cur;
+			prev = cur;
+		}
+		PLCP[prev] = UNDEF;
+
+		_createPlcpFromPhi(PLCP, s, limits, n, threads);
+
+		TLCPIter itLCP = begin(LCP, Standard());
+		for (itSA = begin(SA, Standard()); itSA != itSAEnd; ++itSA, ++itLCP)
+			*itLCP = PLCP[posGlobalize(*itSA, limits)];
+	}
+
+	template < typename TLCPTable, typename TText, typename TSA, typename TAlgSpec >
+	inline void _createLCPTablePlcpWrapper(
+		TLCPTable &LCP,
+		TText const &text,
+		TSA const &SA,
+		TAlgSpec const &alg)
+	{
+		typedef typename Concatenator<TText const>::Type					TConcat;
+		typedef typename SaisPosition_<typename Value<TSA>::Type>::Type		TSize;
+        typedef typename AllowsFastRandomAccess<TLCPTable>::Type			TRandomLCP;
+        typedef typename AllowsFastRandomAccess<TSA>::Type					TRandomSA;
+
+		// Phi holds text positions and UNDEF, so use the position type of the suffix array
+		TConcat &s = concat(text);
+		SEQAN_CHECK((__uint64)length(s) < (__uint64)MaxValue<TSize>::VALUE,
+		            "The text is too long for the position type of the suffix array.");
+		TSize n = length(s);
+		if (n == 0) return;
+
+		_createLCPTablePlcp(LCP, s, SA, stringSetLimits(text), n, _plcpThreads(alg),
+		                    typename And<TRandomLCP, TRandomSA>::Type());
+	}
+
+    template < typename TLCPTable,
+               typename TText,
+               typename TSA >
+    inline void _createLCPTableRandomAccess(
+		TLCPTable &LCP,
+		TText const &s,
+		TSA const &SA,
+		Plcp const alg)
+	{
+		_createLCPTablePlcpWrapper(LCP, s, SA, alg);
+	}
+
+    template < typename TLCPTable,
+               typename TText,
+               typename TSA >
+    inline void _createLCPTableRandomAccess(
+		TLCPTable &LCP,
+		TText const &s,
+		TSA const &SA,
+		ParallelPlcp const alg)
+	{
+		_createLCPTablePlcpWrapper(LCP, s, SA, alg);
+	}
+
 //}
 
 }
@@ -1204,6 +1204,369 @@ To take effect of changing the $stepSize$ the q-gram index should be empty or re
 	}
 
 
+	//////////////////////////////////////////////////////////////////////////////
+	// Parallel counting sort
+	//
+	// The q-grams are split into one chunk per thread, by q-gram number for a
+	// single sequence and by sequence number for a StringSet.  If the memory
+	// permits, each chunk is counted in its own directory.  The prefix sum over
+	// all buckets and, within a bucket, over all chunks then gives each chunk the
+	// positions to scatter its q-grams to.  Otherwise, the chunks count into the
+	// shared directory and scatter with atomic operations, and the buckets are
+	// sorted afterwards.  Both ways, the occurrences within a bucket are in text
+	// order as in the sequential construction.
+
+	// Thread-safe variant of requestBucket().
+	template < typename THashValue >
+	inline THashValue
+	_requestBucketAtomic(Nothing &, THashValue hash)
+	{
+		return hash;
+	}
+
+	// Returns the number of chunks for a parallel construction, 1 for the
+	// sequential one.  Small indices and non-contiguous suffix arrays (e.g.
+	// external strings) are built sequentially.
+	template < typename TSA >
+	inline unsigned
+	_qgramParallelChunks(TSA const &sa)
+	{
+#ifdef _OPENMP
+		if (IsContiguous<TSA>::VALUE && length(sa) >= 65536u)
+			return omp_get_max_threads();
+#else
+		ignoreUnusedVariableWarning(sa);
+#endif
+		return 1;
+	}
+
+	// Splits the q-grams of a sequence into chunks of q-gram numbers.
+	template < typename TSplitters, typename TText, typename TShape, typename TStepSize >
+	inline void
+	_qgramChunkSplitters(TSplitters &splitters, TText const &text, TShape const &shape, TStepSize stepSize, unsigned numChunks)
+	{
+		__int64 numQGrams = 0;
+		if (length(text) >= length(shape) && !empty(shape))
+			numQGrams = (length(text) - length(shape)) / stepSize + 1;
+		computeSplitters(splitters, numQGrams, numChunks);
+	}
+
+	// Splits a StringSet into chunks of sequences with similar total lengths.
+	template < typename TSplitters, typename TString, typename TSpec, typename TShape, typename TStepSize >
+	inline void
+	_qgramChunkSplitters(TSplitters &splitters, StringSet<TString, TSpec> const &stringSet, TShape const &, TStepSize, unsigned numChunks)
+	{
+		__int64 total = lengthSum(stringSet);
+		__int64 sum = 0;
+		__int64 seqNo = 0;
+		resize(splitters, numChunks + 1, Exact());
+		for (unsigned t = 0; t < numChunks; ++t)
+		{
+			while (seqNo < (__int64)length(stringSet) && sum < total * t / numChunks)
+				sum += length(stringSet[seqNo++]);
+			splitters[t] = seqNo;
+		}
+		splitters[numChunks] = length(stringSet);
+	}
+
+	// Calls func(hash, pos) for the q-grams [chunkBegin, chunkEnd) of a sequence.
+	template < typename TText, typename TShape, typename TStepSize, typename TPos, typename TFunctor >
+	inline void
+	_qgramForEachInChunk(TText const &text, TShape shape, TStepSize stepSize, TPos chunkBegin, TPos chunkEnd, TFunctor &func)
+	{
+		typedef typename Iterator<TText const, Standard>::Type	TIterator;
+		typedef typename Size<TText>::Type						TSize;
+
+		if (chunkBegin >= chunkEnd || empty(shape)) return;
+
+		TIterator itText = begin(text, Standard()) + chunkBegin * stepSize;
+		func(hash(shape, itText), (TSize)(chunkBegin * stepSize));
+		if (stepSize == 1)
+			for(TPos i = chunkBegin + 1; i < chunkEnd; ++i)
+			{
+				++itText;
+				func(hashNext(shape, itText), (TSize)i);
+			}
+		else
+			for(TPos i = chunkBegin + 1; i < chunkEnd; ++i)
+			{
+				itText += stepSize;
+				func(hash(shape, itText), (TSize)(i * stepSize));
+			}
+	}
+
+	// Calls func(hash, seqNo, pos) for the q-grams of the sequences [chunkBegin, chunkEnd).
+	template < typename TString, typename TSpec, typename TShape, typename TStepSize, typename TPos, typename TFunctor >
+	inline void
+	_qgramForEachInChunk(StringSet<TString, TSpec> const &stringSet, TShape shape, TStepSize stepSize, TPos chunkBegin, TPos chunkEnd, TFunctor &func)
+	{
+		typedef typename Iterator<TString const, Standard>::Type	TIterator;
+		typedef typename Size<TString>::Type						TSize;
+
+		if (empty(shape)) return;
+
+		for(TPos seqNo = chunkBegin; seqNo < chunkEnd; ++seqNo)
+		{
+			TString const &sequence = value(stringSet, seqNo);
+			if (length(sequence) < length(shape)) continue;
+			TSize num_qgrams = length(sequence) - length(shape) + 1;
+
+			TIterator itText = begin(sequence, Standard());
+			func(hash(shape, itText), seqNo, (TSize)0);
+			if (stepSize == 1)
+				for(TSize i = 1; i < num_qgrams; ++i)
+				{
+					++itText;
+					func(hashNext(shape, itText), seqNo, i);
+				}
+			else
+				for(TSize i = stepSize; i < num_qgrams; i += stepSize)
+				{
+					itText += stepSize;
+					func(hash(shape, itText), seqNo, i);
+				}
+		}
+	}
+
+	// Counts the q-grams of a chunk, in the chunk's own directory or atomically
+	// in the shared one.
+	template < typename TCounts, typename TBucketMap, typename TAtomic >
+	struct QGramChunkCounter_
+	{
+		typedef typename Value<TCounts>::Type TSize;
+
+		TCounts		&counts;
+		TBucketMap	&bucketMap;
+		TSize		offset;
+
+		QGramChunkCounter_(TCounts &_counts, TBucketMap &_bucketMap, TSize _offset):
+			counts(_counts), bucketMap(_bucketMap), offset(_offset) {}
+
+		template < typename THashValue, typename TPos >
+		inline void operator() (THashValue code, TPos)
+		{
+			_count(_requestBucketAtomic(bucketMap, code), TAtomic());
+		}
+
+		template < typename THashValue, typename TSeqNo, typename TPos >
+		inline void operator() (THashValue code, TSeqNo, TPos)
+		{
+			_count(_requestBucketAtomic(bucketMap, code), TAtomic());
+		}
+
+		template < typename TBucket >
+		inline void _count(TBucket bktNo, False)
+		{
+			++counts[offset + bktNo];
+		}
+
+		template < typename TBucket >
+		inline void _count(TBucket bktNo, True)
+		{
+			atomicInc(counts[bktNo]);
+		}
+	};
+
+	// Scatters the q-grams of a chunk to the chunk's bucket offsets or, with
+	// atomic operations, to the shifted shared directory (see Step 4).
+	template < typename TSA, typename TOffsets, typename TBucketMap, typename TAtomic >
+	struct QGramChunkFiller_
+	{
+		typedef typename Value<TOffsets>::Type	TSize;
+		typedef typename Value<TSA>::Type		TSAValue;
+
+		TSA			&sa;
+		TOffsets	&offsets;
+		TBucketMap	&bucketMap;
+		TSize		offset;
+
+		QGramChunkFiller_(TSA &_sa, TOffsets &_offsets, TBucketMap &_bucketMap, TSize _offset):
+			sa(_sa), offsets(_offsets), bucketMap(_bucketMap), offset(_offset) {}
+
+		template < typename THashValue, typename TPos >
+		inline void operator() (THashValue code, TPos pos)
+		{
+			sa[_slot(getBucket(bucketMap, code), TAtomic())] = pos;
+		}
+
+		template < typename THashValue, typename TSeqNo, typename TPos >
+		inline void operator() (THashValue code, TSeqNo seqNo, TPos pos)
+		{
+			TSAValue localPos;
+			assignValueI1(localPos, seqNo);
+			assignValueI2(localPos, pos);
+			sa[_slot(getBucket(bucketMap, code), TAtomic())] = localPos;
+		}
+
+		template < typename TBucket >
+		inline TSize _slot(TBucket bktNo, False)
+		{
+			return offsets[offset + bktNo]++;
+		}
+
+		template < typename TBucket >
+		inline TSize _slot(TBucket bktNo, True)
+		{
+			return atomicInc(offsets[bktNo + 1]);
+		}
+	};
+
+	// Parallel prefix sum over the per-chunk directories.  Afterwards dir
+	// contains the bucket begins and counts the begin of each chunk in each
+	// bucket.
+	template < typename TDir, typename TCounts >
+	inline void
+	_qgramChunkOffsets(TDir &dir, TCounts &counts, unsigned numChunks)
+	{
+		typedef typename Value<TDir>::Type TSize;
+
+		__int64 dirLength = length(dir);
+		String<__int64> blocks;
+		computeSplitters(blocks, dirLength, (__int64)numChunks);
+		String<TSize> blockSums;
+		resize(blockSums, numChunks + 1, 0, Exact());
+
+		SEQAN_OMP_PRAGMA(parallel for schedule(static))
+		for (int blk = 0; blk < (int)numChunks; ++blk)
+		{
+			TSize sum = 0;
+			for (__int64 bktNo = blocks[blk]; bktNo < blocks[blk + 1]; ++bktNo)
+				for (unsigned t = 0; t < numChunks; ++t)
+					sum += counts[t * dirLength + bktNo];
+			blockSums[blk + 1] = sum;
+		}
+		for (unsigned blk = 0; blk < numChunks; ++blk)
+			blockSums[blk + 1] += blockSums[blk];
+
+		SEQAN_OMP_PRAGMA(parallel for schedule(static))
+		for (int blk = 0; blk < (int)numChunks; ++blk)
+		{
+			TSize sum = blockSums[blk];
+			for (__int64 bktNo = blocks[blk]; bktNo < blocks[blk + 1]; ++bktNo)
+			{
+				dir[bktNo] = sum;
+				for (unsigned t = 0; t < numChunks; ++t)
+				{
+					TSize count = counts[t * dirLength + bktNo];
+					counts[t * dirLength + bktNo] = sum;
+					sum += count;
+				}
+			}
+		}
+	}
+
+	// Parallel variant of _qgramCummulativeSum(dir, False()).
+	template < typename TDir >
+	inline void
+	_qgramCummulativeSumParallel(TDir &dir, unsigned numChunks)
+	{
+		typedef typename Value<TDir>::Type TSize;
+
+		String<__int64> blocks;
+		computeSplitters(blocks, (__int64)length(dir), (__int64)numChunks);
+		String<TSize> blockSums, blockLast;
+		resize(blockSums, numChunks + 1, 0, Exact());
+		resize(blockLast, numChunks + 1, 0, Exact());
+
+		SEQAN_OMP_PRAGMA(parallel for schedule(static))
+		for (int blk = 0; blk < (int)numChunks; ++blk)
+		{
+			TSize sum = 0;
+			for (__int64 bktNo = blocks[blk]; bktNo < blocks[blk + 1]; ++bktNo)
+				sum += dir[bktNo];
+			blockSums[blk + 1] = sum;
+			if (blocks[blk] < blocks[blk + 1])		// empty blocks are only at the end
+				blockLast[blk + 1] = dir[blocks[blk + 1] - 1];
+		}
+		for (unsigned blk = 0; blk < numChunks; ++blk)
+			blockSums[blk + 1] += blockSums[blk];
+
+		// Each entry becomes the begin of the previous bucket.
+		SEQAN_OMP_PRAGMA(parallel for schedule(static))
+		for (int blk = 0; blk < (int)numChunks; ++blk)
+		{
+			TSize sum = blockSums[blk];
+			TSize prevDiff = blockLast[blk];
+			for (__int64 bktNo = blocks[blk]; bktNo < blocks[blk + 1]; ++bktNo)
+			{
+				TSize diff = dir[bktNo];
+				dir[bktNo] = sum - prevDiff;
+				sum += diff;
+				prevDiff = diff;
+			}
+		}
+	}
+
+	template < typename TSA, typename TDir, typename TBucketMap, typename TText, typename TShape, typename TStepSize >
+	void _createQGramIndexParallel(
+		TSA &sa,
+		TDir &dir,
+		TBucketMap &bucketMap,
+		TText const &text,
+		TShape const &shape,
+		TStepSize stepSize,
+		unsigned numChunks,
+		bool chunkCounts)
+	{
+		typedef typename Value<TDir>::Type	TSize;
+		typedef String<TSize>				TCounts;
+
+		String<__int64> splitters;
+		_qgramChunkSplitters(splitters, text, shape, stepSize, numChunks);
+
+		if (chunkCounts)
+		{
+			// 2. count q-grams of each chunk in its own directory
+			TCounts counts;
+			resize(counts, (__int64)numChunks * length(dir), 0, Exact());
+			SEQAN_OMP_PRAGMA(parallel for schedule(static))
+			for (int t = 0; t < (int)numChunks; ++t)
+			{
+				QGramChunkCounter_<TCounts, TBucketMap, False> counter(counts, bucketMap, t * length(dir));
+				_qgramForEachInChunk(text, shape, stepSize, splitters[t], splitters[t + 1], counter);
+			}
+
+			// 3. cumulative sum over buckets and chunks
+			_qgramChunkOffsets(dir, counts, numChunks);
+
+			// 4. fill suffix array
+			SEQAN_OMP_PRAGMA(parallel for schedule(static))
+			for (int t = 0; t < (int)numChunks; ++t)
+			{
+				QGramChunkFiller_<TSA, TCounts, TBucketMap, False> filler(sa, counts, bucketMap, t * length(dir));
+				_qgramForEachInChunk(text, shape, stepSize, splitters[t], splitters[t + 1], filler);
+			}
+		}
+		else
+		{
+			// 2. count q-grams
+			SEQAN_OMP_PRAGMA(parallel for schedule(static))
+			for (int t = 0; t < (int)numChunks; ++t)
+			{
+				QGramChunkCounter_<TDir, TBucketMap, True> counter(dir, bucketMap, 0);
+				_qgramForEachInChunk(text, shape, stepSize, splitters[t], splitters[t + 1], counter);
+			}
+
+			// 3. cumulative sum
+			_qgramCummulativeSumParallel(dir, numChunks);
+
+			// 4. fill suffix array
+			SEQAN_OMP_PRAGMA(parallel for schedule(static))
+			for (int t = 0; t < (int)numChunks; ++t)
+			{
+				QGramChunkFiller_<TSA, TDir, TBucketMap, True> filler(sa, dir, bucketMap, 0);
+				_qgramForEachInChunk(text, shape, stepSize, splitters[t], splitters[t + 1], filler);
+			}
+
+			// 5. restore the text order within the buckets
+			SEQAN_OMP_PRAGMA(parallel for schedule(dynamic, 1024))
+			for (__int64 bktNo = 0; bktNo < (__int64)length(dir) - 1; ++bktNo)
+				if (dir[bktNo + 1] - dir[bktNo] > 1)
+					std::sort(begin(sa, Standard()) + dir[bktNo], begin(sa, Standard()) + dir[bktNo + 1]);
+		}
+	}
+
+
 //////////////////////////////////////////////////////////////////////////////
 /**
 .Function.createQGramIndex:
@@ -1225,6 +1588,11 @@ If bucketMap is of the type @Tag.Nothing@ the q-gram hash determines the bucket
 ..returns:Index contains the sorted list of qgrams. For each q-gram $dir$ contains the first position in index that corresponds to this q-gram.
 ..remarks:This function should not be called directly. Please use @Function.indexCreate@ or @Function.indexRequire@.
 The resulting tables must have appropriate size before calling this function.
+..remarks:If SeqAn is compiled with OpenMP, $createQGramIndex(index)$ builds indices with at least 65536 q-grams in parallel.
+The text is split into one chunk per thread.
+If the per-thread bucket directories do not need more memory than the suffix array, each thread counts its chunk in its own directory and scatters it to its own bucket offsets.
+Otherwise, the threads share the directory using atomic operations and the buckets are sorted afterwards.
+Indices with disabled buckets and suffix arrays that are not contiguous in memory are built sequentially.
 ..include:seqan/index.h
 */
 
@@ -1247,6 +1615,16 @@ The resulting tables must have appropriate size before calling this function.
 		// 1. clear counters
 		_qgramClearDir(dir, bucketMap);
 
+		// 2.-4. in parallel, if the per-chunk directories need at most as much
+		// memory as the suffix array
+		unsigned numChunks = _qgramParallelChunks(sa);
+		if (numChunks > 1 && !_qgramDisableBuckets(index))
+		{
+			bool chunkCounts = (__int64)numChunks * (__int64)length(dir) <= (__int64)length(sa);
+			_createQGramIndexParallel(sa, dir, bucketMap, text, shape, getStepSize(index), numChunks, chunkCounts);
+			return;
+		}
+
 		// 2. count q-grams
 		_qgramCountQGrams(dir, bucketMap, text, shape, getStepSize(index));
 
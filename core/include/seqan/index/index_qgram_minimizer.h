@@ -0,0 +1,577 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+
+#ifndef SEQAN_HEADER_INDEX_QGRAM_MINIMIZER_H
+#define SEQAN_HEADER_INDEX_QGRAM_MINIMIZER_H
+
+#include <deque>
+
+namespace SEQAN_NAMESPACE_MAIN
+{
+
+	struct Minimizer_;
+	typedef Tag<Minimizer_> Minimizer;
+
+/**
+.Spec.Minimizer
+..summary:A q-gram index that only stores the minimizers of the text.
+..cat:Index
+..general:Spec.IndexQGram
+..signature:Index<TText, IndexQGram<TShapeSpec, Minimizer> >
+..param.TText:The text type.
+...type:Class.String
+...type:Class.StringSet
+..param.TShapeSpec:The @Class.Shape@ specialization type.
+...note:This can be either a $TSpec$ argument (e.g. $SimpleShape$) or a complete @Class.Shape@ class (e.g. Shape<Dna, SimpleShape>).
+..remarks:Of each window of $w$ consecutive q-grams only the q-gram with the smallest key is stored (winnowing), where $w$ is the window size (see @Function.setWindowSize@).
+Sequences with less than $w$ q-grams store the smallest of their q-grams.
+On random texts this stores about $2n/(w+1)$ of the $n$ q-gram positions.
+If a query and the text share a substring of length $w+q-1$, they share a minimizer at the same offset in this substring.
+Use a @Class.MinimizerIterator@ to enumerate the minimizers of a query and @Function.getOccurrences@ to look them up.
+..remarks:The key of a q-gram is a bijective mix of its hash value with the minimizer seed (see @Function.setMinimizerSeed@).
+A seed of 0 orders the q-grams by their hash values, i.e. lexicographically for ungapped shapes.
+Ties are broken by the leftmost position.
+..remarks:The $stepSize$ of the index is ignored and the QGramCounts and QGramCountsDir fibres are not supported.
+..include:seqan/index.h
+.Memvar.Minimizer#windowSize
+..summary:Number of consecutive q-grams a minimizer is chosen from. Default value is 10.
+..class:Spec.Minimizer
+.Memvar.Minimizer#seed
+..summary:Seed of the q-gram order used to choose minimizers. Default value is 0x9e3779b97f4a7c15.
+..class:Spec.Minimizer
+*/
+
+#ifdef PLATFORM_WINDOWS_VS
+#pragma warning( push )
+// Disable warning C4521 locally (multiple copy constructors).
+#pragma warning( disable: 4521 )
+#endif  // PLATFORM_WINDOWS_VS
+
+	template < typename TObject, typename TShapeSpec >
+	class Index<TObject, IndexQGram<TShapeSpec, Minimizer> >
+	{
+    private:
+        static const __uint64 defaultSeed = 0x9e3779b97f4a7c15ull;
+	public:
+		typedef typename Fibre<Index, QGramText>::Type		TText;
+		typedef typename Fibre<Index, QGramSA>::Type		TSA;
+		typedef typename Fibre<Index, QGramDir>::Type		TDir;
+		typedef typename Fibre<Index, QGramCounts>::Type	TCounts;
+		typedef typename Fibre<Index, QGramCountsDir>::Type	TCountsDir;
+		typedef typename Fibre<Index, QGramShape>::Type		TShape;
+		typedef typename Fibre<Index, QGramBucketMap>::Type	TBucketMap;
+		typedef typename Cargo<Index>::Type					TCargo;
+		typedef typename Size<Index>::Type					TSize;
+
+		Holder<TText>	text;		// underlying text
+		TSA				sa;			// suffix array sorted by the first q chars
+		TDir			dir;		// bucket directory
+		TCounts			counts;		// counts each q-gram per sequence
+		TCountsDir		countsDir;	// directory for count buckets
+		TShape			shape;		// underlying shape
+		TCargo			cargo;		// user-defined cargo
+		TBucketMap		bucketMap;	// bucketMap table (used by open-addressing index)
+		TSize			stepSize;	// store every <stepSize>'th q-gram in the index
+
+		unsigned		windowSize;	// store the minimum of every <windowSize> consecutive q-grams
+		__uint64		seed;		// mixed into the hash values to define the q-gram order
+
+		Index():
+			stepSize(1),
+			windowSize(10),
+			seed(defaultSeed) {}
+
+		Index(Index &other):
+			text(other.text),
+			sa(other.sa),
+			dir(other.dir),
+			counts(other.counts),
+			countsDir(other.countsDir),
+			shape(other.shape),
+			cargo(other.cargo),
+			stepSize(1),
+			windowSize(other.windowSize),
+			seed(other.seed) {}
+
+		Index(Index const &other):
+			text(other.text),
+			sa(other.sa),
+			dir(other.dir),
+			counts(other.counts),
+			countsDir(other.countsDir),
+			shape(other.shape),
+			cargo(other.cargo),
+			stepSize(1),
+			windowSize(other.windowSize),
+			seed(other.seed) {}
+
+		template <typename TText_>
+		Index(TText_ &_text):
+			text(_text),
+			stepSize(1),
+			windowSize(10),
+			seed(defaultSeed) {}
+
+		template <typename TText_>
+		Index(TText_ const &_text):
+			text(_text),
+			stepSize(1),
+			windowSize(10),
+			seed(defaultSeed) {}
+
+		template <typename TText_, typename TShape_>
+		Index(TText_ &_text, TShape_ const &_shape):
+			text(_text),
+			shape(_shape),
+			stepSize(1),
+			windowSize(10),
+			seed(defaultSeed) {}
+
+		template <typename TText_, typename TShape_>
+		Index(TText_ const &_text, TShape_ const &_shape):
+			text(_text),
+			shape(_shape),
+			stepSize(1),
+			windowSize(10),
+			seed(defaultSeed) {}
+	};
+#ifdef PLATFORM_WINDOWS_VS
+// Enable warning C4521 again (multiple copy operators).
+#pragma warning( pop )
+#endif  // PLATFORM_WINDOWS_VS
+
+//////////////////////////////////////////////////////////////////////////////
+/**
+.Function.getWindowSize
+..summary:Return the number of consecutive q-grams a minimizer is chosen from.
+..cat:Index
+..signature:getWindowSize(index)
+..class:Spec.Minimizer
+..param.index:A minimizer q-gram index.
+...type:Spec.Minimizer
+..returns:The window size $w$. The minimum of every $w$ consecutive q-grams is stored in the index.
+..include:seqan/index.h
+*/
+
+	template <typename TText, typename TShapeSpec>
+	inline unsigned
+	getWindowSize(Index<TText, IndexQGram<TShapeSpec, Minimizer> > const &index)
+	{
+		return (index.windowSize != 0)? index.windowSize: 1;
+	}
+
+/**
+.Function.setWindowSize
+..summary:Change the number of consecutive q-grams a minimizer is chosen from.
+..cat:Index
+..signature:setWindowSize(index, windowSize)
+..class:Spec.Minimizer
+..param.index:A minimizer q-gram index.
+...type:Spec.Minimizer
+..param.windowSize:Store the minimum of every $windowSize$ consecutive q-grams in the index.
+..remarks:To take effect of changing the $windowSize$ the q-gram index should be empty or recreated.
+A $windowSize$ of 0 or 1 stores every q-gram.
+..see:Function.getWindowSize
+..include:seqan/index.h
+*/
+
+	template <typename TText, typename TShapeSpec>
+	inline void
+	setWindowSize(Index<TText, IndexQGram<TShapeSpec, Minimizer> > &index, unsigned windowSize)
+	{
+		index.windowSize = windowSize;
+	}
+
+//////////////////////////////////////////////////////////////////////////////
+/**
+.Function.getMinimizerSeed
+..summary:Return the seed of the q-gram order used to choose minimizers.
+..cat:Index
+..signature:getMinimizerSeed(index)
+..class:Spec.Minimizer
+..param.index:A minimizer q-gram index.
+...type:Spec.Minimizer
+..returns:The seed. 0 corresponds to the order of the q-gram hash values.
+..include:seqan/index.h
+*/
+
+	template <typename TText, typename TShapeSpec>
+	inline __uint64
+	getMinimizerSeed(Index<TText, IndexQGram<TShapeSpec, Minimizer> > const &index)
+	{
+		return index.seed;
+	}
+
+/**
+.Function.setMinimizerSeed
+..summary:Change the q-gram order used to choose minimizers.
+..cat:Index
+..signature:setMinimizerSeed(index, seed)
+..class:Spec.Minimizer
+..param.index:A minimizer q-gram index.
+...type:Spec.Minimizer
+..param.seed:Every seed defines a different pseudo-random order of the q-grams.
+A seed of 0 orders the q-grams by their hash values.
+..remarks:To take effect of changing the $seed$ the q-gram index should be empty or recreated.
+Queries must be enumerated with the same seed as the index, which @Class.MinimizerIterator@ takes care of.
+..see:Function.getMinimizerSeed
+..include:seqan/index.h
+*/
+
+	template <typename TText, typename TShapeSpec>
+	inline void
+	setMinimizerSeed(Index<TText, IndexQGram<TShapeSpec, Minimizer> > &index, __uint64 seed)
+	{
+		index.seed = seed;
+	}
+
+	//////////////////////////////////////////////////////////////////////////////
+	// Order of q-grams
+	//
+	// The hash value is mixed with the seed by a bijection, so distinct q-grams
+	// never have equal keys. Without mixing, low-complexity q-grams like AAAA
+	// would be chosen far too often.
+
+	template < typename THashValue >
+	inline __uint64
+	_minimizerKey(THashValue hash, __uint64 seed)
+	{
+		if (seed == 0) return (__uint64)hash;
+		__uint64 key = (__uint64)hash ^ seed;
+		key *= 0xff51afd7ed558ccdull;
+		key ^= key >> 33;
+		return key;
+	}
+
+	template < typename THashValue, typename TPos >
+	struct MinimizerEntry_
+	{
+		__uint64	key;
+		THashValue	hashValue;
+		TPos		pos;
+	};
+
+//////////////////////////////////////////////////////////////////////////////
+/**
+.Class.MinimizerIterator
+..summary:Enumerates the minimizers of a sequence.
+..cat:Index
+..signature:MinimizerIterator<TIndex, TSequence>
+..param.TIndex:The minimizer index whose shape, window size and seed are used.
+...type:Spec.Minimizer
+..param.TSequence:The sequence type.
+...type:Class.String
+..remarks:The minimizers are enumerated from left to right, each position at most once.
+They are exactly the q-grams a @Spec.Minimizer@ index stores of a text equal to the sequence.
+Use @Function.getOccurrences@ with the iterator to look up the current minimizer.
+..example.code:
+typedef Index<DnaString, IndexQGram<UngappedShape<12>, Minimizer> > TIndex;
+TIndex index(genome);
+for (MinimizerIterator<TIndex, DnaString> it(index, read); !atEnd(it); goNext(it))
+    for (unsigned i = 0; i < length(getOccurrences(index, it)); ++i)
+        std::cout << position(it) << '\t' << getOccurrences(index, it)[i] << std::endl;
+..include:seqan/index.h
+
+.Memfunc.MinimizerIterator#MinimizerIterator
+..class:Class.MinimizerIterator
+..summary:Constructor. The iterator points to the first minimizer.
+..signature:MinimizerIterator(index, sequence)
+..param.index:The minimizer index.
+...type:Spec.Minimizer
+..param.sequence:The sequence whose minimizers are enumerated. It must exist as long as the iterator is used.
+*/
+
+	template < typename TIndex, typename TSequence >
+	class MinimizerIterator
+	{
+	public:
+		typedef typename Fibre<TIndex, QGramShape>::Type			TShape;
+		typedef typename Value<TShape>::Type						THashValue;
+		typedef typename Iterator<TSequence const, Standard>::Type	TIterator;
+		typedef typename Size<TSequence>::Type						TSize;
+		typedef MinimizerEntry_<THashValue, TSize>					TEntry;
+
+		TShape				shape;
+		TIterator			itQGram;	// begin of the next q-gram
+		TSize				nextQGram;	// number of the next q-gram
+		TSize				qgramCount;
+		unsigned			windowSize;
+		__uint64			seed;
+		std::deque<TEntry>	window;		// candidates of the current window with increasing keys
+		TSize				pos;		// position of the current minimizer
+		THashValue			hashValue;	// hash value of the current minimizer
+		bool				_atEnd;
+
+		MinimizerIterator(TIndex const &index, TSequence const &sequence):
+			shape(indexShape(index)),
+			itQGram(begin(sequence, Standard())),
+			nextQGram(0),
+			qgramCount(0),
+			windowSize(getWindowSize(index)),
+			seed(getMinimizerSeed(index)),
+			pos(MaxValue<TSize>::VALUE),
+			hashValue(0),
+			_atEnd(false)
+		{
+			if (!empty(shape) && length(sequence) >= length(shape))
+				qgramCount = length(sequence) - length(shape) + 1;
+			goNext(*this);
+		}
+	};
+
+	template < typename TIndex, typename TSequence >
+	inline void
+	goNext(MinimizerIterator<TIndex, TSequence> &it)
+	{
+		typedef typename MinimizerIterator<TIndex, TSequence>::TEntry TEntry;
+
+		while (it.nextQGram < it.qgramCount)
+		{
+			TEntry entry;
+			entry.hashValue = (it.nextQGram == 0)? hash(it.shape, it.itQGram): hashNext(it.shape, it.itQGram);
+			entry.key = _minimizerKey(entry.hashValue, it.seed);
+			entry.pos = it.nextQGram;
+
+			// candidates with a greater key can't become a minimum anymore
+			while (!it.window.empty() && it.window.back().key > entry.key)
+				it.window.pop_back();
+			it.window.push_back(entry);
+
+			// the oldest candidate may have left the window
+			if (it.window.front().pos + it.windowSize <= it.nextQGram)
+				it.window.pop_front();
+
+			++it.itQGram;
+			++it.nextQGram;
+
+			// report the minimum of every complete window or of the q-grams of a short sequence
+			if ((it.nextQGram >= it.windowSize || it.nextQGram == it.qgramCount) && it.window.front().pos != it.pos)
+			{
+				it.pos = it.window.front().pos;
+				it.hashValue = it.window.front().hashValue;
+				return;
+			}
+		}
+		it._atEnd = true;
+	}
+
+	template < typename TIndex, typename TSequence >
+	inline bool
+	atEnd(MinimizerIterator<TIndex, TSequence> const &it)
+	{
+		return it._atEnd;
+	}
+
+	template < typename TIndex, typename TSequence >
+	inline bool
+	atEnd(MinimizerIterator<TIndex, TSequence> &it)
+	{
+		return it._atEnd;
+	}
+
+	// position of the current minimizer in the sequence
+	template < typename TIndex, typename TSequence >
+	inline typename Size<TSequence>::Type
+	position(MinimizerIterator<TIndex, TSequence> const &it)
+	{
+		return it.pos;
+	}
+
+	template < typename TIndex, typename TSequence >
+	inline typename Size<TSequence>::Type
+	position(MinimizerIterator<TIndex, TSequence> &it)
+	{
+		return it.pos;
+	}
+
+	// hash value of the current minimizer
+	template < typename TIndex, typename TSequence >
+	inline typename MinimizerIterator<TIndex, TSequence>::THashValue
+	value(MinimizerIterator<TIndex, TSequence> const &it)
+	{
+		return it.hashValue;
+	}
+
+	template < typename TIndex, typename TSequence >
+	inline typename MinimizerIterator<TIndex, TSequence>::THashValue
+	value(MinimizerIterator<TIndex, TSequence> &it)
+	{
+		return it.hashValue;
+	}
+
+	//////////////////////////////////////////////////////////////////////////////
+	// Counting sort of the minimizers (the bucket map is always Nothing)
+
+	template < typename TDir, typename TIndex, typename TSequence >
+	inline void
+	_qgramCountMinimizers(TDir &dir, TIndex const &index, TSequence const &sequence)
+	{
+		for (MinimizerIterator<TIndex, TSequence> it(index, sequence); !atEnd(it); goNext(it))
+			++dir[value(it)];
+	}
+
+	template < typename TDir, typename TIndex, typename TString, typename TSpec >
+	inline void
+	_qgramCountMinimizers(TDir &dir, TIndex const &index, StringSet<TString, TSpec> const &stringSet)
+	{
+		for (unsigned seqNo = 0; seqNo < length(stringSet); ++seqNo)
+			_qgramCountMinimizers(dir, index, value(stringSet, seqNo));
+	}
+
+	template < typename TSA, typename TDir, typename TIndex, typename TSequence, typename TSAValue >
+	inline void
+	_qgramFillMinimizers(TSA &sa, TDir &dir, TIndex const &index, TSequence const &sequence, TSAValue localPos)
+	{
+		for (MinimizerIterator<TIndex, TSequence> it(index, sequence); !atEnd(it); goNext(it))
+		{
+			setSeqOffset(localPos, position(it));
+			sa[dir[value(it) + 1]++] = localPos;
+		}
+	}
+
+	template < typename TSA, typename TDir, typename TIndex, typename TText >
+	inline void
+	_qgramFillMinimizers(TSA &sa, TDir &dir, TIndex const &index, TText const &text)
+	{
+		_qgramFillMinimizers(sa, dir, index, text, typename Value<TSA>::Type());
+	}
+
+	template < typename TSA, typename TDir, typename TIndex, typename TString, typename TSpec >
+	inline void
+	_qgramFillMinimizers(TSA &sa, TDir &dir, TIndex const &index, StringSet<TString, TSpec> const &stringSet)
+	{
+		typename Value<TSA>::Type localPos;
+		for (unsigned seqNo = 0; seqNo < length(stringSet); ++seqNo)
+		{
+			assignValueI1(localPos, seqNo);
+			_qgramFillMinimizers(sa, dir, index, value(stringSet, seqNo), localPos);
+		}
+	}
+
+	// The text is scanned twice, once to count and once to store the
+	// minimizers, so no more than the final suffix array is allocated.
+	template < typename TText, typename TShapeSpec >
+	void createQGramIndex(Index<TText, IndexQGram<TShapeSpec, Minimizer> > &index)
+	{
+		typedef Index<TText, IndexQGram<TShapeSpec, Minimizer> >	TIndex;
+		typename Fibre<TIndex, QGramSA>::Type	&sa  = indexSA(index);
+		typename Fibre<TIndex, QGramDir>::Type	&dir = indexDir(index);
+		TIndex const &constIndex = index;
+
+		// 1. clear counters
+		_qgramClearDir(dir, index.bucketMap);
+
+		// 2. count minimizers
+		_qgramCountMinimizers(dir, constIndex, indexText(index));
+
+		// 3. cumulative sum
+		resize(sa, _qgramCummulativeSum(dir, False()), Exact());
+
+		// 4. fill suffix array
+		_qgramFillMinimizers(sa, dir, constIndex, indexText(index));
+	}
+
+//////////////////////////////////////////////////////////////////////////////
+// interface for automatic index creation
+
+	template < typename TText, typename TShapeSpec >
+	inline bool indexCreate(
+		Index<TText, IndexQGram<TShapeSpec, Minimizer> > &index,
+		FibreSADir,
+		Default const)
+	{
+		resize(indexDir(index), _fullDirLength(index), Exact());
+		createQGramIndex(index);
+		return true;
+	}
+
+	// the minimizers are only known after counting, so the SA is never built alone
+	template < typename TText, typename TShapeSpec >
+	inline bool indexCreate(
+		Index<TText, IndexQGram<TShapeSpec, Minimizer> > &index,
+		FibreSA,
+		Default const)
+	{
+		return indexCreate(index, FibreSADir(), Default());
+	}
+
+	template < typename TText, typename TShapeSpec >
+	inline bool indexCreate(
+		Index<TText, IndexQGram<TShapeSpec, Minimizer> > &index,
+		FibreDir,
+		Default const)
+	{
+		return indexCreate(index, FibreSADir(), Default());
+	}
+
+	template < typename TText, typename TShapeSpec >
+	inline bool indexCreate(
+		Index<TText, IndexQGram<TShapeSpec, Minimizer> > &,
+		FibreCounts,
+		Default const)
+	{
+		return false;	// not supported
+	}
+
+//////////////////////////////////////////////////////////////////////////////
+/**
+.Function.getOccurrences:
+..signature:getOccurrences(index, minimizerIterator)
+..param.minimizerIterator:An iterator pointing to a minimizer of a query.
+...type:Class.MinimizerIterator
+...note:The iterator must have been constructed with $index$ or an index with the same shape, window size and seed.
+*/
+
+	template < typename TText, typename TShapeSpec, typename TIndex, typename TSequence >
+	inline typename Infix< typename Fibre< Index< TText, IndexQGram<TShapeSpec, Minimizer> >, FibreSA>::Type const >::Type
+	getOccurrences(
+		Index< TText, IndexQGram<TShapeSpec, Minimizer> > const &index,
+		MinimizerIterator<TIndex, TSequence> const &it)
+	{
+		typedef typename Size<typename Fibre< Index< TText, IndexQGram<TShapeSpec, Minimizer> >, FibreDir>::Type>::Type TDirSize;
+		TDirSize bucket = getBucket(indexBucketMap(index), value(it));
+		return infix(indexSA(index), indexDir(index)[bucket], indexDir(index)[bucket + 1]);
+	}
+
+	template < typename TText, typename TShapeSpec, typename TIndex, typename TSequence >
+	inline typename Infix< typename Fibre< Index< TText, IndexQGram<TShapeSpec, Minimizer> >, FibreSA>::Type const >::Type
+	getOccurrences(
+		Index< TText, IndexQGram<TShapeSpec, Minimizer> > &index,
+		MinimizerIterator<TIndex, TSequence> const &it)
+	{
+		indexRequire(index, QGramSADir());
+		return getOccurrences(const_cast<Index< TText, IndexQGram<TShapeSpec, Minimizer> > const &>(index), it);
+	}
+
+}
+
+#endif //#ifndef SEQAN_HEADER_...
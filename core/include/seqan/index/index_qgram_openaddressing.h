@@ -247,6 +247,44 @@ A bucket still stores occurrences (or counts) of the same q-gram, but in contras
 		}
 	}
 
+	// Thread-safe variant of requestBucket().  An entry is claimed with a
+	// compare-and-swap, so a code is stored exactly once even if several threads
+	// insert it concurrently.
+	template < typename THashValue, typename THashValue2 >
+	inline THashValue
+	_requestBucketAtomic(BucketMap<THashValue> &bucketMap, THashValue2 code)
+	{
+		typedef unsigned long TSize;
+
+		TSize hlen = length(bucketMap.qgramCode);
+		if (hlen == 0ul) return code;
+
+        TSize h1 = _hashFunction(bucketMap, code);
+#ifdef SEQAN_OPENADDRESSING_COMPACT
+        --hlen;
+		h1 %= hlen;
+#else
+        hlen -= 2;
+		h1 &= hlen;
+        TSize delta = 0;
+#endif
+		while (true)
+		{
+			THashValue volatile &entry = bucketMap.qgramCode[h1];
+			THashValue old = entry;
+			if (old == (THashValue)-1)
+				old = atomicCas(entry, (THashValue)-1, (THashValue)code);
+			if (old == (THashValue)-1 || old == (THashValue)code)
+				return h1;
+#ifdef SEQAN_OPENADDRESSING_COMPACT
+			h1 = (h1 + 1) % hlen;
+#else
+			h1 = (h1 + delta + 1) & hlen;
+            ++delta;
+#endif
+		}
+	}
+
 	template < typename THashValue, typename THashValue2 >
 	inline THashValue
 	getBucket(BucketMap<THashValue> const &bucketMap, THashValue2 code)
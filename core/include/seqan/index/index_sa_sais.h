@@ -0,0 +1,645 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Suffix array construction by induced sorting (SA-IS) of Nong, Zhang and
+// Chan, "Two Efficient Algorithms for Linear Time Suffix Array
+// Construction", IEEE Transactions on Computers, 2011.
+// ==========================================================================
+
+#ifndef SEQAN_HEADER_INDEX_SA_SAIS_H
+#define SEQAN_HEADER_INDEX_SA_SAIS_H
+
+namespace SEQAN_NAMESPACE_MAIN
+{
+
+/**
+.Tag.Sais
+..cat:Index
+..summary:Suffix array construction by induced sorting (SA-IS).
+..signature:Sais
+..remarks:A linear time, internal memory algorithm. For a @Class.String@ text it needs one byte per character and
+a bucket table of the alphabet size besides the text and the suffix array.
+It works with @Class.String@ and @Class.StringSet@ texts.
+..remarks:A @Class.StringSet@ of $n$ sequences with $N$ characters in total is sorted as a concatenated copy of $N + n$ characters.
+The copy uses 1 or 2 bytes per character if the alphabet size plus $n$ is at most 256 or 65536, otherwise one position
+of the suffix array position type per character.
+Its suffixes are sorted into an additional array of $N + n$ positions, which is converted into the suffix array afterwards.
+..remarks:The position type of the suffix array (see @Metafunction.SAValue@) is also used for the working arrays.
+Its maximal value must be greater than the text length (plus the number of sequences for string sets), otherwise the
+construction aborts the program.
+To index texts longer than 4G characters, overload @Metafunction.SAValue@ to return a 64 bit type (e.g. $__uint64$)
+or a @Class.Pair@ with a 64 bit offset for @Class.StringSet@ texts.
+..see:Tag.ParallelSais
+..include:seqan/index.h
+
+.Tag.ParallelSais
+..cat:Index
+..summary:Multi-threaded suffix array construction by induced sorting (SA-IS).
+..signature:ParallelSais
+..remarks:Produces the same suffix array as @Tag.Sais@.
+If SeqAn is compiled with OpenMP, the character counting, the classification of suffixes, the naming of LMS substrings and
+the conversion into local positions of a @Class.StringSet@ are distributed over all threads.
+The induced sorting scans the suffix array sequentially, but for each block of the suffix array the characters and types of the
+preceding suffixes (random accesses into the text) are read by all threads in advance.
+..include:seqan/index.h
+*/
+
+	struct Sais {};
+	struct ParallelSais {};
+
+	//////////////////////////////////////////////////////////////////////////////
+	// Thread count
+
+	inline unsigned _saisThreads(Sais const &)
+	{
+		return 1;
+	}
+
+	inline unsigned _saisThreads(ParallelSais const &)
+	{
+#ifdef _OPENMP
+		return omp_get_max_threads();
+#else
+		return 1;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////////
+	// The text of the first recursion level of a single string.  Characters
+	// are shifted by one and the sentinel 0 is appended.
+	template < typename TText, typename TInt >
+	struct SaisText_
+	{
+		typedef typename Iterator<TText const, Standard>::Type TIter;
+
+		TIter	_begin;
+		TInt	_length;	// without the sentinel
+
+		SaisText_(TText const &text):
+			_begin(begin(text, Standard())),
+			_length(length(text)) {}
+
+		inline TInt operator[] (TInt i) const
+		{
+			return (i < _length)? (TInt)ordValue(_begin[i]) + 1: 0;
+		}
+	};
+
+	// number of different ordValues, bounded by a scan for large alphabets
+	template < typename TText >
+	inline unsigned
+	_saisAlphabetSize(TText const &text)
+	{
+		typedef typename Value<TText>::Type						TValue;
+		typedef typename Iterator<TText const, Standard>::Type	TIter;
+
+		if (BitsPerValue<TValue>::VALUE <= 16)
+			return ValueSize<TValue>::VALUE;
+
+		unsigned maxOrd = 0;
+		for (TIter it = begin(text, Standard()), itEnd = end(text, Standard()); it != itEnd; ++it)
+			maxOrd = _max(maxOrd, (unsigned)ordValue(*it));
+		return maxOrd + 1;
+	}
+
+	template < typename TString, typename TSetSpec >
+	inline unsigned
+	_saisAlphabetSize(StringSet<TString, TSetSpec> const &stringSet)
+	{
+		unsigned sigma = 1;
+		for (unsigned seqNo = 0; seqNo < length(stringSet); ++seqNo)
+			sigma = _max(sigma, _saisAlphabetSize(stringSet[seqNo]));
+		return sigma;
+	}
+
+	//////////////////////////////////////////////////////////////////////////////
+	// Step 0: Count characters and classify suffixes into S- and L-type
+
+	template < typename TInt, typename TText >
+	inline void
+	_saisCount(String<TInt> &counts, TText const &T, TInt n, TInt K, unsigned threads)
+	{
+		typedef typename Iterator<String<TInt>, Standard>::Type TIter;
+
+		resize(counts, K, Exact());
+		arrayFill(begin(counts, Standard()), end(counts, Standard()), 0);
+
+		// per-thread histograms only if they are small compared to the text
+		if (threads > 1 && (__int64)threads * (__int64)K <= (__int64)n)
+		{
+			String<TInt> splitters, local;
+			computeSplitters(splitters, n, threads);
+			resize(local, threads * K, Exact());
+			arrayFill(begin(local, Standard()), end(local, Standard()), 0);
+
+			SEQAN_OMP_PRAGMA(parallel for schedule(static))
+			for (int t = 0; t < (int)threads; ++t)
+			{
+				TIter cnt = begin(local, Standard()) + t * K;
+				for (TInt i = splitters[t]; i < splitters[t + 1]; ++i)
+					++cnt[T[i]];
+			}
+			for (unsigned t = 0; t < threads; ++t)
+				for (TInt c = 0; c < K; ++c)
+					counts[c] += local[t * K + c];
+		}
+		else
+			for (TInt i = 0; i < n; ++i)
+				++counts[T[i]];
+	}
+
+	template < typename TInt >
+	inline void
+	_saisBuckets(String<TInt> &bkt, String<TInt> const &counts, bool bucketEnds)
+	{
+		resize(bkt, length(counts), Exact());
+		TInt sum = 0;
+		for (unsigned c = 0; c < length(counts); ++c)
+		{
+			sum += counts[c];
+			bkt[c] = (bucketEnds)? sum: sum - counts[c];
+		}
+	}
+
+	// isS[i] is true iff suffix i is S-type, i.e. smaller than suffix i+1
+	template < typename TInt, typename TText >
+	inline void
+	_saisClassify(String<bool> &isS, TText const &T, TInt n, unsigned threads)
+	{
+		resize(isS, n, Exact());
+		isS[n - 1] = true;
+		if (threads <= 1 || n < (TInt)threads * 1024)
+		{
+			for (TInt i = n - 1; i > 0; --i)
+				isS[i - 1] = T[i - 1] < T[i] || (T[i - 1] == T[i] && isS[i]);
+			return;
+		}
+
+		String<TInt> splitters, runBegin;
+		computeSplitters(splitters, n - 1, threads);
+		resize(runBegin, threads, Exact());
+
+		// 1. classify each chunk except the run of characters that continues into the next chunk
+		SEQAN_OMP_PRAGMA(parallel for schedule(static))
+		for (int t = 0; t < (int)threads; ++t)
+		{
+			TInt b = splitters[t];
+			TInt e = splitters[t + 1];
+			TInt r = e;
+			while (r > b && T[r - 1] == T[e])
+				--r;
+			for (TInt i = r; i > b; --i)
+				isS[i - 1] = T[i - 1] < T[i] || (T[i - 1] == T[i] && isS[i]);
+			runBegin[t] = r;
+		}
+
+		// 2. these runs have the type of the first suffix of the next chunk
+		for (unsigned t = threads; t > 0; --t)
+			for (TInt i = splitters[t]; i > runBegin[t - 1]; --i)
+				isS[i - 1] = isS[i];
+	}
+
+	template < typename TInt >
+	inline bool
+	_saisIsLms(String<bool> const &isS, TInt i)
+	{
+		return i > 0 && isS[i] && !isS[i - 1];
+	}
+
+	//////////////////////////////////////////////////////////////////////////////
+	// Induced sorting
+	//
+	// Scanning the suffix array left to right (right to left) each suffix
+	// induces the position of its preceding suffix if that is L-type (S-type).
+	// With several threads the suffix array is scanned in blocks.  The
+	// preceding suffixes of a block are read by all threads in advance and only
+	// the entries written while scanning the block itself are read on the fly.
+
+	template < typename TInt >
+	struct SaisPrefetch_
+	{
+		String<TInt>	seen;	// SA entry at prefetch time
+		String<TInt>	pos;	// suffix to induce or EMPTY
+		String<TInt>	chr;	// its first character
+	};
+
+	template < typename TInt, typename TSAIter, typename TText >
+	inline void
+	_saisPrefetch(
+		SaisPrefetch_<TInt> &cache,
+		TSAIter SA,
+		TText const &T,
+		String<bool> const &isS,
+		TInt blockBegin,
+		TInt blockEnd,
+		bool induceS,
+		unsigned threads)
+	{
+		TInt const EMPTY = MaxValue<TInt>::VALUE;
+		String<TInt> splitters;
+		computeSplitters(splitters, blockEnd - blockBegin, threads);
+
+		SEQAN_OMP_PRAGMA(parallel for schedule(static))
+		for (int t = 0; t < (int)threads; ++t)
+			for (TInt k = splitters[t]; k < splitters[t + 1]; ++k)
+			{
+				TInt v = SA[blockBegin + k];
+				cache.seen[k] = v;
+				if (v != EMPTY && v > 0 && isS[v - 1] == induceS)
+				{
+					cache.pos[k] = v - 1;
+					cache.chr[k] = T[v - 1];
+				}
+				else
+					cache.pos[k] = EMPTY;
+			}
+	}
+
+	template < typename TSAIter, typename TText, typename TInt >
+	inline void
+	_saisInduceL(TSAIter SA, TText const &T, String<bool> const &isS, TInt n, String<TInt> &bkt, unsigned threads)
+	{
+		TInt const EMPTY = MaxValue<TInt>::VALUE;
+		TInt const BLOCK_SIZE = 1 << 16;
+
+		if (threads <= 1 || n <= BLOCK_SIZE)
+		{
+			for (TInt i = 0; i < n; ++i)
+			{
+				TInt v = SA[i];
+				if (v != EMPTY && v > 0 && !isS[v - 1])
+					SA[bkt[T[v - 1]]++] = v - 1;
+			}
+			return;
+		}
+
+		SaisPrefetch_<TInt> cache;
+		resize(cache.seen, BLOCK_SIZE, Exact());
+		resize(cache.pos, BLOCK_SIZE, Exact());
+		resize(cache.chr, BLOCK_SIZE, Exact());
+		for (TInt b = 0; b < n; b += BLOCK_SIZE)
+		{
+			TInt e = (n - b > BLOCK_SIZE)? b + BLOCK_SIZE: n;
+			_saisPrefetch(cache, SA, T, isS, b, e, false, threads);
+			for (TInt i = b; i < e; ++i)
+			{
+				TInt v = SA[i];
+				if (v == cache.seen[i - b])
+				{
+					if (cache.pos[i - b] != EMPTY)
+						SA[bkt[cache.chr[i - b]]++] = cache.pos[i - b];
+				}
+				else if (v != EMPTY && v > 0 && !isS[v - 1])
+					SA[bkt[T[v - 1]]++] = v - 1;
+			}
+		}
+	}
+
+	template < typename TSAIter, typename TText, typename TInt >
+	inline void
+	_saisInduceS(TSAIter SA, TText const &T, String<bool> const &isS, TInt n, String<TInt> &bkt, unsigned threads)
+	{
+		TInt const EMPTY = MaxValue<TInt>::VALUE;
+		TInt const BLOCK_SIZE = 1 << 16;
+
+		if (threads <= 1 || n <= BLOCK_SIZE)
+		{
+			for (TInt i = n; i > 0; --i)
+			{
+				TInt v = SA[i - 1];
+				if (v != EMPTY && v > 0 && isS[v - 1])
+					SA[--bkt[T[v - 1]]] = v - 1;
+			}
+			return;
+		}
+
+		SaisPrefetch_<TInt> cache;
+		resize(cache.seen, BLOCK_SIZE, Exact());
+		resize(cache.pos, BLOCK_SIZE, Exact());
+		resize(cache.chr, BLOCK_SIZE, Exact());
+		for (TInt e = n; e > 0; )
+		{
+			TInt b = (e > BLOCK_SIZE)? e - BLOCK_SIZE: 0;
+			_saisPrefetch(cache, SA, T, isS, b, e, true, threads);
+			for (TInt i = e; i > b; --i)
+			{
+				TInt v = SA[i - 1];
+				if (v == cache.seen[i - 1 - b])
+				{
+					if (cache.pos[i - 1 - b] != EMPTY)
+						SA[--bkt[cache.chr[i - 1 - b]]] = cache.pos[i - 1 - b];
+				}
+				else if (v != EMPTY && v > 0 && isS[v - 1])
+					SA[--bkt[T[v - 1]]] = v - 1;
+			}
+			e = b;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////////
+	// Naming of LMS substrings
+
+	// LMS substrings are equal if they have the same characters and types
+	template < typename TText, typename TInt >
+	inline bool
+	_saisLmsEqual(TText const &T, String<bool> const &isS, TInt n, TInt a, TInt b)
+	{
+		if (a == n - 1 || b == n - 1)
+			return a == b;					// the sentinel is unique
+		for (TInt d = 0; ; ++d)
+		{
+			if (T[a + d] != T[b + d] || isS[a + d] != isS[b + d])
+				return false;
+			if (d > 0 && (_saisIsLms(isS, a + d) || _saisIsLms(isS, b + d)))
+				return true;				// both substrings end here
+		}
+	}
+
+	// SA[0..n1) contains the sorted LMS substrings.  Their names are stored
+	// at SA[n1 + pos/2] and the number of different names is returned.
+	template < typename TSAIter, typename TText, typename TInt >
+	inline TInt
+	_saisNameLms(TSAIter SA, TText const &T, String<bool> const &isS, TInt n, TInt n1, unsigned threads)
+	{
+		TInt const EMPTY = MaxValue<TInt>::VALUE;
+
+		String<bool> differs;
+		String<TInt> splitters;
+		resize(differs, n1, Exact());
+		computeSplitters(splitters, n1, threads);
+
+		SEQAN_OMP_PRAGMA(parallel for schedule(static))
+		for (int t = 0; t < (int)threads; ++t)
+			for (TInt i = splitters[t]; i < splitters[t + 1]; ++i)
+				differs[i] = (i == 0) || !_saisLmsEqual(T, isS, n, SA[i - 1], SA[i]);
+
+		arrayFill(SA + n1, SA + n, EMPTY);
+		TInt names = 0;
+		for (TInt i = 0; i < n1; ++i)
+		{
+			if (differs[i])
+				++names;
+			SA[n1 + SA[i] / 2] = names - 1;
+		}
+		return names;
+	}
+
+	//////////////////////////////////////////////////////////////////////////////
+	// SA-IS
+	//
+	// T[0..n) is a text over [0..K) whose last character is a unique 0.
+	// SA[0..n) is overwritten by its suffix array.
+
+	template < typename TSAIter, typename TText, typename TInt >
+	void
+	_createSuffixArraySais(TSAIter SA, TText const &T, TInt n, TInt K, unsigned threads)
+	{
+		TInt const EMPTY = MaxValue<TInt>::VALUE;
+
+		if (n == 1)
+		{
+			SA[0] = 0;
+			return;
+		}
+
+		String<bool> isS;
+		String<TInt> counts, bkt;
+		_saisClassify(isS, T, n, threads);
+		_saisCount(counts, T, n, K, threads);
+
+		// 1. sort the LMS substrings by inducing from unsorted LMS suffixes
+		arrayFill(SA, SA + n, EMPTY);
+		_saisBuckets(bkt, counts, true);
+		for (TInt i = 1; i < n; ++i)
+			if (_saisIsLms(isS, i))
+				SA[--bkt[T[i]]] = i;
+		_saisBuckets(bkt, counts, false);
+		_saisInduceL(SA, T, isS, n, bkt, threads);
+		_saisBuckets(bkt, counts, true);
+		_saisInduceS(SA, T, isS, n, bkt, threads);
+
+		// 2. name the LMS substrings and sort the LMS suffixes recursively
+		TInt n1 = 0;
+		for (TInt i = 0; i < n; ++i)
+			if (_saisIsLms(isS, (TInt)SA[i]))
+				SA[n1++] = SA[i];
+		TInt names = _saisNameLms(SA, T, isS, n, n1, threads);
+
+		for (TInt i = n, j = n; i > n1; --i)		// move the names to the end in text order
+			if (SA[i - 1] != EMPTY)
+				SA[--j] = SA[i - 1];
+
+		TSAIter SA1 = SA;
+		TSAIter s1 = SA + (n - n1);
+		if (names < n1)
+			_createSuffixArraySais(SA1, s1, n1, names, threads);
+		else
+			for (TInt i = 0; i < n1; ++i)
+				SA1[s1[i]] = i;
+
+		// 3. induce the suffix array from the sorted LMS suffixes
+		for (TInt i = 1, j = 0; i < n; ++i)
+			if (_saisIsLms(isS, i))
+				s1[j++] = i;
+		for (TInt i = 0; i < n1; ++i)
+			SA1[i] = s1[SA1[i]];
+		arrayFill(SA + n1, SA + n, EMPTY);
+
+		_saisBuckets(bkt, counts, true);
+		for (TInt i = n1; i > 0; --i)
+		{
+			TInt v = SA[i - 1];
+			SA[i - 1] = EMPTY;
+			SA[--bkt[T[v]]] = v;
+		}
+		_saisBuckets(bkt, counts, false);
+		_saisInduceL(SA, T, isS, n, bkt, threads);
+		_saisBuckets(bkt, counts, true);
+		_saisInduceS(SA, T, isS, n, bkt, threads);
+	}
+
+	//////////////////////////////////////////////////////////////////////////////
+	// single strings are sorted in-place
+
+	template < typename TSA, typename TText, typename TAlgSpec >
+	inline void
+	_createSuffixArraySaisWrapper(TSA &SA, TText const &text, TAlgSpec const &alg)
+	{
+		typedef typename MakeUnsigned_<typename Value<TSA>::Type>::Type	TInt;
+
+		TInt n = length(text);
+		SEQAN_CHECK((__uint64)length(text) < (__uint64)MaxValue<TInt>::VALUE,
+		            "The text is too long for the position type of the suffix array.");
+
+		// sort the text with a sentinel and remove the sentinel suffix, which is the smallest
+		resize(SA, n + 1, Exact());
+		_createSuffixArraySais(begin(SA, Standard()), SaisText_<TText, TInt>(text), (TInt)(n + 1),
+		                       (TInt)(_saisAlphabetSize(text) + 1), _saisThreads(alg));
+		erase(SA, 0);
+	}
+
+	//////////////////////////////////////////////////////////////////////////////
+	// string sets are concatenated with a separator after each sequence
+	//
+	// The separator of sequence i is m-1-i, the characters are shifted by m.
+	// Equal suffixes of different sequences are sorted by decreasing
+	// sequence number, like the suffix arrays of Skew7.
+
+	template < typename TSize1, typename TSize2, typename TPack, typename TSeqNo, typename TPos >
+	inline void
+	_saisAssignLocalPos(Pair<TSize1, TSize2, TPack> &pos, TSeqNo seqNo, TPos offset)
+	{
+		assignValueI1(pos, seqNo);
+		assignValueI2(pos, offset);
+	}
+
+	template < typename TSAValue >
+	struct SaisPosition_:
+		MakeUnsigned_<TSAValue> {};
+
+	template < typename TSize1, typename TSize2, typename TPack >
+	struct SaisPosition_<Pair<TSize1, TSize2, TPack> >:
+		MakeUnsigned_<TSize2> {};
+
+	template < typename TChar, typename TSA, typename TString, typename TSetSpec, typename TInt >
+	inline void
+	_createSuffixArraySaisStringSet(
+		TSA &SA,
+		StringSet<TString, TSetSpec> const &stringSet,
+		TInt N,
+		TInt K,
+		unsigned threads)
+	{
+		typedef typename Iterator<TString const, Standard>::Type	TIter;
+		typedef typename Iterator<String<TInt>, Standard>::Type		TLimitsIter;
+
+		TInt seqCount = length(stringSet);
+
+		// 1. concatenate the sequences
+		String<TChar> T;
+		String<TInt> limits;		// begin of each sequence in T
+		resize(T, N, Exact());
+		resize(limits, seqCount, Exact());
+		TInt pos = 0;
+		for (TInt seqNo = 0; seqNo < seqCount; ++seqNo)
+		{
+			limits[seqNo] = pos;
+			for (TIter it = begin(stringSet[seqNo], Standard()), itEnd = end(stringSet[seqNo], Standard()); it != itEnd; ++it)
+				T[pos++] = (TChar)(ordValue(*it) + seqCount);
+			T[pos++] = (TChar)(seqCount - 1 - seqNo);
+		}
+
+		// 2. sort
+		String<TInt> work;
+		resize(work, N, Exact());
+		_createSuffixArraySais(begin(work, Standard()), begin(T, Standard()), N, K, threads);
+		clear(T);
+
+		// 3. skip the separator suffixes, which are the smallest, and convert into local positions
+		String<TInt> splitters;
+		computeSplitters(splitters, N - seqCount, threads);
+
+		SEQAN_OMP_PRAGMA(parallel for schedule(static))
+		for (int t = 0; t < (int)threads; ++t)
+			for (TInt i = splitters[t]; i < splitters[t + 1]; ++i)
+			{
+				TInt globalPos = work[seqCount + i];
+				TLimitsIter itLimits = ::std::upper_bound(begin(limits, Standard()), end(limits, Standard()), globalPos) - 1;
+				TInt seqNo = itLimits - begin(limits, Standard());
+				_saisAssignLocalPos(SA[i], seqNo, globalPos - *itLimits);
+			}
+	}
+
+	template < typename TSA, typename TString, typename TSetSpec, typename TAlgSpec >
+	inline void
+	_createSuffixArraySaisWrapper(TSA &SA, StringSet<TString, TSetSpec> const &stringSet, TAlgSpec const &alg)
+	{
+		typedef typename SaisPosition_<typename Value<TSA>::Type>::Type	TInt;
+
+		TInt seqCount = length(stringSet);
+		__uint64 N = (__uint64)lengthSum(stringSet) + seqCount;
+		SEQAN_CHECK(N < (__uint64)MaxValue<TInt>::VALUE,
+		            "The text is too long for the position type of the suffix array.");
+
+		resize(SA, N - seqCount, Exact());
+		if (seqCount == 0) return;
+
+		// use the smallest character type for the concatenation
+		__uint64 K = (__uint64)_saisAlphabetSize(stringSet) + seqCount;
+		if (K <= 256)
+			_createSuffixArraySaisStringSet<unsigned char>(SA, stringSet, (TInt)N, (TInt)K, _saisThreads(alg));
+		else if (K <= 65536)
+			_createSuffixArraySaisStringSet<unsigned short>(SA, stringSet, (TInt)N, (TInt)K, _saisThreads(alg));
+		else
+			_createSuffixArraySaisStringSet<TInt>(SA, stringSet, (TInt)N, (TInt)K, _saisThreads(alg));
+	}
+
+//////////////////////////////////////////////////////////////////////////////
+///.Function.createSuffixArray.param.algo_tag.type:Tag.Sais
+///.Function.createSuffixArray.param.algo_tag.type:Tag.ParallelSais
+
+	template < typename TSA, typename TText >
+	inline void createSuffixArray(
+		TSA &SA,
+		TText const &text,
+		Sais const &alg)
+	{
+		_createSuffixArraySaisWrapper(SA, text, alg);
+	}
+
+	template < typename TSA, typename TText >
+	inline void createSuffixArray(
+		TSA &SA,
+		TText const &text,
+		ParallelSais const &alg)
+	{
+		_createSuffixArraySaisWrapper(SA, text, alg);
+	}
+
+	// The suffix array is resized by the algorithm itself, as it needs one
+	// more entry for the sentinel.  Resizing it before would only cause a copy.
+	template < typename TText, typename TSpec >
+	inline bool indexCreate(Index<TText, TSpec> &index, FibreSA, Sais const alg)
+	{
+		createSuffixArray(indexSA(index), indexText(index), alg);
+		return true;
+	}
+
+	template < typename TText, typename TSpec >
+	inline bool indexCreate(Index<TText, TSpec> &index, FibreSA, ParallelSais const alg)
+	{
+		createSuffixArray(indexSA(index), indexText(index), alg);
+		return true;
+	}
+
+}
+
+#endif //#ifndef SEQAN_HEADER_INDEX_SA_SAIS_H
@@ -579,6 +579,151 @@ The hash value corresponds to the maximal @Function.hash@ value of a shape begin
 
 //____________________________________________________________________________
 
+/**
+.Function.hashAll:
+..cat:Index
+..summary:Computes the hash values of all q-grams of a sequence at once.
+..signature:hashAll(shape, text, hashes)
+..signature:hashAll(shapes, text, hashes)
+..class:Class.Shape
+..param.shape:Shape to be used for hashing.
+...type:Class.Shape
+..param.shapes:A @Class.String@ of shapes of the same type, e.g. the shapes of a multi-shape filter.
+..param.text:The sequence.
+..param.hashes:The resulting hash values.
+For a single $shape$ this is a @Class.String@ that is resized to the number of q-grams, $length(text) - length(shape) + 1$ or 0.
+Its $i$'th entry is the value of $hash(shape, begin(text) + i)$.
+For $shapes$ this is a @Class.String@ or @Class.StringSet@ of such strings, one for each shape.
+..remarks:The text is processed in blocks.
+The characters of a block are converted to ordinal values only once for all shapes.
+Then the hash values of each shape are computed for the whole block, adding one shape position at a time.
+These loops have no dependencies between adjacent q-grams and are vectorized by the compiler.
+In contrast to @Function.hashNext@, gapped shapes don't need a loop over their weight for each q-gram.
+..see:Function.hash
+..include:seqan/index.h
+*/
+
+	// offsets of the shape's '1's relative to the first character
+	template <typename TValue, typename TSpec>
+	inline void
+	_shapeOffsets(String<unsigned> &offsets, Shape<TValue, TSpec> const &me)
+	{
+		resize(offsets, length(me), Exact());
+		for (unsigned i = 0; i < length(offsets); ++i)
+			offsets[i] = i;
+	}
+
+	template <typename THashIter, typename TOrdIter, typename TValue>
+	inline void
+	_hashAllBlock(THashIter hashes, TOrdIter ords, String<unsigned> const &offsets, unsigned blockLen, TValue const)
+	{
+		TOrdIter ordsJ = ords + offsets[0];
+		for (unsigned i = 0; i < blockLen; ++i)
+			hashes[i] = ordsJ[i];
+		for (unsigned j = 1; j < length(offsets); ++j)
+		{
+			ordsJ = ords + offsets[j];
+			for (unsigned i = 0; i < blockLen; ++i)
+				hashes[i] = hashes[i] * ValueSize<TValue>::VALUE + ordsJ[i];
+		}
+	}
+
+	// hashes[k] points to the hash values of the shape with the q-gram offsets
+	// offsets[k], which has qgramCounts[k] q-grams in the text
+	template <typename THashIter, typename TText, typename TValue>
+	inline void
+	_hashAllBlocks(
+		String<THashIter> &hashes,
+		String<String<unsigned> > const &offsets,
+		String<unsigned> const &qgramCounts,
+		TText const &text,
+		TValue const)
+	{
+		typedef typename Value<THashIter>::Type						THValue;
+		typedef typename Iterator<TText const, Standard>::Type		TIter;
+		typedef typename Iterator<String<THValue>, Standard>::Type	TOrdIter;
+
+		// the hash values of a block fit into the L1 cache
+		const unsigned BLOCK_SIZE = 2048;
+
+		unsigned maxSpan = 0, maxQGrams = 0;
+		for (unsigned k = 0; k < length(offsets); ++k)
+		{
+			maxSpan = _max(maxSpan, back(offsets[k]) + 1);
+			maxQGrams = _max(maxQGrams, qgramCounts[k]);
+		}
+
+		String<THValue> ords;
+		resize(ords, BLOCK_SIZE + maxSpan - 1, Exact());
+
+		TIter itText = begin(text, Standard());
+		unsigned textLen = length(text);
+		for (unsigned blockBegin = 0; blockBegin < maxQGrams; blockBegin += BLOCK_SIZE)
+		{
+			unsigned blockEnd = _min(blockBegin + BLOCK_SIZE, maxQGrams);
+
+			// 1. convert the characters of all q-grams of the block
+			unsigned ordsEnd = _min(blockEnd + maxSpan - 1, textLen);
+			TOrdIter itOrds = begin(ords, Standard());
+			for (unsigned i = blockBegin; i < ordsEnd; ++i, ++itOrds)
+				*itOrds = ordValue((TValue)itText[i]);
+
+			// 2. hash the block for each shape
+			for (unsigned k = 0; k < length(offsets); ++k)
+				if (blockBegin < qgramCounts[k])
+					_hashAllBlock(hashes[k] + blockBegin, begin(ords, Standard()), offsets[k],
+					              _min(blockEnd, qgramCounts[k]) - blockBegin, TValue());
+		}
+	}
+
+	template <typename TValue, typename TSpec, typename TText, typename THashString>
+	inline void
+	hashAll(Shape<TValue, TSpec> const &me, TText const &text, THashString &hashes)
+	{
+		typedef typename Iterator<THashString, Standard>::Type	THashIter;
+
+		SEQAN_ASSERT_GT((unsigned)weight(me), 0u);
+
+		String<String<unsigned> > offsets;
+		String<unsigned> qgramCounts;
+		resize(offsets, 1);
+		_shapeOffsets(offsets[0], me);
+		appendValue(qgramCounts, (length(text) < length(me))? 0: length(text) - length(me) + 1);
+
+		resize(hashes, qgramCounts[0], Exact());
+		String<THashIter> hashIters;
+		appendValue(hashIters, begin(hashes, Standard()));
+		_hashAllBlocks(hashIters, offsets, qgramCounts, text, TValue());
+	}
+
+	template <typename TValue, typename TSpec, typename TShapeStringSpec, typename TText, typename THashStrings>
+	inline void
+	hashAll(String<Shape<TValue, TSpec>, TShapeStringSpec> const &shapes, TText const &text, THashStrings &hashes)
+	{
+		typedef typename Value<THashStrings>::Type					THashString;
+		typedef typename Iterator<THashString, Standard>::Type		THashIter;
+
+		unsigned shapeCount = length(shapes);
+		String<String<unsigned> > offsets;
+		String<unsigned> qgramCounts;
+		String<THashIter> hashIters;
+		resize(offsets, shapeCount);
+		resize(hashes, shapeCount);
+		for (unsigned k = 0; k < shapeCount; ++k)
+		{
+			SEQAN_ASSERT_GT((unsigned)weight(shapes[k]), 0u);
+			_shapeOffsets(offsets[k], shapes[k]);
+			appendValue(qgramCounts, (length(text) < length(shapes[k]))? 0: length(text) - length(shapes[k]) + 1);
+			resize(hashes[k], qgramCounts[k], Exact());
+		}
+		// the strings must not be resized after taking their iterators
+		for (unsigned k = 0; k < shapeCount; ++k)
+			appendValue(hashIters, begin(hashes[k], Standard()));
+		_hashAllBlocks(hashIters, offsets, qgramCounts, text, TValue());
+	}
+
+//____________________________________________________________________________
+
 /**.Function.hash2:
 ..cat:Index
 ..summary:Computes an unique hash value of a shape applied to a sequence, even if the sequence is shorter than the shape span
@@ -572,6 +572,29 @@ You can simply use them with $Shape<TValue, ShapePatternHunter>$ for example.
 		return me.hValue = _hashHardwiredShape(me.hValue, it, TValue(), TSpec());
 	}
 
+//____________________________________________________________________________
+
+	template <typename TValue>
+	inline void
+	_shapeOffsets(String<unsigned> &offsets, Shape<TValue, GenericShape> const &me)
+	{
+		resize(offsets, me.weight, Exact());
+		if (me.weight == 0) return;
+		offsets[0] = 0;
+		for (unsigned i = 1; i < me.weight; ++i)
+			offsets[i] = offsets[i - 1] + me.diffs[i - 1];
+	}
+
+	template <typename TValue, typename TSpec>
+	inline void
+	_shapeOffsets(String<unsigned> &offsets, Shape<TValue, GappedShape<TSpec> > const &me)
+	{
+		resize(offsets, (unsigned)me.weight, Exact());
+		offsets[0] = 0;
+		for (unsigned i = 1; i < (unsigned)me.weight; ++i)
+			offsets[i] = offsets[i - 1] + me.diffs[i - 1];
+	}
+
 //____________________________________________________________________________
 
 	template <typename TValue, typename TSpec, typename TIter>
@@ -197,6 +197,17 @@ namespace SEQAN_NAMESPACE_MAIN
 		return me.hValue;
 	}
 
+	template <typename TValue>
+	inline void
+	_shapeOffsets(String<unsigned> &offsets, Shape<TValue, OneGappedShape> const &me)
+	{
+		resize(offsets, weight(me), Exact());
+		for (unsigned i = 0; i < me.blockLen1; ++i)
+			offsets[i] = i;
+		for (unsigned i = 0; i < me.blockLen2; ++i)
+			offsets[me.blockLen1 + i] = me.blockLen1 + me.gapLen + i;
+	}
+
 	template <typename TValue, typename TIter>
 	inline typename Value< Shape<TValue, OneGappedShape> >::Type
 	hashInit(Shape<TValue, OneGappedShape> &me, TIter it)
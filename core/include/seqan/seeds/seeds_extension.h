@@ -135,7 +135,11 @@ enum ExtensionDirection
 ..param.scoreMatrix: The scoring scheme.
 ...type:Spec.Simple Score
 ...remarks:Only used for the algorithms @Tag.Seed Extension.UngappedXDrop@ and @Tag.Seed Extension.GappedXDrop@
+..returns:Nothing, except for @Tag.Seed Extension.GappedXDrop@ on simple seeds which returns the score of the added extensions (0 if the seed was not extended).
+The begin and end positions of the extended alignment are those of the updated seed.
 ..remarks:You can use the tags, @Tag.Seed Extension.MatchExtend@, @Tag.Seed Extension.UngappedXDrop@, and @Tag.Seed Extension.GappedXDrop@.
+..remarks:The gapped X-drop extension computes the DP matrix anti-diagonal by anti-diagonal and only keeps the cells of the last three anti-diagonals that did not drop off, so the band adapts to the extension.
+If SeqAn is compiled with SSE4.1 or AVX2 support, the cells of an anti-diagonal are computed with vector instructions for $int$ scores.
 ..include:seqan/seeds.h
 */
 
@@ -542,6 +546,81 @@ _updateExtendedSeed(TSeed & seed,
     SEQAN_ASSERT_GEQ(endDiagonal(seed), lowerDiagonal(seed));
 }
 
+// Computes count cells of an anti-diagonal from the previous two anti-diagonals.
+// antiDiag2 and antiDiag1 point to the horizontal and diagonal predecessor of
+// the first cell, subst holds the substitution scores of the cells.  Cells
+// below minScore are set to undefined.  Returns the best value written.
+
+template <typename TScoreValue>
+inline TScoreValue
+_computeXDropAntiDiag(TScoreValue * antiDiag3,
+                      TScoreValue const * antiDiag2,
+                      TScoreValue const * antiDiag1,
+                      TScoreValue const * subst,
+                      size_t count,
+                      TScoreValue gapCost,
+                      TScoreValue minScore,
+                      TScoreValue undefined)
+{
+    TScoreValue best = MinValue<TScoreValue>::VALUE;
+    for (size_t k = 0; k < count; ++k)
+    {
+        TScoreValue tmp = _max(_max(antiDiag2[k], antiDiag2[k + 1]) + gapCost, antiDiag1[k] + subst[k]);
+        if (tmp < minScore)
+        {
+            antiDiag3[k] = undefined;
+        }
+        else
+        {
+            antiDiag3[k] = tmp;
+            best = _max(best, tmp);
+        }
+    }
+    return best;
+}
+
+// The int version uses vector instructions if available.
+
+inline int
+_computeXDropAntiDiag(int * antiDiag3,
+                      int const * antiDiag2,
+                      int const * antiDiag1,
+                      int const * subst,
+                      size_t count,
+                      int gapCost,
+                      int minScore,
+                      int undefined)
+{
+    typedef DPSimdTraits_<__int32> TTraits;
+    typedef TTraits::TVector TVector;
+
+    int best = MinValue<int>::VALUE;
+    size_t k = 0;
+    if (TTraits::LANES > 1 && count >= (size_t)TTraits::LANES)
+    {
+        TVector const vecGap = TTraits::set1(gapCost);
+        TVector const vecMin = TTraits::set1(minScore);
+        TVector const vecUndefined = TTraits::set1(undefined);
+        TVector const vecLowest = TTraits::set1(MinValue<int>::VALUE);
+        TVector vecBest = vecLowest;
+        for (; k + TTraits::LANES <= count; k += TTraits::LANES)
+        {
+            TVector tmp = TTraits::maxOf(TTraits::add(TTraits::maxOf(TTraits::load(antiDiag2 + k),
+                                                                     TTraits::load(antiDiag2 + k + 1)), vecGap),
+                                         TTraits::add(TTraits::load(antiDiag1 + k), TTraits::load(subst + k)));
+            TVector dropped = TTraits::cmpGt(vecMin, tmp);
+            TTraits::store(antiDiag3 + k, TTraits::blend(dropped, vecUndefined, tmp));
+            vecBest = TTraits::maxOf(vecBest, TTraits::blend(dropped, vecLowest, tmp));
+        }
+        int laneBest[TTraits::LANES];
+        TTraits::store(laneBest, vecBest);
+        for (unsigned lane = 0; lane < (unsigned)TTraits::LANES; ++lane)
+            best = _max(best, laneBest[lane]);
+    }
+    return _max(best, _computeXDropAntiDiag<int>(antiDiag3 + k, antiDiag2 + k, antiDiag1 + k, subst + k, count - k,
+                                                 gapCost, minScore, undefined));
+}
+
 template<typename TConfig, typename TQuerySegment, typename TDatabaseSegment, typename TScoreValue, typename TScoreSpec>
 TScoreValue
 _extendSeedGappedXDropOneDirection(
@@ -572,6 +651,7 @@ _extendSeedGappedXDropOneDirection(
     String<TScoreValue> antiDiag1;	//smallest anti-diagonal
 	String<TScoreValue> antiDiag2;
 	String<TScoreValue> antiDiag3;	//current anti-diagonal
+	String<TScoreValue> subst;      // substitution scores on the current anti-diagonal
 
 	// Indices on anti-diagonals include gap column/gap row:
 	//   - decrease indices by 1 for position in query/database segment
@@ -602,39 +682,34 @@ _extendSeedGappedXDropOneDirection(
 		_initAntiDiag3(antiDiag3, offset3, maxCol, antiDiagNo, best - scoreDropOff, gapCost, undefined);
 
 		TScoreValue antiDiagBest = antiDiagNo * gapCost;
-        for (TSize col = minCol; col < maxCol; ++col) {
-			// indices on anti-diagonals
-			TSize i3 = col - offset3;
-			TSize i2 = col - offset2;
-			TSize i1 = col - offset1;
-
-			// indices in query and database segments
-			TSize queryPos, dbPos;
-			if (direction == EXTEND_RIGHT)
+        // substitution scores of the cells in columns [minCol, maxCol)
+        resize(subst, maxCol - minCol, Exact());
+        for (TSize col = minCol; col < maxCol; ++col)
+        {
+            // indices in query and database segments
+            TSize queryPos, dbPos;
+            if (direction == EXTEND_RIGHT)
             {
-				queryPos = col - 1;
-				dbPos = antiDiagNo - col - 1;
-			}
+                queryPos = col - 1;
+                dbPos = antiDiagNo - col - 1;
+            }
             else // direction == EXTEND_LEFT
             {
-				queryPos = cols - 1 - col;
-				dbPos = rows - 1 + col - antiDiagNo;
-			}
-
-			// Calculate matrix entry (-> antiDiag3[col])
-			TScoreValue tmp = _max(antiDiag2[i2-1], antiDiag2[i2]) + gapCost;
-			tmp = _max(tmp, antiDiag1[i1-1] + score(scoringScheme, sequenceEntryForScore(scoringScheme, querySeg, queryPos),
-			                                        sequenceEntryForScore(scoringScheme, databaseSeg, dbPos)));
-			if (tmp < best - scoreDropOff)
-            {
-				antiDiag3[i3] = undefined;
-			}
-            else
-            {
-				antiDiag3[i3] = tmp;
-				antiDiagBest = _max(antiDiagBest, tmp);
-			}
+                queryPos = cols - 1 - col;
+                dbPos = rows - 1 + col - antiDiagNo;
+            }
+            subst[col - minCol] = score(scoringScheme, sequenceEntryForScore(scoringScheme, querySeg, queryPos),
+                                        sequenceEntryForScore(scoringScheme, databaseSeg, dbPos));
         }
+
+        // Calculate matrix entries (-> antiDiag3[minCol - offset3 .. maxCol - offset3])
+        TScoreValue minScore = best - scoreDropOff;
+        antiDiagBest = _max(antiDiagBest,
+                            _computeXDropAntiDiag(begin(antiDiag3, Standard()) + (minCol - offset3),
+                                                  begin(antiDiag2, Standard()) + (minCol - offset2 - 1),
+                                                  begin(antiDiag1, Standard()) + (minCol - offset1 - 1),
+                                                  begin(subst, Standard()), maxCol - minCol,
+                                                  gapCost, minScore, undefined));
 		best = _max(best, antiDiagBest);
 
 		// Calculate new minCol and minCol
@@ -701,14 +776,17 @@ _extendSeedGappedXDropOneDirection(
 		}
 	}
 
+	// the seed could not be extended
+	if (longestExtensionScore == undefined)
+		return 0;
+
 	// update seed
-    if (longestExtensionScore != undefined)
-		_updateExtendedSeed(seed, direction, longestExtensionCol, longestExtensionRow, lowerDiag, upperDiag);
+	_updateExtendedSeed(seed, direction, longestExtensionCol, longestExtensionRow, lowerDiag, upperDiag);
 	return longestExtensionScore;
 }
 
 template <typename TConfig, typename TDatabase, typename TQuery, typename TScoreValue, typename TScoreSpec>
-inline void 
+inline TScoreValue
 extendSeed(Seed<Simple, TConfig> & seed, 
 		   TDatabase const & database,
 		   TQuery const & query,
@@ -730,6 +808,7 @@ extendSeed(Seed<Simple, TConfig> & seed,
     SEQAN_ASSERT_LT(scoreGapExtend(scoringScheme), 0);
     SEQAN_ASSERT_EQ(scoreGapExtend(scoringScheme), scoreGapOpen(scoringScheme));
 
+    TScoreValue extensionScore = 0;
 	if (direction == EXTEND_LEFT || direction == EXTEND_BOTH)
     {
         // Do not extend to the left if we are already at the beginning of an
@@ -741,7 +820,8 @@ extendSeed(Seed<Simple, TConfig> & seed,
         TDatabasePrefix databasePrefix = prefix(database, beginPositionH(seed));
         TQueryPrefix queryPrefix = prefix(query, beginPositionV(seed));
         // TODO(holtgrew): Update _extendSeedGappedXDropOneDirection and switch query/database order.
-        _extendSeedGappedXDropOneDirection(seed, queryPrefix, databasePrefix, EXTEND_LEFT, scoringScheme, scoreDropOff);
+        extensionScore += _extendSeedGappedXDropOneDirection(seed, queryPrefix, databasePrefix, EXTEND_LEFT,
+                                                             scoringScheme, scoreDropOff);
     }
 
 	if (direction == EXTEND_RIGHT || direction == EXTEND_BOTH)
@@ -759,10 +839,12 @@ extendSeed(Seed<Simple, TConfig> & seed,
 		// std::cout << "query = " << query << std::endl;
 		// std::cout << "query Suffix = " << querySuffix << std::endl;
         // TODO(holtgrew): Update _extendSeedGappedXDropOneDirection and switch query/database order.
-        _extendSeedGappedXDropOneDirection(seed, querySuffix, databaseSuffix, EXTEND_RIGHT, scoringScheme, scoreDropOff);
+        extensionScore += _extendSeedGappedXDropOneDirection(seed, querySuffix, databaseSuffix, EXTEND_RIGHT,
+                                                             scoringScheme, scoreDropOff);
     }
 
     // TODO(holtgrew): Update seed's score?!
+    return extensionScore;
 }
 
 
@@ -69,6 +69,7 @@
 #include <seqan/basic.h>
 #include <seqan/file.h>
 #include <seqan/sequence.h>
+#include <seqan/parallel.h>
 
 // ===========================================================================
 // Stream Concept, Adaptions, Stream Class and Specializations.
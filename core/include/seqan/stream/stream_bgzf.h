@@ -63,6 +63,7 @@
 #ifndef EXTRAS_INCLUDE_SEQAN_STREAM_STREAM_BGZF_H_
 #define EXTRAS_INCLUDE_SEQAN_STREAM_STREAM_BGZF_H_
 
+#include <list>
 #include <map>
 
 #include <zlib.h>
@@ -79,6 +80,7 @@ struct Bgzf_;
 typedef Tag<Bgzf_> Bgzf;
 template <> class Stream<Bgzf>;
 inline void close(Stream<Bgzf> & stream);
+inline int streamFlush(Stream<Bgzf> & stream);
 
 // ============================================================================
 // Tags, Classes, Enums
@@ -91,6 +93,103 @@ struct BgzfCacheEntry_
     int size;
     String<char> block;
     __int64 endOffset;
+    // Position of the block's address in the LRU list of the cache.
+    std::list<__int64>::iterator lruIt;
+};
+
+/**
+.Class.BgzfBlockCache
+..cat:Input/Output
+..summary:Size-bounded cache of decompressed BGZF blocks with least-recently-used eviction.
+..signature:BgzfBlockCache
+..remarks:
+Each @Spec.BGZF Stream@ has its own cache which is disabled by default.
+A cache object can also be shared by several streams on the same file, e.g. one stream per region query, using @Function.setBlockCache@.
+Access to the cache is synchronized if OpenMP is enabled so the streams can be used from different threads.
+..remarks:Copying a cache only copies its maximal size, the copy is empty.
+..include:seqan/stream.h
+
+.Memfunc.BgzfBlockCache#BgzfBlockCache
+..class:Class.BgzfBlockCache
+..signature:BgzfBlockCache([maxSize])
+..param.maxSize:Maximal number of bytes of decompressed data in the cache, $0$ disables caching.
+...default:0
+...type:nolink:$__int64$
+ */
+
+class BgzfBlockCache
+{
+public:
+    typedef std::map<__int64, BgzfCacheEntry_ *> TEntries_;
+    typedef std::list<__int64> TLruList_;
+
+    // The cached blocks by their address.
+    TEntries_ _entries;
+
+    // Addresses of the cached blocks, most recently used first.
+    TLruList_ _lru;
+
+    // Number of bytes in cached blocks.
+    __int64 _size;
+
+    // Maximum cache size, as number of bytes in cached blocks.
+    __int64 _maxSize;
+
+    // Number of lookups that could and could not be answered from the cache.
+    __uint64 _hits;
+    __uint64 _misses;
+
+    BgzfBlockCache() : _size(0), _maxSize(0), _hits(0), _misses(0)
+    {}
+
+    explicit BgzfBlockCache(__int64 maxSize) : _size(0), _maxSize(maxSize), _hits(0), _misses(0)
+    {}
+
+    // Copies only get the maximal size, not the cached blocks.
+    BgzfBlockCache(BgzfBlockCache const & other) : _size(0), _maxSize(other._maxSize), _hits(0), _misses(0)
+    {}
+
+    BgzfBlockCache & operator=(BgzfBlockCache const & other)
+    {
+        _clear();
+        _maxSize = other._maxSize;
+        return *this;
+    }
+
+    ~BgzfBlockCache()
+    {
+        _clear();
+    }
+
+    void _clear()
+    {
+        for (TEntries_::iterator it = _entries.begin(); it != _entries.end(); ++it)
+            delete it->second;
+        _entries.clear();
+        _lru.clear();
+        _size = 0;
+    }
+};
+
+// One block in the block queue of the BGZF stream.  When reading, the compressed data is read sequentially by the
+// consuming thread, the blocks are then inflated in parallel and handed out in file order.  When writing, full blocks
+// are collected, deflated in parallel and then written out in order.
+
+struct BgzfBlockBuffer_
+{
+    // Address of the block in the file and address of the following block.
+    __int64 address;
+    __int64 endOffset;
+    // Length of the compressed block and of the uncompressed data, negative if (de)compression failed.
+    int compressedLength;
+    int size;
+    // Number of uncompressed bytes that did not fit into the compressed block when writing.
+    int remaining;
+    String<char> compressedBlock;
+    String<char> uncompressedBlock;
+
+    BgzfBlockBuffer_() : address(0), endOffset(0), compressedLength(0), size(0), remaining(0)
+    {}
 };
 
 /**
@@ -152,14 +251,8 @@ public:
     // Offset in the current block.
     __int32 _blockOffset;
 
-    // Cache of decompressed blocks.
-    std::map<__int64, BgzfCacheEntry_ *> _cache;
-
-    // Number of bytes in cached blocks.
-    int _cacheSize;
-
-    // Maximum cache size, as number of bytes in cached blocks.
-    int _maxCacheSize;
+    // Cache of decompressed blocks, owned by the stream or shared with other streams.
+    Holder<BgzfBlockCache> _cache;
 
     // Whether or not the file is owned (i.e. opened with open()) or just attached to an already open file via POSIX
     // file handle.
@@ -168,8 +261,24 @@ public:
     // Size of the file in bytes as it is on the disk.
     __int64 _fileSize;
 
+    // Number of threads used for (de)compressing blocks, 1 disables the block queue.
+    unsigned _numThreads;
+
+    // Number of blocks to read ahead or to collect before writing when the block queue is enabled.
+    unsigned _numBlocks;
+
+    // The queued blocks.  When reading, [_queueBegin, _queueEnd) are the ones not handed out yet.  When writing,
+    // [0, _queueEnd) are the full blocks not written out yet.
+    String<BgzfBlockBuffer_> _blockQueue;
+    unsigned _queueBegin;
+    unsigned _queueEnd;
+
+    // Error that occured while reading ahead after some blocks were queued, reported once these are handed out.
+    int _queueError;
+
     Stream() : _error(0), _atEof(false), _openMode(0), _compressLevel(Z_DEFAULT_COMPRESSION), _blockPosition(0),
-               _blockLength(0), _blockOffset(0), _cacheSize(0), _maxCacheSize(0), _fileOwned(false), _fileSize(0)
+               _blockLength(0), _blockOffset(0), _fileOwned(false), _fileSize(0),
+               _numThreads(1), _numBlocks(0), _queueBegin(0), _queueEnd(0), _queueError(0)
     {}
 
     ~Stream()
@@ -370,6 +479,160 @@ _bgzfCheckHeader(char const * header)
             _bgzfUnpackInt16((unsigned char*)&header[14]) == BGZF_LEN);
 }
 
+// ----------------------------------------------------------------------------
+// Helper Function _bgzfEvictFromCache()
+// ----------------------------------------------------------------------------
+
+// Remove least recently used blocks until at most maxSize bytes are cached.  Must be called in the critical section.
+
+inline void
+_bgzfEvictFromCache(BgzfBlockCache & cache, __int64 maxSize)
+{
+    while (cache._size > maxSize)
+    {
+        SEQAN_ASSERT_NOT(cache._lru.empty());
+        BgzfBlockCache::TEntries_::iterator it = cache._entries.find(cache._lru.back());
+        SEQAN_ASSERT(it != cache._entries.end());
+        cache._size -= length(it->second->block);
+        delete it->second;
+        cache._entries.erase(it);
+        cache._lru.pop_back();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function clear()
+// ----------------------------------------------------------------------------
+
+/**
+.Function.clear
+..class:Class.BgzfBlockCache
+..param.object.type:Class.BgzfBlockCache
+..remarks:Clearing a @Class.BgzfBlockCache@ removes all blocks but keeps the maximal size and the hit and miss counters.
+ */
+
+inline void
+clear(BgzfBlockCache & cache)
+{
+    SEQAN_OMP_PRAGMA(critical (bgzfBlockCache))
+    _bgzfEvictFromCache(cache, 0);
+}
+
+// ----------------------------------------------------------------------------
+// Function setMaxCacheSize()
+// ----------------------------------------------------------------------------
+
+/**
+.Function.setMaxCacheSize
+..class:Class.BgzfBlockCache
+..class:Spec.BGZF Stream
+..cat:Input/Output
+..summary:Set the maximal number of bytes of decompressed data in a BGZF block cache.
+..signature:setMaxCacheSize(cache, maxSize)
+..signature:setMaxCacheSize(stream, maxSize)
+..param.cache:The cache to configure.
+...type:Class.BgzfBlockCache
+..param.stream:The stream whose cache to configure.
+...type:Spec.BGZF Stream
+..param.maxSize:The maximal cache size in bytes, $0$ disables caching.
+...type:nolink:$__int64$
+..remarks:Least recently used blocks are evicted if the cache is larger than $maxSize$.
+..remarks:A full block has 64 KiB of decompressed data.
+..include:seqan/stream.h
+ */
+
+inline void
+setMaxCacheSize(BgzfBlockCache & cache, __int64 maxSize)
+{
+    SEQAN_OMP_PRAGMA(critical (bgzfBlockCache))
+    {
+        cache._maxSize = maxSize;
+        _bgzfEvictFromCache(cache, maxSize);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Function getCacheSize()
+// ----------------------------------------------------------------------------
+
+/**
+.Function.getCacheSize
+..class:Class.BgzfBlockCache
+..cat:Input/Output
+..summary:Return the number of bytes of decompressed data in a BGZF block cache.
+..signature:getCacheSize(cache)
+..param.cache:The cache to query.
+...type:Class.BgzfBlockCache
+..returns:$__int64$ with the number of cached bytes.
+..include:seqan/stream.h
+ */
+
+inline __int64
+getCacheSize(BgzfBlockCache const & cache)
+{
+    // The size is changed by all readers sharing the cache.
+    __int64 result;
+    SEQAN_OMP_PRAGMA(critical (bgzfBlockCache))
+    result = cache._size;
+    return result;
+}
+
+// ----------------------------------------------------------------------------
+// Function getCacheHits()
+// ----------------------------------------------------------------------------
+
+/**
+.Function.getCacheHits
+..class:Class.BgzfBlockCache
+..cat:Input/Output
+..summary:Return the number of block lookups that were answered from a BGZF block cache.
+..signature:getCacheHits(cache)
+..param.cache:The cache to query.
+...type:Class.BgzfBlockCache
+..returns:$__uint64$ with the number of hits.
+..see:Function.getCacheMisses
+..include:seqan/stream.h
+ */
+
+inline __uint64
+getCacheHits(BgzfBlockCache const & cache)
+{
+    // The counters are updated by all readers sharing the cache.
+    __uint64 result;
+    SEQAN_OMP_PRAGMA(critical (bgzfBlockCache))
+    result = cache._hits;
+    return result;
+}
+
+// ----------------------------------------------------------------------------
+// Function getCacheMisses()
+// ----------------------------------------------------------------------------
+
+/**
+.Function.getCacheMisses
+..class:Class.BgzfBlockCache
+..cat:Input/Output
+..summary:Return the number of block lookups that could not be answered from a BGZF block cache.
+..signature:getCacheMisses(cache)
+..param.cache:The cache to query.
+...type:Class.BgzfBlockCache
+..returns:$__uint64$ with the number of misses.
+..remarks:Blocks are only looked up when the cache is enabled.
+Sequential reading only leads to misses, only reading blocks again after seeking can lead to hits.
+..see:Function.getCacheHits
+..include:seqan/stream.h
+ */
+
+inline __uint64
+getCacheMisses(BgzfBlockCache const & cache)
+{
+    // The counters are updated by all readers sharing the cache.
+    __uint64 result;
+    SEQAN_OMP_PRAGMA(critical (bgzfBlockCache))
+    result = cache._misses;
+    return result;
+}
+
 // ----------------------------------------------------------------------------
 // Helper Function _bgzfLoadBlockFromCache()
 // ----------------------------------------------------------------------------
@@ -379,25 +642,46 @@ _bgzfCheckHeader(char const * header)
 inline int
 _bgzfLoadBlockFromCache(Stream<Bgzf> & stream, __int64 blockAddress)
 {
-    // If there is no block in the cache with this address then return false.
-    std::map<__int64, BgzfCacheEntry_ *>::iterator it = stream._cache.find(blockAddress);
-    if (it == stream._cache.end())
+    BgzfBlockCache & cache = value(stream._cache);
+
+    int size = 0;
+    __int64 endOffset = 0;
+    // The maximal size is read in the critical section as well, it can be changed by other threads.
+    SEQAN_OMP_PRAGMA(critical (bgzfBlockCache))
+    if (cache._maxSize > 0)  // Otherwise caching is disabled.
+    {
+        // If there is no block in the cache with this address then we have a miss.
+        BgzfBlockCache::TEntries_::iterator it = cache._entries.find(blockAddress);
+        if (it == cache._entries.end())
+        {
+            cache._misses += 1;
+        }
+        else
+        {
+            cache._hits += 1;
+            // Mark block as most recently used.
+            cache._lru.splice(cache._lru.begin(), cache._lru, it->second->lruIt);
+
+            // Copy data from cache into uncompressed block buffer.
+            if (!empty(it->second->block))
+                memcpy(&stream._uncompressedBlock[0], &it->second->block[0], length(it->second->block));
+            size = it->second->size;
+            endOffset = it->second->endOffset;
+        }
+    }
+    if (size == 0)
         return 0;
 
     // Update fields of stream.
     if (stream._blockLength != 0)
         stream._blockOffset = 0;
     stream._blockPosition = blockAddress;
-    stream._blockLength = it->second->size;
-
-    // Copy data from cache into uncompressed block buffer.
-    if (!empty(it->second->block))
-        memcpy(&stream._uncompressedBlock[0], &it->second->block[0], length(it->second->block));
+    stream._blockLength = size;
 
     // Seek to end of cached block in the underlying file.
-    seek(stream._file, it->second->endOffset, SEEK_SET);
+    seek(stream._file, endOffset, SEEK_SET);
 
-    return it->second->size;
+    return size;
 }
 
 // ----------------------------------------------------------------------------
@@ -407,49 +691,48 @@ _bgzfLoadBlockFromCache(Stream<Bgzf> & stream, __int64 blockAddress)
 inline bool
 _bgzfCacheBlock(Stream<Bgzf> & stream, size_t size)
 {
-    if (stream._blockLength > stream._maxCacheSize)
+    BgzfBlockCache & cache = value(stream._cache);
+    if (stream._blockLength <= 0)
         return false;  // Cannot cache this block.
-    if (stream._cache.find(stream._blockPosition) != stream._cache.end())
-        return true;  // Block is already cached.
-
-    // TODO(holtgrew): Implement LRU scheme?
-    
-    // Throw out blocks from cache until the new cache fits.  We simply remove the first block which should not make
-    // performance degrade much in practice.
-    while (stream._cacheSize + stream._blockLength > stream._maxCacheSize)
+
+    bool cached = false;
+    SEQAN_OMP_PRAGMA(critical (bgzfBlockCache))
+    if (stream._blockLength <= cache._maxSize)  // Otherwise the block does not fit into the cache.
     {
-        SEQAN_ASSERT_NOT(stream._cache.empty());
-        std::map<__int64, BgzfCacheEntry_ *>::iterator it = stream._cache.begin();
-        stream._cacheSize -= length(it->second->block);
-        delete it->second;
-        stream._cache.erase(it);
+        cached = true;
+        if (cache._entries.find(stream._blockPosition) == cache._entries.end())
+        {
+            // Throw out least recently used blocks from cache until the new block fits.
+            _bgzfEvictFromCache(cache, cache._maxSize - stream._blockLength);
+
+            // Create new cache entry, copy out block data and put it into the cache.
+            BgzfCacheEntry_ * entry = new BgzfCacheEntry_();
+            entry->size = stream._blockLength;
+            entry->block = prefix(stream._uncompressedBlock, stream._blockLength);
+            entry->endOffset = stream._blockPosition + size;
+            cache._lru.push_front(stream._blockPosition);
+            entry->lruIt = cache._lru.begin();
+            cache._entries[stream._blockPosition] = entry;
+
+            cache._size += length(entry->block);
+            SEQAN_ASSERT_LEQ(cache._size, cache._maxSize);
+        }
     }
 
-    // Create new cache entry, copy out block data and put it into the cache.
-    BgzfCacheEntry_ * entry = new BgzfCacheEntry_();
-    entry->size = stream._blockLength;
-    entry->block = prefix(stream._uncompressedBlock, stream._blockLength);
-    entry->endOffset = stream._blockPosition + size;
-    stream._cache[stream._blockPosition] = entry;
-
-    stream._cacheSize += length(entry->block);
-    SEQAN_ASSERT_LEQ(stream._cacheSize, stream._maxCacheSize);
-
-    return 0;
+    return cached;
 }
 
 // ----------------------------------------------------------------------------
-// Helper Function _bgzfCacheBlock()
+// Helper Function _bgzfClearCache()
 // ----------------------------------------------------------------------------
 
+// Clear the cache if it is owned by the stream, shared caches are kept.
+
 inline void
 _bgzfClearCache(Stream<Bgzf> & stream)
 {
-    typedef std::map<__int64, BgzfCacheEntry_ *>::iterator TIterator;
-    for (TIterator it = stream._cache.begin(); it != stream._cache.end(); ++it)
-        delete it->second;
-    stream._cacheSize = 0;
-    stream._cache.clear();
+    if (!empty(stream._cache) && !dependent(stream._cache))
+        clear(value(stream._cache));
 }
 
 // ----------------------------------------------------------------------------
@@ -459,7 +742,8 @@ _bgzfClearCache(Stream<Bgzf> & stream)
 // Inflate from compression to decompression buffer.
 
 inline int
-_bgzfInflateBlock(Stream<Bgzf> & stream, size_t blockLength)
+_bgzfInflateBlock(char * uncompressedBlock, size_t uncompressedLength, char const * compressedBlock,
+                  size_t blockLength)
 {
     int const GZIP_WINDOW_BITS = -15;  // no zlib header
 
@@ -467,10 +751,10 @@ _bgzfInflateBlock(Stream<Bgzf> & stream, size_t blockLength)
 	int status;
     zs.zalloc = NULL;
     zs.zfree = NULL;
-    zs.next_in = static_cast<Bytef *>(static_cast<void *>(&stream._compressedBlock[0])) + 18;
+    zs.next_in = static_cast<Bytef *>(static_cast<void *>(const_cast<char *>(compressedBlock))) + 18;
     zs.avail_in = blockLength - 16;
-    zs.next_out = static_cast<Bytef *>(static_cast<void *>(&stream._uncompressedBlock[0]));
-    zs.avail_out = length(stream._uncompressedBlock);
+    zs.next_out = static_cast<Bytef *>(static_cast<void *>(uncompressedBlock));
+    zs.avail_out = uncompressedLength;
 
     status = inflateInit2(&zs, GZIP_WINDOW_BITS);
     if (status != Z_OK)
@@ -490,27 +774,28 @@ _bgzfInflateBlock(Stream<Bgzf> & stream, size_t blockLength)
     return zs.total_out;
 }
 
+inline int
+_bgzfInflateBlock(Stream<Bgzf> & stream, size_t blockLength)
+{
+    return _bgzfInflateBlock(&stream._uncompressedBlock[0], length(stream._uncompressedBlock),
+                             &stream._compressedBlock[0], blockLength);
+}
+
 // ----------------------------------------------------------------------------
-// Helper Function _bgzfReadBlock()
+// Helper Function _bgzfReadCompressedBlock()
 // ----------------------------------------------------------------------------
 
-// Returns 0 on success, -1 on error, -2 on eof.
+// Read the next compressed block from the underlying file into compressedBlock which must have a length of at least
+// 64 KiB.  Returns 0 on success, -1 on error, -2 on eof.  blockLength is set to the length of the compressed block, 0
+// if no data could be read.
 
 inline int
-_bgzfReadBlock(Stream<Bgzf> & stream)
+_bgzfReadCompressedBlock(char * compressedBlock, int & blockLength, Stream<Bgzf> & stream)
 {
     int const BLOCK_HEADER_LENGTH = 18;
-    // Make sure there is enough space in the buffer for compressed data.
-    unsigned const MAX_BLOCK_SIZE = 64 * 1024;
-    resize(stream._compressedBlock, MAX_BLOCK_SIZE);
-    resize(stream._uncompressedBlock, MAX_BLOCK_SIZE);
 
     char header[BLOCK_HEADER_LENGTH];
-
-    // Get address from block and try to get cached block from this address.
-    __int64 blockAddress = tell(stream._file);
-    if (_bgzfLoadBlockFromCache(stream, blockAddress))
-        return 0;
+    blockLength = 0;
 
     // Try to read the heder.
     __int64 posBefore = tell(stream._file);
@@ -525,12 +810,7 @@ _bgzfReadBlock(Stream<Bgzf> & stream)
     // If no data could be read for the header then we are at the end of the file, this is no error.
     // TODO(holtgrew): Correct with EOF?
     if (count == 0)
-    {
-        stream._blockLength = 0;
         return 0;
-    }
-
-    int size = count;
 
     // Check that the header is valid.
     if (count != sizeof(header))
@@ -539,10 +819,9 @@ _bgzfReadBlock(Stream<Bgzf> & stream)
         return -1;  // Header was invalid.
 
     // Copy header into buffer for compressed data.
-    int blockLength = _bgzfUnpackInt16((unsigned char *)&header[16]) + 1;
-    char * compressedBlock = (char *)&stream._compressedBlock[0];
+    int len = _bgzfUnpackInt16((unsigned char *)&header[16]) + 1;
     memcpy(compressedBlock, header, BLOCK_HEADER_LENGTH);
-    int remaining = blockLength - BLOCK_HEADER_LENGTH;
+    int remaining = len - BLOCK_HEADER_LENGTH;
 
     // Read remainder of block into buffer for compressed data.
     // TODO(holtgrew): Complicated reading because File<> interface is not so good.
@@ -554,12 +833,155 @@ _bgzfReadBlock(Stream<Bgzf> & stream)
     if (count != remaining)
         return -1;  // Read failed.
 
-    size += count;
+    blockLength = len;
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _bgzfTell()
+// ----------------------------------------------------------------------------
+
+// Returns the address of the next block to be handed out.  This is the position in the underlying file unless there
+// are blocks left in the read-ahead queue.
+
+inline __int64
+_bgzfTell(Stream<Bgzf> & stream)
+{
+    if (stream._queueBegin < stream._queueEnd)
+        return stream._blockQueue[stream._queueBegin].address;
+    return tell(stream._file);
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _bgzfClearReadAhead()
+// ----------------------------------------------------------------------------
+
+// Drop all blocks from the read-ahead queue and seek the underlying file to the address of the first dropped block.
+
+inline void
+_bgzfClearReadAhead(Stream<Bgzf> & stream)
+{
+    if (stream._queueBegin < stream._queueEnd)
+        seek(stream._file, stream._blockQueue[stream._queueBegin].address, SEEK_SET);
+    stream._queueBegin = 0;
+    stream._queueEnd = 0;
+    stream._queueError = 0;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _bgzfReadAhead()
+// ----------------------------------------------------------------------------
+
+// Read the next _numBlocks compressed blocks sequentially and inflate them using _numThreads threads.  Returns 0 on
+// success, -1 on error, -2 on eof.  On success, the read-ahead queue is empty iff the end of the data was reached.
+// If reading fails after some blocks were read, these are queued and the error is returned by the next call.
+
+inline int
+_bgzfReadAhead(Stream<Bgzf> & stream)
+{
+    unsigned const MAX_BLOCK_SIZE = 64 * 1024;
+
+    stream._queueBegin = 0;
+    stream._queueEnd = 0;
+    if (stream._queueError != 0)
+        return stream._queueError;
+    if (length(stream._blockQueue) < stream._numBlocks)
+        resize(stream._blockQueue, stream._numBlocks);
+
+    // Read compressed blocks, this is I/O bound and done sequentially.
+    int res = 0;
+    unsigned numBlocks = 0;
+    for (; numBlocks < stream._numBlocks; ++numBlocks)
+    {
+        BgzfBlockBuffer_ & block = stream._blockQueue[numBlocks];
+        resize(block.compressedBlock, MAX_BLOCK_SIZE);
+        resize(block.uncompressedBlock, MAX_BLOCK_SIZE);
+        block.address = tell(stream._file);
+        res = _bgzfReadCompressedBlock(&block.compressedBlock[0], block.compressedLength, stream);
+        if (res != 0 || block.compressedLength == 0)
+            break;
+        block.endOffset = tell(stream._file);
+    }
+    if (numBlocks == 0 && res != 0)
+        return res;
+    if (res == -1)
+        stream._queueError = res;
+
+    // Inflate blocks in parallel, each block is inflated independently.
+    int numThreads = stream._numThreads;
+    (void)numThreads;
+    SEQAN_OMP_PRAGMA(parallel for num_threads(numThreads) schedule(dynamic))
+    for (int i = 0; i < static_cast<int>(numBlocks); ++i)
+    {
+        BgzfBlockBuffer_ & block = stream._blockQueue[i];
+        block.size = _bgzfInflateBlock(&block.uncompressedBlock[0], length(block.uncompressedBlock),
+                                       &block.compressedBlock[0], block.compressedLength);
+    }
+
+    stream._queueEnd = numBlocks;
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _bgzfReadBlock()
+// ----------------------------------------------------------------------------
+
+// Returns 0 on success, -1 on error, -2 on eof.
+
+inline int
+_bgzfReadBlock(Stream<Bgzf> & stream)
+{
+    // Make sure there is enough space in the buffer for compressed data.
+    unsigned const MAX_BLOCK_SIZE = 64 * 1024;
+    resize(stream._compressedBlock, MAX_BLOCK_SIZE);
+    resize(stream._uncompressedBlock, MAX_BLOCK_SIZE);
+
+    // Get address from block and try to get cached block from this address.
+    __int64 blockAddress = _bgzfTell(stream);
+    if (stream._queueBegin == stream._queueEnd && _bgzfLoadBlockFromCache(stream, blockAddress))
+        return 0;
+
+    int size = 0;
+    int count = 0;
+    if (stream._numThreads > 1u && stream._numBlocks > 0u)
+    {
+        // Refill read-ahead queue if empty.
+        if (stream._queueBegin == stream._queueEnd)
+        {
+            int res = _bgzfReadAhead(stream);
+            if (res != 0)
+                return res;
+            if (stream._queueBegin == stream._queueEnd)
+            {
+                stream._blockLength = 0;
+                return 0;
+            }
+        }
+
+        // Hand out the next block from the queue.
+        BgzfBlockBuffer_ & block = stream._blockQueue[stream._queueBegin++];
+        if (block.size < 0)
+            return -1;  // Decompression failed.
+        swap(stream._uncompressedBlock, block.uncompressedBlock);
+        size = block.compressedLength;
+        count = block.size;
+    }
+    else
+    {
+        int res = _bgzfReadCompressedBlock(&stream._compressedBlock[0], size, stream);
+        if (res != 0)
+            return res;
+        if (size == 0)
+        {
+            stream._blockLength = 0;
+            return 0;
+        }
 
-    // Decompress between compression and decompression buffer.
-    count = _bgzfInflateBlock(stream, blockLength);
-    if (count < 0)
-        return -1;  // Decompression failed.
+        // Decompress between compression and decompression buffer.
+        count = _bgzfInflateBlock(stream, size);
+        if (count < 0)
+            return -1;  // Decompression failed.
+    }
 
     if (stream._blockLength != 0)
         stream._blockOffset = 0;  // Do not reset offset if this read follows a seek.
@@ -577,9 +999,12 @@ _bgzfReadBlock(Stream<Bgzf> & stream)
 // ----------------------------------------------------------------------------
 
 // Deflate from uncompressed block to compressed block.  Also add extra field that stores the compressed block length.
+// Both buffers must have a length of 64 KiB.  Data that did not fit into the compressed block is moved to the front of
+// the uncompressed block and its length is returned in remaining.
 
 inline int
-_bgzfDeflateBlock(Stream<Bgzf> & stream, int blockLength)
+_bgzfDeflateBlock(char * compressedBlock, char * uncompressedBlock, int blockLength, int compressLevel,
+                  int & remaining)
 {
     const int BLOCK_HEADER_LENGTH = 18;
     const int BLOCK_FOOTER_LENGTH = 8;
@@ -599,12 +1024,9 @@ _bgzfDeflateBlock(Stream<Bgzf> & stream, int blockLength)
 
     const int MAX_BLOCK_SIZE = 64 * 1024;
 
-    // Make sure there is enough space in the buffer for compressed and uncompressed data.
-    resize(stream._compressedBlock, MAX_BLOCK_SIZE);
-    resize(stream._uncompressedBlock, MAX_BLOCK_SIZE);
-
-    char * buffer = &stream._compressedBlock[0];
-    int bufferSize = length(stream._compressedBlock);
+    char * buffer = compressedBlock;
+    int bufferSize = MAX_BLOCK_SIZE;
+    remaining = 0;
 
     // Init gzip header
     buffer[0] = GZIP_ID1;
@@ -634,12 +1056,12 @@ _bgzfDeflateBlock(Stream<Bgzf> & stream, int blockLength)
         z_stream zs;
         zs.zalloc = NULL;
         zs.zfree = NULL;
-        zs.next_in = static_cast<Bytef *>(static_cast<void *>(&stream._uncompressedBlock[0]));
+        zs.next_in = static_cast<Bytef *>(static_cast<void *>(uncompressedBlock));
         zs.avail_in = inputLength;
         zs.next_out = static_cast<Bytef *>(static_cast<void *>(&buffer[BLOCK_HEADER_LENGTH]));
         zs.avail_out = bufferSize - BLOCK_HEADER_LENGTH - BLOCK_FOOTER_LENGTH;
 
-        int status = deflateInit2(&zs, stream._compressLevel, Z_DEFLATED,
+        int status = deflateInit2(&zs, compressLevel, Z_DEFLATED,
                                   GZIP_WINDOW_BITS, Z_DEFAULT_MEM_LEVEL, Z_DEFAULT_STRATEGY);
         if (status != Z_OK)
             return -1;  // deflateInit2() failed.
@@ -675,25 +1097,133 @@ _bgzfDeflateBlock(Stream<Bgzf> & stream, int blockLength)
     // Set compressed length into buffer, compute CRC and write CRC into buffer.
     _bgzfPackInt16((unsigned char*)&buffer[16], compressedLength - 1);
     __uint32 crc = crc32(0L, NULL, 0L);
-    crc = crc32(crc, static_cast<Bytef *>(static_cast<void *>(&stream._uncompressedBlock[0])), inputLength);
+    crc = crc32(crc, static_cast<Bytef *>(static_cast<void *>(uncompressedBlock)), inputLength);
     _bgzfPackInt32((unsigned char*)&buffer[compressedLength - 8], crc);
     _bgzfPackInt32((unsigned char*)&buffer[compressedLength - 4], inputLength);
 
     // Copy data that did not fit into the compressed block forward in the uncompressed data buffer.
-    int remaining = blockLength - inputLength;
+    remaining = blockLength - inputLength;
     if (remaining > 0)
     {
         if (remaining > inputLength)
             return -1;  // Remained too large.  Should never happen (checking here so we can use memcpy).
-        memcpy(&stream._uncompressedBlock[0],
-               &stream._uncompressedBlock[0] + inputLength,
+        memcpy(uncompressedBlock,
+               uncompressedBlock + inputLength,
                remaining);
     }
-    stream._blockOffset = remaining;
 
     return compressedLength;
 }
 
+inline int
+_bgzfDeflateBlock(Stream<Bgzf> & stream, int blockLength)
+{
+    const int MAX_BLOCK_SIZE = 64 * 1024;
+
+    // Make sure there is enough space in the buffer for compressed and uncompressed data.
+    resize(stream._compressedBlock, MAX_BLOCK_SIZE);
+    resize(stream._uncompressedBlock, MAX_BLOCK_SIZE);
+
+    int remaining = 0;
+    int compressedLength = _bgzfDeflateBlock(&stream._compressedBlock[0], &stream._uncompressedBlock[0], blockLength,
+                                             stream._compressLevel, remaining);
+    if (compressedLength >= 0)
+        stream._blockOffset = remaining;
+    return compressedLength;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _bgzfWriteCompressedBlock()
+// ----------------------------------------------------------------------------
+
+// Write compressed block to the underlying file, returns 0 on success, -1 on errors.
+
+inline int
+_bgzfWriteCompressedBlock(Stream<Bgzf> & stream, char const * compressedBlock, int blockLength)
+{
+    typedef Position<Stream<Bgzf> >::Type TPos;
+    TPos posBefore = tell(stream._file);
+    if (!write(stream._file, compressedBlock, blockLength))
+        return -1;  // Could not write.
+    TPos posAfter = tell(stream._file);
+    int count = posAfter - posBefore;
+    if (count != blockLength)
+        return -1;  // Writing failed.
+
+    stream._blockPosition += blockLength;
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _bgzfWriteQueue()
+// ----------------------------------------------------------------------------
+
+// Deflate all queued blocks using _numThreads threads and write them out in order.  Returns 0 on success, -1 on errors.
+
+inline int
+_bgzfWriteQueue(Stream<Bgzf> & stream)
+{
+    // Deflate blocks in parallel, each block is deflated independently.
+    int numThreads = stream._numThreads;
+    int compressLevel = stream._compressLevel;
+    (void)numThreads;
+    SEQAN_OMP_PRAGMA(parallel for num_threads(numThreads) schedule(dynamic))
+    for (int i = 0; i < static_cast<int>(stream._queueEnd); ++i)
+    {
+        BgzfBlockBuffer_ & block = stream._blockQueue[i];
+        block.compressedLength = _bgzfDeflateBlock(&block.compressedBlock[0], &block.uncompressedBlock[0], block.size,
+                                                   compressLevel, block.remaining);
+    }
+
+    // Write out blocks in order.  The rare remainders of blocks that did not compress well enough are deflated here.
+    unsigned queueEnd = stream._queueEnd;
+    stream._queueEnd = 0;
+    for (unsigned i = 0; i < queueEnd; ++i)
+    {
+        BgzfBlockBuffer_ & block = stream._blockQueue[i];
+        while (true)
+        {
+            if (block.compressedLength < 0)
+                return -1;  // Deflation failed.
+            if (_bgzfWriteCompressedBlock(stream, &block.compressedBlock[0], block.compressedLength) != 0)
+                return -1;  // Writing failed.
+            if (block.remaining == 0)
+                break;
+            block.compressedLength = _bgzfDeflateBlock(&block.compressedBlock[0], &block.uncompressedBlock[0],
+                                                       block.remaining, compressLevel, block.remaining);
+        }
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Helper Function _bgzfQueueBlock()
+// ----------------------------------------------------------------------------
+
+// Move the current uncompressed block into the block queue and write out the queue once it is full.  Returns 0 on
+// success, -1 on errors.
+
+inline int
+_bgzfQueueBlock(Stream<Bgzf> & stream)
+{
+    unsigned const MAX_BLOCK_SIZE = 64 * 1024;
+
+    if (length(stream._blockQueue) < stream._numBlocks)
+        resize(stream._blockQueue, stream._numBlocks);
+
+    BgzfBlockBuffer_ & block = stream._blockQueue[stream._queueEnd++];
+    resize(block.compressedBlock, MAX_BLOCK_SIZE);
+    resize(block.uncompressedBlock, MAX_BLOCK_SIZE);
+    swap(stream._uncompressedBlock, block.uncompressedBlock);
+    block.size = stream._blockOffset;
+    stream._blockOffset = 0;
+
+    if (stream._queueEnd == stream._numBlocks)
+        return _bgzfWriteQueue(stream);
+    return 0;
+}
+
 // ----------------------------------------------------------------------------
 // Function attachToFile
 // ----------------------------------------------------------------------------
@@ -749,6 +1279,9 @@ open(Stream<Bgzf> & stream, char const * filename, char const * mode)
     stream._blockLength = 0;
     stream._blockOffset = 0;
     stream._fileSize = 0;
+    stream._queueBegin = 0;
+    stream._queueEnd = 0;
+    stream._queueError = 0;
 
     // Actually open files.
     if (mode[0] == 'r' || mode[0] == 'R')  // Open for reading.
@@ -794,6 +1327,147 @@ open(Stream<Bgzf> & stream, char const * filename, char const * mode)
     return false;
 }
 
+// ----------------------------------------------------------------------------
+// Function setBlockCache()
+// ----------------------------------------------------------------------------
+
+/**
+.Function.setBlockCache
+..class:Spec.BGZF Stream
+..cat:Input/Output
+..summary:Let a BGZF Stream use a shared block cache.
+..signature:setBlockCache(stream, cache)
+..param.stream:The BGZF Stream to configure.
+...type:Spec.BGZF Stream
+..param.cache:The cache to use, must outlive the stream.
+...type:Class.BgzfBlockCache
+..remarks:All streams sharing a cache must read the same file since blocks are identified by their file offset.
+..example.code:
+BgzfBlockCache cache(64 * 1024 * 1024);  // 64 MiB
+Stream<Bgzf> stream1, stream2;
+open(stream1, "example.bam", "r");
+open(stream2, "example.bam", "r");
+setBlockCache(stream1, cache);
+setBlockCache(stream2, cache);
+..see:Function.blockCache
+..include:seqan/stream.h
+ */
+
+inline void
+setBlockCache(Stream<Bgzf> & stream, BgzfBlockCache & cache)
+{
+    setValue(stream._cache, cache);
+}
+
+// ----------------------------------------------------------------------------
+// Function blockCache()
+// ----------------------------------------------------------------------------
+
+/**
+.Function.blockCache
+..class:Spec.BGZF Stream
+..cat:Input/Output
+..summary:Return the block cache of a BGZF Stream.
+..signature:blockCache(stream)
+..param.stream:The BGZF Stream to query.
+...type:Spec.BGZF Stream
+..returns:Reference to the @Class.BgzfBlockCache@ used by the stream, either its own or the one set by @Function.setBlockCache@.
+..include:seqan/stream.h
+ */
+
+inline BgzfBlockCache &
+blockCache(Stream<Bgzf> & stream)
+{
+    return value(stream._cache);
+}
+
+// ----------------------------------------------------------------------------
+// Function setMaxCacheSize()
+// ----------------------------------------------------------------------------
+
+inline void
+setMaxCacheSize(Stream<Bgzf> & stream, __int64 maxSize)
+{
+    setMaxCacheSize(value(stream._cache), maxSize);
+}
+
+// ----------------------------------------------------------------------------
+// Function setNumThreads()
+// ----------------------------------------------------------------------------
+
+/**
+.Function.setNumThreads
+..class:Spec.BGZF Stream
+..cat:Input/Output
+..summary:Set the number of threads to use for compressing and decompressing BGZF blocks.
+..signature:setNumThreads(stream, numThreads[, numBlocks])
+..param.stream:The BGZF Stream to configure.
+...type:Spec.BGZF Stream
+..param.numThreads:The number of threads to use, $1$ disables parallel (de)compression.
+...type:nolink:$unsigned$
+..param.numBlocks:The number of blocks to read ahead or to collect before writing.
+...default:$4 * numThreads$
+...type:nolink:$unsigned$
+..remarks:
+When reading with more than one thread, the stream reads the next $numBlocks$ compressed blocks from the file, inflates them in parallel and then hands them out in file order.
+Seeking to a block that is already in the read-ahead queue does not cause any data to be read again.
+..remarks:
+When writing with more than one thread, full blocks are collected until there are $numBlocks$ of them.
+These blocks are then deflated in parallel and written out in order.
+@Function.streamFlush@ deflates and writes all collected blocks.
+@Function.streamTell@ writes them out as well, since the virtual offset depends on their compressed sizes.
+Calling it frequently, e.g. for every record, therefore reduces the number of blocks deflated in parallel.
+..remarks:Each queued block needs 128 KiB of buffer memory.
+..remarks:Parallel (de)compression requires OpenMP, the blocks are processed sequentially otherwise.
+..include:seqan/stream.h
+ */
+
+inline void
+setNumThreads(Stream<Bgzf> & stream, unsigned numThreads, unsigned numBlocks)
+{
+    if (numThreads == 0u)
+        numThreads = 1;
+    if (stream._openMode & OPEN_WRONLY)
+        streamFlush(stream);  // Write out queued blocks.
+    else
+        _bgzfClearReadAhead(stream);
+    stream._numThreads = numThreads;
+    stream._numBlocks = (numThreads > 1u) ? numBlocks : 0u;
+}
+
+inline void
+setNumThreads(Stream<Bgzf> & stream, unsigned numThreads)
+{
+    setNumThreads(stream, numThreads, 4 * numThreads);
+}
+
+// ----------------------------------------------------------------------------
+// Function setCompressionLevel()
+// ----------------------------------------------------------------------------
+
+/**
+.Function.setCompressionLevel
+..class:Spec.BGZF Stream
+..cat:Input/Output
+..summary:Set the zlib compression level for writing BGZF blocks.
+..signature:setCompressionLevel(stream, level)
+..param.stream:The BGZF Stream to configure.
+...type:Spec.BGZF Stream
+..param.level:The compression level, $0$ (no compression) to $9$ (best compression), or $-1$ for the zlib default.
+...type:nolink:$int$
+..remarks:The level applies to all blocks that are compressed after the call, i.e. also to already written but not yet flushed data.
+..see:Function.open
+..include:seqan/stream.h
+ */
+
+inline void
+setCompressionLevel(Stream<Bgzf> & stream, int level)
+{
+    if (level < 0 || level > 9)
+        level = Z_DEFAULT_COMPRESSION;
+    stream._compressLevel = level;
+}
+
 // ----------------------------------------------------------------------------
 // Function streamFlush()
 // ----------------------------------------------------------------------------
@@ -801,22 +1475,24 @@ open(Stream<Bgzf> & stream, char const * filename, char const * mode)
 inline int
 streamFlush(Stream<Bgzf> & stream)
 {
+    // With the block queue enabled, the current block is queued and all queued blocks are deflated in parallel.
+    if (stream._numBlocks > 0u)
+    {
+        if (stream._blockOffset > 0 && _bgzfQueueBlock(stream) != 0)
+            return -1;
+        if (stream._queueEnd > 0u)
+            return _bgzfWriteQueue(stream);
+        return 0;
+    }
+
     while (stream._blockOffset > 0)
     {
 		int blockLength = _bgzfDeflateBlock(stream, stream._blockOffset);
         if (blockLength < 0)
             return -1;
 
-        typedef Position<Stream<Bgzf> >::Type TPos;
-        TPos posBefore = tell(stream._file);
-        if (!write(stream._file, &stream._compressedBlock[0], blockLength))
-            return -1;  // Could not write.
-        TPos posAfter = tell(stream._file);
-        int count = posAfter - posBefore;
-        if (count != blockLength)
+        if (_bgzfWriteCompressedBlock(stream, &stream._compressedBlock[0], blockLength) != 0)
             return -1;  // Writing failed.
-
-        stream._blockPosition += blockLength;
     }
 
     return 0;
@@ -851,7 +1527,8 @@ close(Stream<Bgzf> & stream)
             return;  // Could not flush.
         }
 
-        // Write an empty block.
+        // Write an empty block.  The default compression level yields the standard EOF marker.
+        stream._compressLevel = Z_DEFAULT_COMPRESSION;
         int blockLength = _bgzfDeflateBlock(stream, 0);
         typedef Position<Stream<Bgzf> >::Type TPos;
         TPos posBefore = tell(stream._file);
@@ -865,8 +1542,11 @@ close(Stream<Bgzf> & stream)
         flush(stream._file);
     }
 
-    // Clear the cache.
+    // Clear the cache and the read-ahead queue.
     _bgzfClearCache(stream);
+    stream._queueBegin = 0;
+    stream._queueEnd = 0;
+    stream._queueError = 0;
 
     // Close file.
     close(stream._file);
@@ -914,7 +1594,7 @@ streamReadChar(char & c, Stream<Bgzf> & stream)
 	c = stream._uncompressedBlock[stream._blockOffset++];
     if (stream._blockOffset == stream._blockLength)
     {
-        stream._blockPosition = tell(stream._file);
+        stream._blockPosition = _bgzfTell(stream);
         stream._blockOffset = 0;
         stream._blockLength = 0;
     }
@@ -1057,7 +1737,7 @@ streamReadBlock(char * target, Stream<Bgzf> & stream, size_t maxLen)
     // If we read to the end of the block above then switch the block address to the next block and mark it as unread.
     if (stream._blockOffset == stream._blockLength)
     {
-        stream._blockPosition = tell(stream._file);
+        stream._blockPosition = _bgzfTell(stream);
         stream._blockOffset = 0;
         stream._blockLength = 0;
     }
@@ -1097,8 +1777,13 @@ streamWriteBlock(Stream<Bgzf> & stream, char const * source, size_t count)
         inPtr += copyLength;
         bytesWritten += copyLength;
 
-        if (stream._blockOffset == blockLength && streamFlush(stream) != 0)
-            break;
+        if (stream._blockOffset == blockLength)
+        {
+            // Full blocks are only queued when the block queue is enabled.
+            int res = (stream._numBlocks > 0u) ? _bgzfQueueBlock(stream) : streamFlush(stream);
+            if (res != 0)
+                break;
+        }
     }
 
     return bytesWritten;
@@ -1134,13 +1819,33 @@ streamSeek(Stream<Bgzf> & stream, __uint64 virtualPos, int origin)
     // If EOF flag is set then check if we want to keep it.
     if (stream._atEof)
     {
-        __int64 currentPos = tell(stream._file);
+        __int64 currentPos = _bgzfTell(stream);
         if (currentPos != blockAddress)
             stream._atEof = false;
     }
 
-    // Actually perform the seek.
-    seek(stream._file, blockAddress, SEEK_SET);
+    // Seeking into the currently loaded block only requires to update the offset.
+    if (stream._blockLength != 0 && stream._blockPosition == blockAddress && blockOffset < stream._blockLength)
+    {
+        stream._blockOffset = blockOffset;
+        return 0;
+    }
+
+    // Actually perform the seek.  If the target block is in the read-ahead queue then we skip to it, otherwise the
+    // queue is dropped.
+    unsigned i = stream._queueBegin;
+    for (; i < stream._queueEnd; ++i)
+        if (stream._blockQueue[i].address == blockAddress)
+            break;
+    if (i < stream._queueEnd)
+    {
+        stream._queueBegin = i;
+    }
+    else
+    {
+        _bgzfClearReadAhead(stream);
+        seek(stream._file, blockAddress, SEEK_SET);
+    }
 
     // Set the stream state such that the address of the block and the offset in the block are set appropriately but the
     // block is only loaded on the next read.
@@ -1158,6 +1863,10 @@ streamSeek(Stream<Bgzf> & stream, __uint64 virtualPos, int origin)
 inline Position<Stream<Bgzf> >::Type
 streamTell(Stream<Bgzf> & stream)
 {
+    // The address of the current block depends on the compressed sizes of the queued blocks, so these are written out.
+    if ((stream._openMode & OPEN_WRONLY) && stream._queueEnd > 0u && _bgzfWriteQueue(stream) != 0)
+        stream._error = -1;  // Writing the queued blocks failed.
+
     return (stream._blockPosition << 16) | (stream._blockOffset & 0xFFFF);
 }
 
@@ -57,6 +57,14 @@
 #include "test_alignment_algorithms_local.h"
 #include "test_alignment_algorithms_local_banded.h"
 #include "test_align_global_alignment_specialized.h"
+#include "test_alignment_dp_batch_simd.h"
+#include "test_align_local_alignment_striped.h"
+#include "test_alignment_dp_context.h"
+#include "test_alignment_dp_wavefront.h"
+#include "test_alignment_myers_traceback.h"
+#include "test_alignment_dp_matrix_packed.h"
+#include "test_alignment_align_pairs.h"
+#include "test_alignment_band_doubling.h"
 
 #include "test_align_alignment_operations.h"
 
@@ -568,6 +576,68 @@ SEQAN_BEGIN_TESTSUITE(test_align)
     SEQAN_CALL_TEST(test_align_global_alignment_score_myers_hirschberg);
     SEQAN_CALL_TEST(test_align_global_alignment_hirschberg_single_character);
 
+    // ----------------------------------------------------------------------------
+    // Test batch alignment scores.
+    // ----------------------------------------------------------------------------
+
+    SEQAN_CALL_TEST(test_alignment_dp_batch_simd_global_simple);
+    SEQAN_CALL_TEST(test_alignment_dp_batch_simd_global_large_alphabet);
+    SEQAN_CALL_TEST(test_alignment_dp_batch_simd_global_matrix);
+    SEQAN_CALL_TEST(test_alignment_dp_batch_simd_global_long);
+    SEQAN_CALL_TEST(test_alignment_dp_batch_simd_local);
+
+    // ----------------------------------------------------------------------------
+    // Test striped local alignment.
+    // ----------------------------------------------------------------------------
+
+    SEQAN_CALL_TEST(test_align_local_alignment_striped_blosum62);
+    SEQAN_CALL_TEST(test_align_local_alignment_striped_simple);
+    SEQAN_CALL_TEST(test_align_local_alignment_striped_overflow);
+    SEQAN_CALL_TEST(test_align_local_alignment_striped_scan);
+
+    // ----------------------------------------------------------------------------
+    // Test reusable DP workspace.
+    // ----------------------------------------------------------------------------
+
+    SEQAN_CALL_TEST(test_alignment_dp_context_results);
+    SEQAN_CALL_TEST(test_alignment_dp_context_reuse);
+
+    // ----------------------------------------------------------------------------
+    // Test wavefront computation of long alignments.
+    // ----------------------------------------------------------------------------
+
+    SEQAN_CALL_TEST(test_alignment_dp_wavefront_score);
+    SEQAN_CALL_TEST(test_alignment_dp_wavefront_hirschberg);
+
+    // ----------------------------------------------------------------------------
+    // Test bit-vector alignment with traceback.
+    // ----------------------------------------------------------------------------
+
+    SEQAN_CALL_TEST(test_alignment_myers_traceback);
+    SEQAN_CALL_TEST(test_alignment_myers_traceback_banded);
+
+    // ----------------------------------------------------------------------------
+    // Test bit-packed trace matrix.
+    // ----------------------------------------------------------------------------
+
+    SEQAN_CALL_TEST(test_alignment_dp_matrix_packed_access);
+    SEQAN_CALL_TEST(test_alignment_dp_matrix_packed_traceback);
+
+    // ----------------------------------------------------------------------------
+    // Test parallel alignment of many pairs.
+    // ----------------------------------------------------------------------------
+
+    SEQAN_CALL_TEST(test_alignment_align_pairs_global);
+    SEQAN_CALL_TEST(test_alignment_align_pairs_local);
+    SEQAN_CALL_TEST(test_alignment_align_pairs_window);
+
+    // ----------------------------------------------------------------------------
+    // Test banded global alignment with band doubling.
+    // ----------------------------------------------------------------------------
+
+    SEQAN_CALL_TEST(test_alignment_band_doubling_dna);
+    SEQAN_CALL_TEST(test_alignment_band_doubling_matrix);
+
     // -----------------------------------------------------------------------
     // Test Operations On Align Objects
     // -----------------------------------------------------------------------
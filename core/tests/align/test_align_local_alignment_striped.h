@@ -0,0 +1,252 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests for the striped Smith-Waterman with query profiles.  The results
+// are compared against the generic dynamic programming.
+// ==========================================================================
+
+#ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGN_LOCAL_ALIGNMENT_STRIPED_H_
+#define SEQAN_CORE_TESTS_ALIGN_TEST_ALIGN_LOCAL_ALIGNMENT_STRIPED_H_
+
+#include <seqan/basic.h>
+#include <seqan/score.h>
+#include <seqan/align.h>
+
+#include "test_alignment_random.h"
+
+// Recomputes the score of a pairwise alignment from its rows.
+template <typename TAlign, typename TScore>
+int _stripedAlignmentScore(TAlign const & align, TScore const & scoringScheme)
+{
+    using namespace seqan;
+
+    typedef typename Row<TAlign const>::Type TRow;
+
+    TRow & rowH = row(align, 0);
+    TRow & rowV = row(align, 1);
+    SEQAN_ASSERT_EQ(length(rowH), length(rowV));
+
+    int result = 0;
+    bool gapH = false;
+    bool gapV = false;
+    for (unsigned i = 0; i < length(rowH); ++i)
+    {
+        bool isGapH = isGap(rowH, i);
+        bool isGapV = isGap(rowV, i);
+        SEQAN_ASSERT_NOT(isGapH && isGapV);
+        if (isGapH)
+            result += gapH ? scoreGapExtend(scoringScheme) : scoreGapOpen(scoringScheme);
+        else if (isGapV)
+            result += gapV ? scoreGapExtend(scoringScheme) : scoreGapOpen(scoringScheme);
+        else
+            result += score(scoringScheme, source(rowH)[toSourcePosition(rowH, i)],
+                            source(rowV)[toSourcePosition(rowV, i)]);
+        gapH = isGapH;
+        gapV = isGapV;
+    }
+    return result;
+}
+
+template <typename TString, typename TScore>
+int _stripedScalarLocalScore(TString const & seqH, TString const & seqV, TScore const & scoringScheme)
+{
+    using namespace seqan;
+
+    Align<TString> align;
+    resize(rows(align), 2);
+    assignSource(row(align, 0), seqH);
+    assignSource(row(align, 1), seqV);
+    return localAlignment(align, scoringScheme);
+}
+
+// Aligns each query against a set of database sequences, some of which share
+// a mutated copy of the query.
+template <typename TString, typename TScore>
+void _testStripedLocalAlignment(TScore const & scoringScheme, unsigned seed)
+{
+    using namespace seqan;
+
+    unsigned const queryLengths[] = {1, 7, 8, 9, 15, 16, 17, 33, 120};
+    Rng<MersenneTwister> rng(seed);
+
+    for (unsigned q = 0; q < sizeof(queryLengths) / sizeof(unsigned); ++q)
+    {
+        TString query;
+        _randomAlignString(query, queryLengths[q], rng);
+        StripedQueryProfile<TString, TScore> profile(query, scoringScheme);
+
+        for (unsigned d = 0; d < 12; ++d)
+        {
+            TString prefixStr, suffixStr, seqH;
+            _randomAlignString(prefixStr, d * 3, rng);
+            _randomAlignString(suffixStr, 40 - d * 2, rng);
+            seqH = prefixStr;
+            if (d % 2 == 0)
+            {
+                // Insert a copy of the query with some substitutions and a gap.
+                for (unsigned i = 0; i < length(query); ++i)
+                {
+                    if (pickRandomNumber(rng) % 7 == 0)
+                        appendValue(seqH, suffixStr[i % length(suffixStr)]);
+                    else if (i != length(query) / 2 || d % 4 != 0)
+                        appendValue(seqH, query[i]);
+                }
+            }
+            append(seqH, suffixStr);
+
+            int expected = _stripedScalarLocalScore(seqH, query, scoringScheme);
+
+            SEQAN_ASSERT_EQ(localAlignmentScore(seqH, profile), expected);
+
+            Align<TString> stripedAlign;
+            resize(rows(stripedAlign), 2);
+            assignSource(row(stripedAlign, 0), seqH);
+            assignSource(row(stripedAlign, 1), query);
+            SEQAN_ASSERT_EQ(localAlignment(stripedAlign, profile), expected);
+            SEQAN_ASSERT_EQ(_stripedAlignmentScore(stripedAlign, scoringScheme), expected);
+        }
+    }
+}
+
+SEQAN_DEFINE_TEST(test_align_local_alignment_striped_blosum62)
+{
+    using namespace seqan;
+
+    _testStripedLocalAlignment<Peptide>(Blosum62(-1, -11), 1u);
+    _testStripedLocalAlignment<Peptide>(Blosum62(-4, -4), 2u);
+}
+
+SEQAN_DEFINE_TEST(test_align_local_alignment_striped_simple)
+{
+    using namespace seqan;
+
+    _testStripedLocalAlignment<DnaString>(Score<int, Simple>(2, -1, -2), 3u);
+    _testStripedLocalAlignment<DnaString>(Score<int, Simple>(3, -3, -1, -5), 4u);
+}
+
+SEQAN_DEFINE_TEST(test_align_local_alignment_striped_overflow)
+{
+    using namespace seqan;
+
+    Rng<MersenneTwister> rng(5u);
+
+    // Exceeds the range of the 8 bit lanes.
+    Peptide query;
+    _randomAlignString(query, 300, rng);
+    Peptide seqH = "MKVLA";
+    append(seqH, query);
+    append(seqH, "GGHW");
+    Blosum62 blosum(-1, -11);
+    StripedQueryProfile<Peptide, Blosum62> profile(query, blosum);
+    int expected = _stripedScalarLocalScore(seqH, query, blosum);
+    SEQAN_ASSERT_GT(expected, 255);
+    SEQAN_ASSERT_EQ(localAlignmentScore(seqH, profile), expected);
+
+    // Exceeds the range of the 16 bit lanes.
+    DnaString longQuery;
+    _randomAlignString(longQuery, 3500, rng);
+    Score<int, Simple> simple(10, -5, -10);
+    StripedQueryProfile<DnaString, Score<int, Simple> > longProfile(longQuery, simple);
+    SEQAN_ASSERT_EQ(localAlignmentScore(longQuery, longProfile), 35000);
+
+    Align<DnaString> align;
+    resize(rows(align), 2);
+    assignSource(row(align, 0), longQuery);
+    assignSource(row(align, 1), longQuery);
+    SEQAN_ASSERT_EQ(localAlignment(align, longProfile), 35000);
+}
+
+// Screens a database with thresholds around the scores of its sequences and
+// compares the hits against the scalar scores.
+template <typename TString, typename TScore>
+void _testStripedLocalAlignmentScan(TScore const & scoringScheme, unsigned queryLength, unsigned seed)
+{
+    using namespace seqan;
+
+    Rng<MersenneTwister> rng(seed);
+    TString query;
+    _randomAlignString(query, queryLength, rng);
+    StripedQueryProfile<TString, TScore> profile(query, scoringScheme);
+
+    StringSet<TString> database;
+    String<int> expected;
+    for (unsigned d = 0; d < 30; ++d)
+    {
+        TString seqH, suffixStr;
+        _randomAlignString(seqH, (d * 7) % 50, rng);
+        _randomAlignString(suffixStr, (d * 13) % 60, rng);
+        // Some sequences contain a part of the query.
+        if (d % 3 == 0)
+            append(seqH, infix(query, d % length(query), length(query)));
+        append(seqH, suffixStr);
+        appendValue(database, seqH);
+        appendValue(expected, _stripedScalarLocalScore(seqH, query, scoringScheme));
+    }
+
+    for (unsigned d = 0; d < length(database); ++d)
+    {
+        int thresholds[] = {expected[d] - 1, expected[d], expected[d] + 1};
+        for (unsigned t = 0; t < 3; ++t)
+        {
+            String<unsigned> hits;
+            appendValue(hits, 1000u);
+            unsigned numHits = localAlignmentScan(hits, database, profile, thresholds[t]);
+            SEQAN_ASSERT_EQ(length(hits), numHits + 1u);
+            unsigned pos = 1;
+            for (unsigned i = 0; i < length(database); ++i)
+                if (expected[i] >= thresholds[t])
+                {
+                    SEQAN_ASSERT_LT(pos, length(hits));
+                    SEQAN_ASSERT_EQ(hits[pos], i);
+                    ++pos;
+                }
+            SEQAN_ASSERT_EQ(pos, length(hits));
+        }
+    }
+
+    String<unsigned> hits;
+    SEQAN_ASSERT_EQ(localAlignmentScan(hits, database, profile, 0), length(database));
+    clear(hits);
+    SEQAN_ASSERT_EQ(localAlignmentScan(hits, database, profile, MaxValue<int>::VALUE), 0u);
+}
+
+SEQAN_DEFINE_TEST(test_align_local_alignment_striped_scan)
+{
+    using namespace seqan;
+
+    _testStripedLocalAlignmentScan<Peptide>(Blosum62(-1, -11), 40, 6u);
+    _testStripedLocalAlignmentScan<DnaString>(Score<int, Simple>(2, -1, -2), 25, 7u);
+    _testStripedLocalAlignmentScan<DnaString>(Score<int, Simple>(3, -3, -1, -5), 9, 8u);
+    // Scores above the range of the 8 bit lanes.
+    _testStripedLocalAlignmentScan<DnaString>(Score<int, Simple>(10, -5, -10), 50, 9u);
+}
+
+#endif  // #ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGN_LOCAL_ALIGNMENT_STRIPED_H_
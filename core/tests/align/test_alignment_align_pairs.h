@@ -0,0 +1,224 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests for the parallel alignment of many pairs of a StringSet.  The
+// results are compared against the sequential alignment of each pair.
+// ==========================================================================
+
+#ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_ALIGN_PAIRS_H_
+#define SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_ALIGN_PAIRS_H_
+
+#include <seqan/basic.h>
+#include <seqan/score.h>
+#include <seqan/align.h>
+
+#include "test_alignment_random.h"
+
+// Records the results passed to the delegate of alignPairs().
+struct AlignPairsTestDelegate_
+{
+    seqan::String<unsigned> positions;
+    seqan::String<int> scores;
+    seqan::String<seqan::String<seqan::Fragment<> > > fragments;
+
+    template <typename TPos, typename TFragments>
+    void operator()(TPos pos, int score, TFragments const & pairFragments)
+    {
+        appendValue(positions, pos);
+        scores[pos] = score;
+        fragments[pos] = pairFragments;
+    }
+};
+
+// Fills the set with pseudo-random sequences of very different lengths and
+// selects all pairs.
+inline void
+_alignPairsTestData(seqan::StringSet<seqan::DnaString> & strings,
+                    seqan::String<seqan::Pair<unsigned> > & pairs)
+{
+    using namespace seqan;
+
+    Rng<MersenneTwister> rng(13u);
+    for (unsigned i = 0; i < 12; ++i)
+    {
+        DnaString str;
+        _randomAlignString(str, 1 + pickRandomNumber(rng) % (i % 3 == 0 ? 150 : 20), rng);
+        appendValue(strings, str);
+    }
+
+    for (unsigned i = 0; i < length(strings); ++i)
+        for (unsigned j = i + 1; j < length(strings); ++j)
+            appendValue(pairs, Pair<unsigned>(i, j));
+}
+
+template <typename TStrings, typename TPairs, typename TScore, typename TAlignConfig, typename TAlgoTag>
+void _testAlignPairs(TStrings const & strings, TPairs const & pairs, TScore const & scoringScheme,
+                     TAlignConfig const & alignConfig, TAlgoTag const & algoTag, bool isLocal)
+{
+    using namespace seqan;
+
+    typedef String<Fragment<> > TFragments;
+
+    // Expected results of the sequential alignments.
+    String<int> expectedScores;
+    String<TFragments> expectedFragments;
+    resize(expectedFragments, length(pairs));
+    for (unsigned i = 0; i < length(pairs); ++i)
+    {
+        StringSet<DnaString, Dependent<> > pairSet;
+        appendValue(pairSet, strings[pairs[i].i1]);
+        appendValue(pairSet, strings[pairs[i].i2]);
+        int score;
+        if (isLocal)
+            score = localAlignment(expectedFragments[i], pairSet, scoringScheme);
+        else
+            score = globalAlignment(expectedFragments[i], pairSet, scoringScheme, alignConfig, algoTag);
+        appendValue(expectedScores, score);
+        // The pair set numbers the sequences 0 and 1.
+        for (unsigned k = 0; k < length(expectedFragments[i]); ++k)
+        {
+            expectedFragments[i][k].seqId1 = pairs[i].i1;
+            expectedFragments[i][k].seqId2 = pairs[i].i2;
+        }
+    }
+
+    // Ordered delegate.
+    AlignPairsTestDelegate_ ordered;
+    resize(ordered.scores, length(pairs));
+    resize(ordered.fragments, length(pairs));
+    alignPairs(ordered, strings, pairs, scoringScheme, alignConfig, algoTag, Ordered());
+    SEQAN_ASSERT_EQ(length(ordered.positions), length(pairs));
+    for (unsigned i = 0; i < length(pairs); ++i)
+    {
+        SEQAN_ASSERT_EQ(ordered.positions[i], i);
+        SEQAN_ASSERT_EQ(ordered.scores[i], expectedScores[i]);
+        SEQAN_ASSERT(ordered.fragments[i] == expectedFragments[i]);
+    }
+
+    // Unordered delegate.
+    AlignPairsTestDelegate_ unordered;
+    resize(unordered.scores, length(pairs));
+    resize(unordered.fragments, length(pairs));
+    alignPairs(unordered, strings, pairs, scoringScheme, alignConfig, algoTag, Unordered());
+    SEQAN_ASSERT_EQ(length(unordered.positions), length(pairs));
+    for (unsigned i = 0; i < length(pairs); ++i)
+    {
+        SEQAN_ASSERT_EQ(unordered.scores[i], expectedScores[i]);
+        SEQAN_ASSERT(unordered.fragments[i] == expectedFragments[i]);
+    }
+
+    // Collected fragments and scores.
+    TFragments matches;
+    String<int> scores;
+    alignPairs(matches, scores, strings, pairs, scoringScheme, alignConfig, algoTag);
+    TFragments expectedMatches;
+    for (unsigned i = 0; i < length(pairs); ++i)
+        append(expectedMatches, expectedFragments[i]);
+    SEQAN_ASSERT(scores == expectedScores);
+    SEQAN_ASSERT(matches == expectedMatches);
+
+    // Scores only.
+    String<int> scoresOnly;
+    alignPairsScore(scoresOnly, strings, pairs, scoringScheme, alignConfig, algoTag);
+    SEQAN_ASSERT(scoresOnly == expectedScores);
+}
+
+SEQAN_DEFINE_TEST(test_alignment_align_pairs_global)
+{
+    using namespace seqan;
+
+    StringSet<DnaString> strings;
+    String<Pair<unsigned> > pairs;
+    _alignPairsTestData(strings, pairs);
+
+    _testAlignPairs(strings, pairs, Score<int, Simple>(2, -1, -2), AlignConfig<>(), NeedlemanWunsch(), false);
+    _testAlignPairs(strings, pairs, Score<int, Simple>(3, -2, -1, -4), AlignConfig<true, false, false, true>(),
+                    Gotoh(), false);
+
+    // No pairs.
+    String<Pair<unsigned> > noPairs;
+    String<int> scores;
+    alignPairsScore(scores, strings, noPairs, Score<int, Simple>(2, -1, -2), AlignConfig<>(), NeedlemanWunsch());
+    SEQAN_ASSERT(empty(scores));
+}
+
+SEQAN_DEFINE_TEST(test_alignment_align_pairs_local)
+{
+    using namespace seqan;
+
+    StringSet<DnaString> strings;
+    String<Pair<unsigned> > pairs;
+    _alignPairsTestData(strings, pairs);
+
+    _testAlignPairs(strings, pairs, Score<int, Simple>(2, -1, -2), AlignConfig<>(), SmithWaterman(), true);
+    _testAlignPairs(strings, pairs, Score<int, Simple>(3, -2, -1, -4), AlignConfig<>(), SmithWaterman(), true);
+}
+
+SEQAN_DEFINE_TEST(test_alignment_align_pairs_window)
+{
+    using namespace seqan;
+
+    StringSet<DnaString> strings;
+    String<Pair<unsigned> > pairs;
+    _alignPairsTestData(strings, pairs);
+
+    // The schedule only reorders the pairs within each window, so at most one
+    // window of results is pending in ordered mode.
+    unsigned const windowSize = 5;
+    String<unsigned> schedule;
+    _alignPairsSchedule(schedule, strings, pairs, windowSize);
+    SEQAN_ASSERT_EQ(length(schedule), length(pairs));
+    for (unsigned i = 0; i < length(schedule); ++i)
+        SEQAN_ASSERT_EQ(schedule[i] / windowSize, i / windowSize);
+
+    Score<int, Simple> scoringScheme(3, -2, -1, -4);
+    AlignPairsTestDelegate_ expected;
+    resize(expected.scores, length(pairs));
+    resize(expected.fragments, length(pairs));
+    alignPairs(expected, strings, pairs, scoringScheme, AlignConfig<>(), Gotoh(), Ordered());
+
+    for (unsigned window = 1; window <= 2 * windowSize; window += windowSize - 1)
+    {
+        AlignPairsTestDelegate_ ordered;
+        resize(ordered.scores, length(pairs));
+        resize(ordered.fragments, length(pairs));
+        _alignPairs(ordered, strings, pairs, scoringScheme, AlignConfig<>(), Gotoh(), Ordered(), window);
+        SEQAN_ASSERT_EQ(length(ordered.positions), length(pairs));
+        for (unsigned i = 0; i < length(pairs); ++i)
+        {
+            SEQAN_ASSERT_EQ(ordered.positions[i], i);
+            SEQAN_ASSERT_EQ(ordered.scores[i], expected.scores[i]);
+            SEQAN_ASSERT(ordered.fragments[i] == expected.fragments[i]);
+        }
+    }
+}
+
+#endif  // #ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_ALIGN_PAIRS_H_
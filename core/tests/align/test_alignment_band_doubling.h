@@ -0,0 +1,195 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests for the banded global alignment with band doubling.  The results
+// are compared against the unbanded alignment.
+// ==========================================================================
+
+#ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_BAND_DOUBLING_H_
+#define SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_BAND_DOUBLING_H_
+
+#include <seqan/basic.h>
+#include <seqan/score.h>
+#include <seqan/align.h>
+
+#include "test_alignment_random.h"
+
+// Derives seqV from seqH by pseudo-random substitutions, insertions and
+// deletions, each applied with probability 1 / rate.
+template <typename TString>
+void _bandDoublingMutate(TString & seqV, TString const & seqH, unsigned rate,
+                         seqan::Rng<seqan::MersenneTwister> & rng)
+{
+    using namespace seqan;
+
+    typedef typename Value<TString>::Type TAlphabet;
+
+    clear(seqV);
+    for (unsigned i = 0; i < length(seqH); ++i)
+    {
+        unsigned dice = pickRandomNumber(rng) % (3 * rate);
+        if (dice == 0u)
+            continue;
+        if (dice == 1u)
+        {
+            appendValue(seqV, TAlphabet(pickRandomNumber(rng) % ValueSize<TAlphabet>::VALUE));
+            continue;
+        }
+        if (dice == 2u)
+            appendValue(seqV, TAlphabet(pickRandomNumber(rng) % ValueSize<TAlphabet>::VALUE));
+        appendValue(seqV, seqH[i]);
+    }
+}
+
+template <typename TString, typename TScore>
+void _testBandDoubling(TString const & seqH, TString const & seqV, TScore const & scoringScheme)
+{
+    using namespace seqan;
+
+    int expected = globalAlignmentScore(seqH, seqV, scoringScheme);
+    SEQAN_ASSERT_EQ(globalAlignmentScore(seqH, seqV, scoringScheme, BandDoubling()), expected);
+
+    Align<TString> align;
+    resize(rows(align), 2);
+    assignSource(row(align, 0), seqH);
+    assignSource(row(align, 1), seqV);
+    SEQAN_ASSERT_EQ(globalAlignment(align, scoringScheme, BandDoubling()), expected);
+    SEQAN_ASSERT_EQ(length(row(align, 0)), length(row(align, 1)));
+
+    TString sourceH = seqH;
+    TString sourceV = seqV;
+    Gaps<TString> gapsH(sourceH);
+    Gaps<TString> gapsV(sourceV);
+    SEQAN_ASSERT_EQ(globalAlignment(gapsH, gapsV, scoringScheme, BandDoubling()), expected);
+    SEQAN_ASSERT(row(align, 0) == gapsH);
+    SEQAN_ASSERT(row(align, 1) == gapsV);
+
+    // Recompute the score from the alignment.
+    int alignScore = 0;
+    bool gapH = false, gapV = false;
+    for (unsigned i = 0; i < length(gapsH); ++i)
+    {
+        if (isGap(gapsH, i))
+        {
+            alignScore += gapH ? scoreGapExtend(scoringScheme) : scoreGapOpen(scoringScheme);
+            gapH = true;
+            gapV = false;
+        }
+        else if (isGap(gapsV, i))
+        {
+            alignScore += gapV ? scoreGapExtend(scoringScheme) : scoreGapOpen(scoringScheme);
+            gapH = false;
+            gapV = true;
+        }
+        else
+        {
+            alignScore += score(scoringScheme, sourceH[toSourcePosition(gapsH, i)],
+                                sourceV[toSourcePosition(gapsV, i)]);
+            gapH = gapV = false;
+        }
+    }
+    SEQAN_ASSERT_EQ(alignScore, expected);
+}
+
+template <typename TString, typename TScore>
+void _testBandDoublingRandom(TScore const & scoringScheme, unsigned length_, unsigned rate, unsigned seed)
+{
+    using namespace seqan;
+
+    Rng<MersenneTwister> rng(seed);
+    TString seqH, seqV;
+    _randomAlignString(seqH, length_, rng);
+    _bandDoublingMutate(seqV, seqH, rate, rng);
+    _testBandDoubling(seqH, seqV, scoringScheme);
+    _testBandDoubling(seqV, seqH, scoringScheme);
+}
+
+SEQAN_DEFINE_TEST(test_alignment_band_doubling_dna)
+{
+    using namespace seqan;
+
+    Score<int, Simple> linearScore(2, -1, -2);
+    Score<int, Simple> affineScore(3, -2, -1, -4);
+
+    // Similar sequences are aligned within the first bands.
+    for (unsigned seed = 0; seed < 5; ++seed)
+    {
+        _testBandDoublingRandom<DnaString>(linearScore, 400, 20, seed);
+        _testBandDoublingRandom<DnaString>(affineScore, 400, 20, seed);
+    }
+    // Dissimilar sequences need several doublings up to the full matrix.
+    for (unsigned seed = 0; seed < 3; ++seed)
+    {
+        _testBandDoublingRandom<DnaString>(linearScore, 150, 2, seed);
+        _testBandDoublingRandom<DnaString>(affineScore, 150, 2, seed);
+    }
+
+    // A long insertion lies outside of the first band.
+    DnaString seqH = "ACGTTGCAAGCTAGCTAGCTTTACGGATCGATCGGCTAGCATCGATCGACTAGCTTAGCATTACG";
+    DnaString seqV = seqH;
+    insert(seqV, 20, "TTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTTT");
+    _testBandDoubling(seqH, seqV, linearScore);
+    _testBandDoubling(seqH, seqV, affineScore);
+
+    // The optimal alignment shifts the sequences by more than the first band.
+    DnaString common, shiftedH, shiftedV;
+    for (unsigned i = 0; i < 200; ++i)
+        appendValue(common, Dna((i * i + i / 3) % 4));
+    for (unsigned i = 0; i < 40; ++i)
+        appendValue(shiftedH, Dna(i % 2));
+    append(shiftedH, common);
+    shiftedV = common;
+    for (unsigned i = 0; i < 40; ++i)
+        appendValue(shiftedV, Dna(2 + i % 2));
+    _testBandDoubling(shiftedH, shiftedV, linearScore);
+    _testBandDoubling(shiftedH, shiftedV, affineScore);
+    SEQAN_ASSERT_LT(globalAlignmentScore(shiftedH, shiftedV, affineScore, -16, 16),
+                    globalAlignmentScore(shiftedH, shiftedV, affineScore, BandDoubling()));
+
+    // Gaps scoring better than matches are aligned in the full matrix.
+    _testBandDoubling(seqH, seqV, Score<int, Simple>(1, -1, 1));
+
+    // Short sequences are covered by the first band.
+    _testBandDoubling(DnaString("A"), DnaString("CGT"), affineScore);
+}
+
+SEQAN_DEFINE_TEST(test_alignment_band_doubling_matrix)
+{
+    using namespace seqan;
+
+    for (unsigned seed = 0; seed < 3; ++seed)
+    {
+        _testBandDoublingRandom<Peptide>(Blosum62(-1, -11), 300, 10, seed);
+        _testBandDoublingRandom<Peptide>(Blosum62(-4, -4), 300, 10, seed);
+    }
+}
+
+#endif  // #ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_BAND_DOUBLING_H_
@@ -0,0 +1,214 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests for the inter-sequence vectorized batch alignment scores.  The
+// results are compared against the scalar dynamic programming.
+// ==========================================================================
+
+#ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_DP_BATCH_SIMD_H_
+#define SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_DP_BATCH_SIMD_H_
+
+#include <seqan/basic.h>
+#include <seqan/score.h>
+#include <seqan/align.h>
+
+#include "test_alignment_random.h"
+
+// Fills the sets with count pairs of pseudo-random, non-empty sequences of
+// length at most maxLength.  Every third pair is derived from its horizontal
+// sequence so that the alignments are not dominated by gaps.
+template <typename TStrings>
+void _batchSimdRandomPairs(TStrings & stringsH, TStrings & stringsV, unsigned count, unsigned maxLength,
+                           unsigned seed)
+{
+    using namespace seqan;
+
+    typedef typename Value<TStrings>::Type TString;
+
+    Rng<MersenneTwister> rng(seed);
+    for (unsigned i = 0; i < count; ++i)
+    {
+        TString strH, strV;
+        _randomAlignPair(strH, strV, maxLength, (i % 3 == 0) ? 4 : 0, rng);
+        appendValue(stringsH, strH);
+        appendValue(stringsV, strV);
+    }
+}
+
+template <typename TStrings, typename TScore, typename TAlignConfig>
+void _testBatchSimdGlobal(TStrings const & stringsH, TStrings const & stringsV, TScore const & scoringScheme,
+                          TAlignConfig const & alignConfig)
+{
+    using namespace seqan;
+
+    String<int> scores = globalAlignmentScore(stringsH, stringsV, scoringScheme, alignConfig);
+    SEQAN_ASSERT_EQ(length(scores), length(stringsH));
+    for (unsigned i = 0; i < length(stringsH); ++i)
+        SEQAN_ASSERT_EQ(scores[i], globalAlignmentScore(stringsH[i], stringsV[i], scoringScheme, alignConfig));
+}
+
+template <typename TStrings, typename TScore>
+void _testBatchSimdLocal(TStrings const & stringsH, TStrings const & stringsV, TScore const & scoringScheme)
+{
+    using namespace seqan;
+
+    typedef typename Value<TStrings>::Type TString;
+
+    String<int> scores = localAlignmentScore(stringsH, stringsV, scoringScheme);
+    SEQAN_ASSERT_EQ(length(scores), length(stringsH));
+    for (unsigned i = 0; i < length(stringsH); ++i)
+    {
+        Align<TString> align;
+        resize(rows(align), 2);
+        assignSource(row(align, 0), stringsH[i]);
+        assignSource(row(align, 1), stringsV[i]);
+        // The scalar local alignment reports 0 for pairs without a match.
+        SEQAN_ASSERT_EQ(scores[i], localAlignment(align, scoringScheme));
+    }
+}
+
+template <typename TStrings, typename TScore>
+void _testBatchSimdAllConfigs(TStrings const & stringsH, TStrings const & stringsV, TScore const & scoringScheme)
+{
+    using namespace seqan;
+
+    _testBatchSimdGlobal(stringsH, stringsV, scoringScheme, AlignConfig<>());
+    _testBatchSimdGlobal(stringsH, stringsV, scoringScheme, AlignConfig<true, true, true, true>());
+    _testBatchSimdGlobal(stringsH, stringsV, scoringScheme, AlignConfig<true, false, false, true>());
+    _testBatchSimdGlobal(stringsH, stringsV, scoringScheme, AlignConfig<false, true, true, false>());
+    _testBatchSimdGlobal(stringsH, stringsV, scoringScheme, AlignConfig<false, false, true, true>());
+}
+
+SEQAN_DEFINE_TEST(test_alignment_dp_batch_simd_global_simple)
+{
+    using namespace seqan;
+
+    StringSet<DnaString> stringsH, stringsV;
+    _batchSimdRandomPairs(stringsH, stringsV, 37, 40, 42u);
+
+    _testBatchSimdAllConfigs(stringsH, stringsV, Score<int, Simple>(2, -1, -2));       // linear
+    _testBatchSimdAllConfigs(stringsH, stringsV, Score<int, Simple>(3, -2, -1, -4));   // affine
+
+    // Short sequences and small scores run with 8 bit lanes if available.
+    StringSet<DnaString> shortH, shortV;
+    _batchSimdRandomPairs(shortH, shortV, 70, 8, 7u);
+    _testBatchSimdAllConfigs(shortH, shortV, Score<int, Simple>(1, -1, -1));
+    _testBatchSimdAllConfigs(shortH, shortV, Score<int, Simple>(1, -1, -1, -2));
+
+    // An empty batch yields no scores.
+    StringSet<DnaString> emptySet;
+    SEQAN_ASSERT(empty(globalAlignmentScore(emptySet, emptySet, Score<int, Simple>(2, -1, -2))));
+}
+
+SEQAN_DEFINE_TEST(test_alignment_dp_batch_simd_global_large_alphabet)
+{
+    using namespace seqan;
+
+    // Characters that differ by a multiple of 256 must not match in 8 bit
+    // lanes.  The sequences are short, so the lanes are as narrow as possible.
+    typedef String<unsigned short> TString;
+
+    Rng<MersenneTwister> rng(23u);
+    StringSet<TString> stringsH, stringsV;
+    for (unsigned i = 0; i < 70; ++i)
+    {
+        TString strH, strV;
+        unsigned len = 1 + pickRandomNumber(rng) % 8;
+        for (unsigned j = 0; j < len; ++j)
+        {
+            unsigned short c = pickRandomNumber(rng) % 4;
+            appendValue(strH, c);
+            appendValue(strV, (unsigned short)(c + 256 * (pickRandomNumber(rng) % 3)));
+        }
+        appendValue(stringsH, strH);
+        appendValue(stringsV, strV);
+    }
+
+    _testBatchSimdAllConfigs(stringsH, stringsV, Score<int, Simple>(1, -1, -1));
+    _testBatchSimdAllConfigs(stringsH, stringsV, Score<int, Simple>(1, -1, -1, -2));
+}
+
+SEQAN_DEFINE_TEST(test_alignment_dp_batch_simd_global_matrix)
+{
+    using namespace seqan;
+
+    StringSet<Peptide> stringsH, stringsV;
+    _batchSimdRandomPairs(stringsH, stringsV, 21, 50, 13u);
+
+    Blosum62 scoringScheme(-1, -11);
+    _testBatchSimdAllConfigs(stringsH, stringsV, scoringScheme);
+    Blosum62 linearScheme(-4, -4);
+    _testBatchSimdAllConfigs(stringsH, stringsV, linearScheme);
+}
+
+SEQAN_DEFINE_TEST(test_alignment_dp_batch_simd_global_long)
+{
+    using namespace seqan;
+
+    // The score bound exceeds the range of 16 bit lanes.
+    StringSet<DnaString> stringsH, stringsV;
+    _batchSimdRandomPairs(stringsH, stringsV, 3, 1000, 5u);
+    appendValue(stringsH, "ACGT");
+    appendValue(stringsV, "ACGT");
+    for (unsigned i = 0; i < 4500; ++i)
+    {
+        appendValue(stringsH[3], Dna(i % 3));
+        appendValue(stringsV[3], Dna(i % 4));
+    }
+
+    _testBatchSimdGlobal(stringsH, stringsV, Score<int, Simple>(1, -1, -1, -2), AlignConfig<>());
+    _testBatchSimdLocal(stringsH, stringsV, Score<int, Simple>(1, -1, -1, -2));
+
+    // The score bound exceeds the range of 32 bit lanes, the pairs are
+    // computed with scalar instructions.
+    StringSet<DnaString> largeH, largeV;
+    _batchSimdRandomPairs(largeH, largeV, 9, 60, 17u);
+    Score<int, Simple> largeScheme(10000000, -10000000, -10000000);
+    _testBatchSimdGlobal(largeH, largeV, largeScheme, AlignConfig<>());
+    _testBatchSimdGlobal(largeH, largeV, largeScheme, AlignConfig<true, true, true, true>());
+    _testBatchSimdLocal(largeH, largeV, largeScheme);
+}
+
+SEQAN_DEFINE_TEST(test_alignment_dp_batch_simd_local)
+{
+    using namespace seqan;
+
+    StringSet<Dna5String> stringsH, stringsV;
+    _batchSimdRandomPairs(stringsH, stringsV, 35, 40, 3u);
+    _testBatchSimdLocal(stringsH, stringsV, Score<int, Simple>(2, -1, -2));
+    _testBatchSimdLocal(stringsH, stringsV, Score<int, Simple>(3, -2, -1, -4));
+
+    StringSet<Peptide> peptidesH, peptidesV;
+    _batchSimdRandomPairs(peptidesH, peptidesV, 19, 50, 11u);
+    _testBatchSimdLocal(peptidesH, peptidesV, Blosum62(-1, -11));
+}
+
+#endif  // #ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_DP_BATCH_SIMD_H_
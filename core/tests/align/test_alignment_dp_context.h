@@ -0,0 +1,166 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests for the reuse of the dynamic programming buffers of a DPContext.
+// The results are compared against the alignments without a context.
+// ==========================================================================
+
+
+#ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_DP_CONTEXT_H_
+#define SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_DP_CONTEXT_H_
+
+#include <sstream>
+
+#include <seqan/basic.h>
+#include <seqan/score.h>
+#include <seqan/align.h>
+
+#include "test_alignment_random.h"
+
+template <typename TAlign>
+std::string _dpContextToString(TAlign const & align)
+{
+    std::stringstream ss;
+    ss << align;
+    return ss.str();
+}
+
+// Aligns the pairs with and without the context and checks that the results agree.
+template <typename TScore>
+void _testDPContextPairs(seqan::DPContext<int> & dpContext, TScore const & scoringScheme, unsigned maxLength,
+                         unsigned seed)
+{
+    using namespace seqan;
+
+    Rng<MersenneTwister> rng(seed);
+    for (unsigned i = 0; i < 20; ++i)
+    {
+        DnaString seqH, seqV;
+        _randomAlignPair(seqH, seqV, maxLength, 0, rng);
+
+        Align<DnaString> align, alignCtx;
+        resize(rows(align), 2);
+        assignSource(row(align, 0), seqH);
+        assignSource(row(align, 1), seqV);
+        alignCtx = align;
+
+        SEQAN_ASSERT_EQ(globalAlignment(alignCtx, scoringScheme, dpContext),
+                        globalAlignment(align, scoringScheme));
+        SEQAN_ASSERT_EQ(_dpContextToString(alignCtx), _dpContextToString(align));
+
+        AlignConfig<true, false, false, true> freeEnds;
+        SEQAN_ASSERT_EQ(globalAlignment(alignCtx, scoringScheme, freeEnds, dpContext),
+                        globalAlignment(align, scoringScheme, freeEnds));
+        SEQAN_ASSERT_EQ(_dpContextToString(alignCtx), _dpContextToString(align));
+
+        SEQAN_ASSERT_EQ(localAlignment(alignCtx, scoringScheme, dpContext), localAlignment(align, scoringScheme));
+        SEQAN_ASSERT_EQ(_dpContextToString(alignCtx), _dpContextToString(align));
+
+        Gaps<DnaString> gapsH(seqH), gapsV(seqV), gapsHCtx(seqH), gapsVCtx(seqV);
+        SEQAN_ASSERT_EQ(globalAlignment(gapsHCtx, gapsVCtx, scoringScheme, dpContext),
+                        globalAlignment(gapsH, gapsV, scoringScheme));
+        SEQAN_ASSERT(gapsHCtx == gapsH);
+        SEQAN_ASSERT(gapsVCtx == gapsV);
+        SEQAN_ASSERT_EQ(localAlignment(gapsHCtx, gapsVCtx, scoringScheme, dpContext),
+                        localAlignment(gapsH, gapsV, scoringScheme));
+        SEQAN_ASSERT(gapsHCtx == gapsH);
+        SEQAN_ASSERT(gapsVCtx == gapsV);
+
+        SEQAN_ASSERT_EQ(globalAlignmentScore(seqH, seqV, scoringScheme, dpContext),
+                        globalAlignmentScore(seqH, seqV, scoringScheme));
+    }
+}
+
+SEQAN_DEFINE_TEST(test_alignment_dp_context_results)
+{
+    using namespace seqan;
+
+    DPContext<int> dpContext;
+    _testDPContextPairs(dpContext, Score<int, Simple>(2, -1, -2), 30, 42u);        // linear
+    _testDPContextPairs(dpContext, Score<int, Simple>(3, -2, -1, -4), 30, 7u);     // affine
+    // Smaller matrices after larger ones must not see stale cells.
+    _testDPContextPairs(dpContext, Score<int, Simple>(2, -1, -2), 5, 3u);
+    _testDPContextPairs(dpContext, Score<int, Simple>(3, -2, -1, -4), 5, 11u);
+
+    clear(dpContext);
+    _testDPContextPairs(dpContext, Score<int, Simple>(1, -1, -1, -2), 12, 5u);
+}
+
+SEQAN_DEFINE_TEST(test_alignment_dp_context_reuse)
+{
+    using namespace seqan;
+
+    DPContext<int> dpContext;
+    Score<int, Simple> linearScheme(2, -1, -2);
+    Score<int, Simple> affineScheme(3, -2, -1, -4);
+
+    Rng<MersenneTwister> rng(17u);
+    DnaString longH, longV;
+    _randomAlignString(longH, 60, rng);
+    _randomAlignString(longV, 50, rng);
+
+    Align<DnaString> align;
+    resize(rows(align), 2);
+    assignSource(row(align, 0), longH);
+    assignSource(row(align, 1), longV);
+    globalAlignment(align, linearScheme, dpContext);
+    globalAlignment(align, affineScheme, dpContext);
+
+    size_t capLinear = capacity(host(dpContext._scoreMatrixLinear));
+    size_t capAffine = capacity(host(dpContext._scoreMatrixAffine));
+    size_t capTrace = capacity(host(dpContext._traceMatrix));
+    SEQAN_ASSERT_GT(capLinear, 0u);
+    SEQAN_ASSERT_GT(capAffine, 0u);
+    SEQAN_ASSERT_GEQ(capTrace, 61u * 51u);
+
+    // Shorter sequences do not reallocate the buffers.
+    for (unsigned i = 0; i < 10; ++i)
+    {
+        DnaString seqH, seqV;
+        _randomAlignString(seqH, 10 + 5 * i, rng);
+        _randomAlignString(seqV, 50 - 4 * i, rng);
+        assignSource(row(align, 0), seqH);
+        assignSource(row(align, 1), seqV);
+        globalAlignment(align, linearScheme, dpContext);
+        globalAlignment(align, affineScheme, dpContext);
+        localAlignment(align, affineScheme, dpContext);
+        globalAlignmentScore(source(row(align, 0)), source(row(align, 1)), affineScheme, dpContext);
+        SEQAN_ASSERT_EQ(capacity(host(dpContext._scoreMatrixLinear)), capLinear);
+        SEQAN_ASSERT_EQ(capacity(host(dpContext._scoreMatrixAffine)), capAffine);
+        SEQAN_ASSERT_EQ(capacity(host(dpContext._traceMatrix)), capTrace);
+    }
+
+    clear(dpContext);
+    SEQAN_ASSERT_EQ(capacity(host(dpContext._traceMatrix)), 0u);
+    SEQAN_ASSERT_EQ(capacity(host(dpContext._scoreMatrixAffine)), 0u);
+}
+
+#endif  // #ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_DP_CONTEXT_H_
@@ -0,0 +1,164 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests for the bit-packed trace matrix.  The trace segments computed with
+// the packed matrix are compared against the ones of the full matrix.
+// ==========================================================================
+
+#ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_DP_MATRIX_PACKED_H_
+#define SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_DP_MATRIX_PACKED_H_
+
+#include <seqan/basic.h>
+#include <seqan/score.h>
+#include <seqan/align.h>
+
+#include "test_alignment_random.h"
+
+// Runs the alignment once with the full and once with the packed trace matrix
+// and checks that scores and trace segments agree.
+template <typename TSequence, typename TBand, typename TDPProfile>
+void _testDPMatrixPackedTraceback(TSequence const & seqH, TSequence const & seqV,
+                                  seqan::Score<int, seqan::Simple> const & scoringScheme,
+                                  TBand const & band, TDPProfile const & dpProfile)
+{
+    using namespace seqan;
+
+    typedef DPCell_<int, LinearGaps> TDPCell;
+    typedef typename TraceBitMap_::TTraceValue TTraceValue;
+    typedef String<TraceSegment_<unsigned, unsigned> > TTraceSegments;
+
+    DPScoutState_<Default> noState;
+
+    DPMatrix_<TDPCell, SparseDPMatrix> scoreMatrixFull;
+    DPMatrix_<TTraceValue, FullDPMatrix> traceMatrixFull;
+    TTraceSegments tracesFull;
+    int scoreFull = _computeAlignmentImpl(scoreMatrixFull, traceMatrixFull, tracesFull, noState, seqH, seqV,
+                                          scoringScheme, band, dpProfile);
+
+    DPMatrix_<TDPCell, SparseDPMatrix> scoreMatrixPacked;
+    DPMatrix_<TTraceValue, PackedDPMatrix> traceMatrixPacked;
+    TTraceSegments tracesPacked;
+    int scorePacked = _computeAlignmentImpl(scoreMatrixPacked, traceMatrixPacked, tracesPacked, noState, seqH, seqV,
+                                            scoringScheme, band, dpProfile);
+
+    SEQAN_ASSERT_EQ(scorePacked, scoreFull);
+    SEQAN_ASSERT_EQ(length(tracesPacked), length(tracesFull));
+    for (unsigned i = 0; i < length(tracesFull); ++i)
+        SEQAN_ASSERT(tracesPacked[i] == tracesFull[i]);
+
+    // Two cells share one byte.
+    SEQAN_ASSERT_EQ(length(host(traceMatrixPacked)), (length(host(traceMatrixFull)) + 1) / 2);
+}
+
+SEQAN_DEFINE_TEST(test_alignment_dp_matrix_packed_access)
+{
+    using namespace seqan;
+
+    typedef DPMatrix_<unsigned char, PackedDPMatrix> TDPMatrix;
+    typedef Iterator<TDPMatrix, Standard>::Type TIterator;
+
+    TDPMatrix dpMatrix;
+    setLength(dpMatrix, +DPMatrixDimension_::VERTICAL, 5);
+    setLength(dpMatrix, +DPMatrixDimension_::HORIZONTAL, 3);
+    resize(dpMatrix, static_cast<unsigned char>(TraceBitMap_::NONE));
+
+    SEQAN_ASSERT_EQ(length(dpMatrix), 15u);
+    SEQAN_ASSERT_EQ(length(host(dpMatrix)), 8u);
+    SEQAN_ASSERT_EQ(_dataFactors(dpMatrix)[DPMatrixDimension_::HORIZONTAL], 5u);
+
+    // Write all cells through the iterator and read them back by position.
+    TIterator it = begin(dpMatrix, Standard());
+    for (unsigned i = 0; i < length(dpMatrix); ++i, ++it)
+        assignValue(it, static_cast<unsigned char>(i % 8));
+    SEQAN_ASSERT(it == end(dpMatrix, Standard()));
+    SEQAN_ASSERT_EQ(it - begin(dpMatrix, Standard()), 15);
+    for (unsigned i = 0; i < length(dpMatrix); ++i)
+        SEQAN_ASSERT_EQ(value(dpMatrix, i), i % 8);
+
+    // Overwriting a cell leaves the other half of the byte untouched.
+    assignValue(dpMatrix, 6u, static_cast<unsigned char>(TraceBitMap_::DIAGONAL | TraceBitMap_::VERTICAL));
+    SEQAN_ASSERT_EQ(value(dpMatrix, 6u), TraceBitMap_::DIAGONAL | TraceBitMap_::VERTICAL);
+    SEQAN_ASSERT_EQ(value(dpMatrix, 7u), 7u);
+    SEQAN_ASSERT_EQ(value(dpMatrix, 1u, 1u), 5u);
+    assignValue(dpMatrix, 7u, static_cast<unsigned char>(TraceBitMap_::NONE));
+    SEQAN_ASSERT_EQ(value(dpMatrix, 6u), TraceBitMap_::DIAGONAL | TraceBitMap_::VERTICAL);
+    SEQAN_ASSERT_EQ(value(dpMatrix, 7u), +TraceBitMap_::NONE);
+
+    // Navigating and coordinates work on cell positions like in the full matrix.
+    it = begin(dpMatrix, Standard()) + 13;
+    it -= _dataFactors(dpMatrix)[DPMatrixDimension_::HORIZONTAL] + 1;
+    SEQAN_ASSERT_EQ(position(it, dpMatrix), 7u);
+    SEQAN_ASSERT_EQ(coordinate(dpMatrix, position(it, dpMatrix), +DPMatrixDimension_::VERTICAL), 2u);
+    SEQAN_ASSERT_EQ(coordinate(dpMatrix, position(it, dpMatrix), +DPMatrixDimension_::HORIZONTAL), 1u);
+}
+
+SEQAN_DEFINE_TEST(test_alignment_dp_matrix_packed_traceback)
+{
+    using namespace seqan;
+
+    typedef DPProfile_<GlobalAlignment_<>, LinearGaps, TracebackOn<GapsLeft> > TGlobalProfile;
+    typedef DPProfile_<GlobalAlignment_<FreeEndGaps_<True, False, True, False> >, LinearGaps,
+                       TracebackOn<GapsRight> > TOverlapProfile;
+    typedef DPProfile_<LocalAlignment_<>, LinearGaps, TracebackOn<GapsLeft> > TLocalProfile;
+
+    // The packed matrix is only the default for linear gaps if it was selected.
+#ifdef SEQAN_DP_PACKED_TRACE_MATRIX
+    SEQAN_ASSERT_EQ((+IsSameType<DefaultTraceMatrixSpec_<LinearGaps>::Type, PackedDPMatrix>::VALUE), +true);
+#else
+    SEQAN_ASSERT_EQ((+IsSameType<DefaultTraceMatrixSpec_<LinearGaps>::Type, FullDPMatrix>::VALUE), +true);
+#endif  // #ifdef SEQAN_DP_PACKED_TRACE_MATRIX
+    SEQAN_ASSERT_EQ((+IsSameType<DefaultTraceMatrixSpec_<AffineGaps>::Type, FullDPMatrix>::VALUE), +true);
+
+    Score<int, Simple> scoringScheme(2, -1, -2);
+    Rng<MersenneTwister> rng(7u);
+    for (unsigned i = 0; i < 20; ++i)
+    {
+        // Odd and even matrix sizes.
+        DnaString seqH, seqV;
+        _randomAlignPair(seqH, seqV, 40, 4, rng);
+        unsigned lenH = length(seqH);
+        unsigned lenV = length(seqV);
+
+        _testDPMatrixPackedTraceback(seqH, seqV, scoringScheme, DPBand_<BandOff>(), TGlobalProfile());
+        _testDPMatrixPackedTraceback(seqH, seqV, scoringScheme, DPBand_<BandOff>(), TOverlapProfile());
+        _testDPMatrixPackedTraceback(seqH, seqV, scoringScheme, DPBand_<BandOff>(), TLocalProfile());
+
+        int lower = -static_cast<int>(lenV);
+        int upper = static_cast<int>(lenH);
+        _testDPMatrixPackedTraceback(seqH, seqV, scoringScheme, DPBand_<BandOn>(lower, upper), TGlobalProfile());
+        _testDPMatrixPackedTraceback(seqH, seqV, scoringScheme, DPBand_<BandOn>(-3, 4), TLocalProfile());
+        if (lenH > lenV)
+            _testDPMatrixPackedTraceback(seqH, seqV, scoringScheme,
+                                         DPBand_<BandOn>(-2, static_cast<int>(lenH - lenV) + 2), TGlobalProfile());
+    }
+}
+
+#endif  // #ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_DP_MATRIX_PACKED_H_
@@ -0,0 +1,125 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests for the wavefront computation of long global alignments.  The
+// results of small tiles are compared against the sequential algorithms.
+// ==========================================================================
+
+
+#ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_DP_WAVEFRONT_H_
+#define SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_DP_WAVEFRONT_H_
+
+#include <seqan/basic.h>
+#include <seqan/score.h>
+#include <seqan/align.h>
+
+#include "test_alignment_random.h"
+
+template <typename TString, typename TScore, typename TAlignConfig>
+void _testWavefrontScore(TString const & seqH, TString const & seqV, TScore const & scoringScheme,
+                         TAlignConfig const & alignConfig)
+{
+    using namespace seqan;
+
+    int expected = globalAlignmentScore(seqH, seqV, scoringScheme, alignConfig);
+    unsigned tileSizes[] = {1, 3, 8, 33, 1000};
+    for (unsigned i = 0; i < 5; ++i)
+        SEQAN_ASSERT_EQ(_globalAlignmentScoreWavefront(seqH, seqV, scoringScheme, alignConfig, tileSizes[i]),
+                        expected);
+}
+
+template <typename TString, typename TScore>
+void _testWavefrontScoreAllConfigs(TString const & seqH, TString const & seqV, TScore const & scoringScheme)
+{
+    using namespace seqan;
+
+    _testWavefrontScore(seqH, seqV, scoringScheme, AlignConfig<>());
+    _testWavefrontScore(seqH, seqV, scoringScheme, AlignConfig<true, true, true, true>());
+    _testWavefrontScore(seqH, seqV, scoringScheme, AlignConfig<true, false, false, true>());
+    _testWavefrontScore(seqH, seqV, scoringScheme, AlignConfig<false, true, true, false>());
+}
+
+SEQAN_DEFINE_TEST(test_alignment_dp_wavefront_score)
+{
+    using namespace seqan;
+
+    Rng<MersenneTwister> rng(42u);
+    for (unsigned i = 0; i < 10; ++i)
+    {
+        DnaString seqH, seqV;
+        _randomAlignPair(seqH, seqV, 120, 5, rng);
+
+        _testWavefrontScoreAllConfigs(seqH, seqV, Score<int, Simple>(2, -1, -2));
+        _testWavefrontScoreAllConfigs(seqH, seqV, Score<int, Simple>(3, -2, -1, -4));
+    }
+
+    Peptide pepH, pepV;
+    _randomAlignString(pepH, 90, rng);
+    _randomAlignStringLike(pepV, 75, pepH, 5, rng);
+    _testWavefrontScoreAllConfigs(pepH, pepV, Blosum62(-1, -11));
+
+    // The affine gap kernel only replaces algorithms computing the same scores.
+    SEQAN_ASSERT(_dpWavefrontSupports(Score<int, Simple>(3, -2, -1, -4), Gotoh()));
+    SEQAN_ASSERT(_dpWavefrontSupports(Score<int, Simple>(2, -1, -2), NeedlemanWunsch()));
+    SEQAN_ASSERT_NOT(_dpWavefrontSupports(Score<int, Simple>(3, -2, -1, -4), NeedlemanWunsch()));
+    SEQAN_ASSERT_NOT(_dpWavefrontSupports(Score<int, Simple>(2, -1, -2), SmithWaterman()));
+}
+
+SEQAN_DEFINE_TEST(test_alignment_dp_wavefront_hirschberg)
+{
+    using namespace seqan;
+
+    // Edit distance scores lead to many ties in the cut.
+    Score<int, Simple> scoringScheme(0, -1, -1);
+    Rng<MersenneTwister> rng(1u);
+    for (unsigned i = 0; i < 10; ++i)
+    {
+        DnaString seqH, seqV;
+        _randomAlignString(seqH, 2 + pickRandomNumber(rng) % 150, rng);
+        _randomAlignStringLike(seqV, 2 + pickRandomNumber(rng) % 150, seqH, 5, rng);
+
+        Gaps<DnaString, ArrayGaps> gapsH(seqH), gapsV(seqV);
+        int expected = globalAlignment(gapsH, gapsV, scoringScheme, Hirschberg());
+        SEQAN_ASSERT_EQ(expected, globalAlignmentScore(seqH, seqV, scoringScheme));
+
+        // The tiled cut breaks ties like the sequential one, the alignments are identical.
+        unsigned tileSizes[] = {1, 4, 16};
+        for (unsigned t = 0; t < 3; ++t)
+        {
+            Gaps<DnaString, ArrayGaps> tiledH(seqH), tiledV(seqV);
+            SEQAN_ASSERT_EQ(_globalAlignment(tiledH, tiledV, scoringScheme, Hirschberg(), tileSizes[t]), expected);
+            SEQAN_ASSERT(tiledH == gapsH);
+            SEQAN_ASSERT(tiledV == gapsV);
+        }
+    }
+}
+
+#endif  // #ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_DP_WAVEFRONT_H_
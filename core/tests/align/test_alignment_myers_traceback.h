@@ -0,0 +1,158 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Tests for the edit distance alignment with traceback on the bit-vectors of
+// Myers' algorithm.  The results are compared against Needleman-Wunsch.
+// ==========================================================================
+
+#ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_MYERS_TRACEBACK_H_
+#define SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_MYERS_TRACEBACK_H_
+
+#include <seqan/basic.h>
+#include <seqan/score.h>
+#include <seqan/align.h>
+
+#include "test_alignment_random.h"
+
+// Returns the edit distance score of the alignment in align.
+template <typename TAlign>
+int _myersTracebackRescore(TAlign const & align)
+{
+    using namespace seqan;
+
+    int result = 0;
+    for (unsigned col = 0; col < length(row(align, 0)); ++col)
+        if (isGap(row(align, 0), col) || isGap(row(align, 1), col) || row(align, 0)[col] != row(align, 1)[col])
+            --result;
+    return result;
+}
+
+// Aligns seqH and seqV with the bit-vector traceback, checks the score against
+// Needleman-Wunsch and checks that the alignment has this score.
+template <typename TString>
+void _testMyersTraceback(TString const & seqH, TString const & seqV)
+{
+    using namespace seqan;
+
+    Align<TString> align;
+    resize(rows(align), 2);
+    assignSource(row(align, 0), seqH);
+    assignSource(row(align, 1), seqV);
+    Align<TString> alignDP(align);
+
+    int result = globalAlignment(align, MyersBitVector());
+    SEQAN_ASSERT_EQ(result, globalAlignment(alignDP, Score<int, Simple>(0, -1, -1)));
+    SEQAN_ASSERT_EQ(result, globalAlignmentScore(seqH, seqV, MyersBitVector()));
+    SEQAN_ASSERT_EQ(result, _myersTracebackRescore(align));
+    SEQAN_ASSERT_EQ(length(row(align, 0)), length(row(align, 1)));
+    SEQAN_ASSERT(source(row(align, 0)) == seqH);
+    SEQAN_ASSERT(source(row(align, 1)) == seqV);
+}
+
+SEQAN_DEFINE_TEST(test_alignment_myers_traceback)
+{
+    using namespace seqan;
+
+    _testMyersTraceback(DnaString("ACGTACGT"), DnaString("ACGTACGT"));
+    _testMyersTraceback(DnaString("AAAAAAAAA"), DnaString("AAAAA"));
+    _testMyersTraceback(DnaString("CGT"), DnaString("ACCCGTTTTT"));
+
+    // An empty sequence is aligned against gaps only.
+    Align<DnaString> alignEmpty;
+    resize(rows(alignEmpty), 2);
+    assignSource(row(alignEmpty, 0), DnaString("ACGT"));
+    assignSource(row(alignEmpty, 1), DnaString(""));
+    SEQAN_ASSERT_EQ(globalAlignment(alignEmpty, MyersBitVector()), -4);
+    SEQAN_ASSERT_EQ(length(row(alignEmpty, 1)), 4u);
+
+    // Patterns of one to several words, in both orientations.
+    Rng<MersenneTwister> rng(23u);
+    for (unsigned i = 0; i < 40; ++i)
+    {
+        DnaString seqH, seqV;
+        _randomAlignPair(seqH, seqV, 300, (i % 2 == 0) ? 8 : 0, rng);
+        _testMyersTraceback(seqH, seqV);
+    }
+}
+
+SEQAN_DEFINE_TEST(test_alignment_myers_traceback_banded)
+{
+    using namespace seqan;
+
+    // A read with a few edits against its reference.
+    DnaString seqH, seqV;
+    Rng<MersenneTwister> rng(5u);
+    for (unsigned j = 0; j < 1000; ++j)
+    {
+        Dna c = Dna(pickRandomNumber(rng) % 4);
+        appendValue(seqH, c);
+        unsigned r = pickRandomNumber(rng) % 50;
+        if (r != 0)
+            appendValue(seqV, (r == 1) ? Dna(ordValue(c) ^ 1) : c);
+        if (r == 2)
+            appendValue(seqV, Dna(pickRandomNumber(rng) % 4));
+    }
+
+    Align<DnaString> align;
+    resize(rows(align), 2);
+    assignSource(row(align, 0), seqH);
+    assignSource(row(align, 1), seqV);
+    Align<DnaString> alignUnbanded(align);
+    Align<DnaString> alignDP(align);
+
+    int diag = (int)length(seqH) - (int)length(seqV);
+    int result = globalAlignment(align, _min(0, diag) - 20, _max(0, diag) + 20, MyersBitVector());
+    SEQAN_ASSERT_EQ(result, globalAlignment(alignUnbanded, MyersBitVector()));
+    SEQAN_ASSERT_EQ(result, globalAlignment(alignDP, Score<int, Simple>(0, -1, -1),
+                                            _min(0, diag) - 20, _max(0, diag) + 20));
+    SEQAN_ASSERT_EQ(result, _myersTracebackRescore(align));
+    SEQAN_ASSERT(row(align, 0) == row(alignUnbanded, 0));
+    SEQAN_ASSERT(row(align, 1) == row(alignUnbanded, 1));
+
+    // The same with exchanged roles of the sequences.
+    Gaps<DnaString> gapsH(seqV), gapsV(seqH);
+    SEQAN_ASSERT_EQ(globalAlignment(gapsH, gapsV, -_max(0, diag) - 20, -_min(0, diag) + 20, MyersBitVector()), result);
+
+    // The band does not contain the last cell.
+    SEQAN_ASSERT_EQ(globalAlignment(align, diag + 1, diag + 5, MyersBitVector()), MinValue<int>::VALUE);
+
+    // A band of width one requires a gap-free alignment.
+    DnaString readH = "ACGTTGCAACGTTGCAACGTTGCAACGTTGCAACGTTGCAACGTTGCAACGTTGCAACGTTGCAACGTT";
+    DnaString readV = "ACGTTGCAACGTTGCAACCTTGCAACGTTGCAACGTTGCAACGTAGCAACGTTGCAACGTTGCAACGTT";
+    Align<DnaString> alignRead;
+    resize(rows(alignRead), 2);
+    assignSource(row(alignRead, 0), readH);
+    assignSource(row(alignRead, 1), readV);
+    SEQAN_ASSERT_EQ(globalAlignment(alignRead, 0, 0, MyersBitVector()), -2);
+    SEQAN_ASSERT_EQ(_myersTracebackRescore(alignRead), -2);
+}
+
+#endif  // #ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_MYERS_TRACEBACK_H_
@@ -0,0 +1,95 @@
+// ==========================================================================
+//                 SeqAn - The Library for Sequence Analysis
+// ==========================================================================
+// Copyright (c) 2006-2013, Knut Reinert, FU Berlin
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//     * Neither the name of Knut Reinert or the FU Berlin nor the names of
+//       its contributors may be used to endorse or promote products derived
+//       from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL KNUT REINERT OR THE FU BERLIN BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// ==========================================================================
+// Pseudo-random sequences shared by the alignment tests.
+// ==========================================================================
+
+#ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_RANDOM_H_
+#define SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_RANDOM_H_
+
+#include <seqan/basic.h>
+#include <seqan/sequence.h>
+#include <seqan/random.h>
+
+// Fills str with len pseudo-random characters.
+template <typename TString>
+void _randomAlignString(TString & str, unsigned len, seqan::Rng<seqan::MersenneTwister> & rng)
+{
+    using namespace seqan;
+
+    typedef typename Value<TString>::Type TAlphabet;
+
+    clear(str);
+    reserve(str, len, Exact());
+    for (unsigned i = 0; i < len; ++i)
+        appendValue(str, TAlphabet(pickRandomNumber(rng) % ValueSize<TAlphabet>::VALUE));
+}
+
+// Fills str with len characters that are copied from templ where possible,
+// except that on average every divergence-th character is pseudo-random.
+template <typename TString>
+void _randomAlignStringLike(TString & str, unsigned len, TString const & templ, unsigned divergence,
+                            seqan::Rng<seqan::MersenneTwister> & rng)
+{
+    using namespace seqan;
+
+    typedef typename Value<TString>::Type TAlphabet;
+
+    clear(str);
+    reserve(str, len, Exact());
+    for (unsigned i = 0; i < len; ++i)
+    {
+        if (i < length(templ) && pickRandomNumber(rng) % divergence != 0)
+            appendValue(str, templ[i]);
+        else
+            appendValue(str, TAlphabet(pickRandomNumber(rng) % ValueSize<TAlphabet>::VALUE));
+    }
+}
+
+// Fills seqH and seqV with pseudo-random sequences of length 1 to maxLength.
+// If divergence is not 0, seqV is derived from seqH with _randomAlignStringLike()
+// so that the alignment is not dominated by gaps.
+template <typename TString>
+void _randomAlignPair(TString & seqH, TString & seqV, unsigned maxLength, unsigned divergence,
+                      seqan::Rng<seqan::MersenneTwister> & rng)
+{
+    using namespace seqan;
+
+    unsigned lenH = 1 + pickRandomNumber(rng) % maxLength;
+    unsigned lenV = 1 + pickRandomNumber(rng) % maxLength;
+    _randomAlignString(seqH, lenH, rng);
+    if (divergence != 0)
+        _randomAlignStringLike(seqV, lenV, seqH, divergence, rng);
+    else
+        _randomAlignString(seqV, lenV, rng);
+}
+
+#endif  // #ifndef SEQAN_CORE_TESTS_ALIGN_TEST_ALIGNMENT_RANDOM_H_
@@ -35,6 +35,8 @@
 #ifndef CORE_TESTS_BAM_IO_TEST_BAM_INDEX_H_
 #define CORE_TESTS_BAM_IO_TEST_BAM_INDEX_H_
 
+#include <fstream>
+
 #include <seqan/basic.h>
 #include <seqan/sequence.h>
 
@@ -85,4 +87,203 @@ SEQAN_DEFINE_TEST(test_bam_io_bam_index_bai)
     SEQAN_ASSERT_NOT(found);
 }
 
+// Functor for counting alignments per region.
+struct TestBamRegionCounter_
+{
+    seqan::String<unsigned> counts;
+
+    void operator()(seqan::BamAlignmentRecord const &, unsigned regionId)
+    {
+        counts[regionId] += 1;
+    }
+};
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_index_bai_regions)
+{
+    using namespace seqan;
+
+    CharString baiFilename;
+    append(baiFilename, SEQAN_PATH_TO_ROOT());
+    append(baiFilename, "/core/tests/bam_io/small.bam.bai");
+    CharString bamFilename;
+    append(bamFilename, SEQAN_PATH_TO_ROOT());
+    append(bamFilename, "/core/tests/bam_io/small.bam");
+
+    BamIndex<Bai> baiIndex;
+    SEQAN_ASSERT_EQ(read(baiIndex, toCString(baiFilename)), 0);
+
+    // All alignments are in the first window, so there is only one region.
+    String<BamRegion> regions;
+    computeBalancedRegions(regions, baiIndex, 4);
+    SEQAN_ASSERT_EQ(length(regions), 1u);
+    SEQAN_ASSERT_EQ(regions[0].rID, 0);
+    SEQAN_ASSERT_EQ(regions[0].beginPos, 0);
+    SEQAN_ASSERT_EQ(regions[0].endPos, MaxValue<__int32>::VALUE);
+
+    TestBamRegionCounter_ counter;
+    resize(counter.counts, length(regions), 0);
+    SEQAN_ASSERT_EQ(processBamRegions(toCString(bamFilename), baiIndex, regions, counter, 2), 0);
+    SEQAN_ASSERT_EQ(counter.counts[0], 3u);
+
+    // Alignments are assigned to the region containing their begin position.
+    clear(regions);
+    appendValue(regions, BamRegion(0, 0, 2));
+    appendValue(regions, BamRegion(0, 2, 100));
+    appendValue(regions, BamRegion(0, 100, 200));
+    clear(counter.counts);
+    resize(counter.counts, length(regions), 0);
+    SEQAN_ASSERT_EQ(processBamRegions(toCString(bamFilename), baiIndex, regions, counter, 2), 0);
+    SEQAN_ASSERT_EQ(counter.counts[0], 2u);
+    SEQAN_ASSERT_EQ(counter.counts[1], 1u);
+    SEQAN_ASSERT_EQ(counter.counts[2], 0u);
+
+    // A thread count of 0 is treated as 1.
+    clear(counter.counts);
+    resize(counter.counts, length(regions), 0);
+    SEQAN_ASSERT_EQ(processBamRegions(toCString(bamFilename), baiIndex, regions, counter, 0), 0);
+    SEQAN_ASSERT_EQ(counter.counts[0], 2u);
+    SEQAN_ASSERT_EQ(counter.counts[1], 1u);
+}
+
+// Read whole file into a string.
+inline void _testBamIndexReadFile(seqan::CharString & contents, char const * path)
+{
+    std::ifstream in(path, std::ios::binary | std::ios::in);
+    SEQAN_ASSERT(in.good());
+    clear(contents);
+    char c;
+    while (in.get(c))
+        appendValue(contents, c);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_index_bai_build)
+{
+    using namespace seqan;
+
+    CharString bamFilename;
+    append(bamFilename, SEQAN_PATH_TO_ROOT());
+    append(bamFilename, "/core/tests/bam_io/small.bam");
+    CharString baiFilename;
+    append(baiFilename, SEQAN_PATH_TO_ROOT());
+    append(baiFilename, "/core/tests/bam_io/small.bam.bai");
+
+    // Copy BAM file to temporary location.
+    CharString contents;
+    _testBamIndexReadFile(contents, toCString(bamFilename));
+    CharString tmpPath = SEQAN_TEMP_FILENAME();
+    append(tmpPath, ".bam");
+    {
+        std::ofstream out(toCString(tmpPath), std::ios::binary | std::ios::out);
+        out.write(&contents[0], length(contents));
+    }
+
+    BamIndex<Bai> baiIndex;
+    SEQAN_ASSERT(buildIndex(baiIndex, toCString(tmpPath)));
+    SEQAN_ASSERT_EQ(getUnalignedCount(baiIndex), 0u);
+
+    // The index equals the one built by samtools.
+    CharString expected;
+    _testBamIndexReadFile(expected, toCString(baiFilename));
+    CharString tmpBaiPath = tmpPath;
+    append(tmpBaiPath, ".bai");
+    _testBamIndexReadFile(contents, toCString(tmpBaiPath));
+    SEQAN_ASSERT(contents == expected);
+}
+
+SEQAN_DEFINE_TEST(test_bam_io_bam_index_bai_build_parallel)
+{
+    using namespace seqan;
+
+    // Write sorted BAM file with alignments on two references, spanning several windows of the linear index.
+    CharString tmpPath = SEQAN_TEMP_FILENAME();
+    append(tmpPath, ".bam");
+    unsigned numAligned = 0;
+    {
+        BamStream bamIO(toCString(tmpPath), BamStream::WRITE);
+        resize(bamIO.header.sequenceInfos, 3);
+        bamIO.header.sequenceInfos[0].i1 = "REF0";
+        bamIO.header.sequenceInfos[0].i2 = 1000000;
+        bamIO.header.sequenceInfos[1].i1 = "REF1";
+        bamIO.header.sequenceInfos[1].i2 = 1000000;
+        bamIO.header.sequenceInfos[2].i1 = "REF2";
+        bamIO.header.sequenceInfos[2].i2 = 1000000;
+        resize(bamIO.header.records, 1);
+        resize(bamIO.header.records[0].tags, 2);
+        bamIO.header.records[0].type = BAM_HEADER_FIRST;
+        bamIO.header.records[0].tags[0].i1 = "VN";
+        bamIO.header.records[0].tags[0].i2 = "1.3";
+        bamIO.header.records[0].tags[1].i1 = "SO";
+        bamIO.header.records[0].tags[1].i2 = "coordinate";
+
+        BamAlignmentRecord record;
+        record.mapQ = 8;
+        record.seq = "CGATCGATCGATCGATCGAT";
+        record.qual = "IIIIIIIIIIIIIIIIIIII";
+        for (__int32 rID = 0; rID < 3; rID += 2)
+        {
+            for (__int32 pos = 0; pos < 200000; pos += 17)
+            {
+                record.qName = "READ";
+                record.rID = rID;
+                record.beginPos = pos;
+                record.flag = (pos % 7 == 0) ? BAM_FLAG_UNMAPPED : 0;
+                clear(record.cigar);
+                if (!hasFlagUnmapped(record))
+                {
+                    resize(record.cigar, 3);
+                    record.cigar[0].count = 10;
+                    record.cigar[0].operation = 'M';
+                    record.cigar[1].count = (pos % 3) * 1000;
+                    record.cigar[1].operation = 'N';
+                    record.cigar[2].count = 10;
+                    record.cigar[2].operation = 'M';
+                }
+                SEQAN_ASSERT_EQ(writeRecord(bamIO, record), 0);
+                numAligned += 1;
+            }
+        }
+
+        // Unaligned records at the end.
+        clear(record.cigar);
+        record.rID = BamAlignmentRecord::INVALID_REFID;
+        record.beginPos = BamAlignmentRecord::INVALID_POS;
+        record.flag = BAM_FLAG_UNMAPPED;
+        for (unsigned i = 0; i < 100; ++i)
+            SEQAN_ASSERT_EQ(writeRecord(bamIO, record), 0);
+    }
+
+    // The index does not depend on the number of threads.
+    CharString tmpBaiPath = tmpPath;
+    append(tmpBaiPath, ".bai");
+    BamIndex<Bai> baiIndex;
+    SEQAN_ASSERT(buildIndex(baiIndex, toCString(tmpPath)));
+    CharString expected;
+    _testBamIndexReadFile(expected, toCString(tmpBaiPath));
+
+    BamIndex<Bai> baiIndexParallel;
+    SEQAN_ASSERT(buildIndex(baiIndexParallel, toCString(tmpPath), 4));
+    CharString contents;
+    _testBamIndexReadFile(contents, toCString(tmpBaiPath));
+    SEQAN_ASSERT(contents == expected);
+
+    SEQAN_ASSERT_EQ(length(baiIndexParallel._binIndices), 3u);
+    SEQAN_ASSERT(baiIndexParallel._binIndices[1].empty());
+    SEQAN_ASSERT(empty(baiIndexParallel._linearIndices[1]));
+    SEQAN_ASSERT_EQ(getUnalignedCount(baiIndexParallel), 100u);
+
+    // Each aligned record is found exactly once by jumping into the regions.
+    BamIndex<Bai> readIndex;
+    SEQAN_ASSERT_EQ(read(readIndex, toCString(tmpBaiPath)), 0);
+    String<BamRegion> regions;
+    computeBalancedRegions(regions, readIndex, 16);
+    SEQAN_ASSERT_GT(length(regions), 2u);
+    TestBamRegionCounter_ counter;
+    resize(counter.counts, length(regions), 0);
+    SEQAN_ASSERT_EQ(processBamRegions(toCString(tmpPath), readIndex, regions, counter, 4), 0);
+    unsigned total = 0;
+    for (unsigned i = 0; i < length(counter.counts); ++i)
+        total += counter.counts[i];
+    SEQAN_ASSERT_EQ(total, numAligned);
+}
+
 #endif  // CORE_TESTS_BAM_IO_TEST_BAM_INDEX_H_
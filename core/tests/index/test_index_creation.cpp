@@ -56,5 +56,7 @@ using namespace seqan;
 SEQAN_BEGIN_TESTSUITE(test_index)
 {
 	SEQAN_CALL_TEST(testIndexCreation);
+	SEQAN_CALL_TEST(testIndexCreationSais);
+	SEQAN_CALL_TEST(testIndexCreationPlcp);
 }
 SEQAN_END_TESTSUITE
@@ -267,6 +267,153 @@ SEQAN_DEFINE_TEST(testIndexCreation)
 			std::cout << algNames[i] << " " << 1024.0*1024.0 * timeSum[i] / textSum << std::endl;
 }
 
+template <typename TText, typename TAlgSpec>
+void _testSaisString(TText const & text, TAlgSpec const & alg)
+{
+	typedef typename SAValue<TText>::Type TSAValue;
+
+	String<TSAValue> sa, ref;
+	createSuffixArray(sa, text, alg);
+	resize(ref, length(text));
+	createSuffixArray(ref, text, SAQSort());
+	SEQAN_ASSERT_EQ(length(sa), length(text));
+	for (unsigned i = 0; i < length(sa); ++i)
+		SEQAN_ASSERT_EQ(sa[i], ref[i]);
+}
+
+template <typename TStringSet, typename TAlgSpec>
+void _testSaisStringSet(TStringSet const & set, TAlgSpec const & alg)
+{
+	typedef typename SAValue<TStringSet>::Type TSAValue;
+
+	String<TSAValue> sa, ref;
+	createSuffixArray(sa, set, alg);
+	resize(ref, lengthSum(set));
+	createSuffixArray(ref, set, Skew7());
+	SEQAN_ASSERT_EQ(length(sa), lengthSum(set));
+	for (unsigned i = 0; i < length(sa); ++i)
+		SEQAN_ASSERT_EQ(sa[i], ref[i]);
+}
+
+template <typename TAlgSpec>
+void _testSais(TAlgSpec const & alg)
+{
+	_testSaisString(CharString(""), alg);
+	_testSaisString(CharString("A"), alg);
+	_testSaisString(CharString("MISSISSIPPI"), alg);
+	_testSaisString(CharString("AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA"), alg);
+	_testSaisString(CharString("ABABABABABABABABABABABABABABABABABABABAB"), alg);
+
+	// random and repetitive texts large enough to be processed in several blocks
+	DnaString dna;
+	CharString repeats;
+	resize(dna, 200000);
+	alphabetRandomize(dna);
+	for (unsigned i = 0; i < 200000; ++i)
+		appendValue(repeats, (char)('a' + ((i % 997) * (i % 997)) % 5 + (pickRandomNumber(getRng()) % 50 == 0)));
+	_testSaisString(dna, alg);
+	_testSaisString(repeats, alg);
+
+	// 64 bit positions
+	String<__uint64> sa64;
+	createSuffixArray(sa64, CharString("MISSISSIPPI"), alg);
+	SEQAN_ASSERT_EQ(sa64[0], 10u);
+	SEQAN_ASSERT_EQ(sa64[10], 2u);
+
+	// string sets with empty and identical sequences
+	StringSet<CharString> set;
+	appendValue(set, "MISSISSIPPI");
+	appendValue(set, "");
+	appendValue(set, "SIPPI");
+	appendValue(set, "MISSISSIPPI");
+	appendValue(set, "I");
+	_testSaisStringSet(set, alg);
+
+	StringSet<DnaString> dnaSet;
+	for (unsigned i = 0; i < 50; ++i)
+		appendValue(dnaSet, infix(dna, i * 1000, i * 1000 + 500 + i * 37));
+	appendValue(dnaSet, infix(dna, 0, 500));
+	_testSaisStringSet(dnaSet, alg);
+}
+
+SEQAN_DEFINE_TEST(testIndexCreationSais)
+{
+	_testSais(Sais());
+	_testSais(ParallelSais());
+
+	CharString text = "MISSISSIPPI";
+	Index<CharString> index(text);
+	indexCreate(index, FibreSA(), ParallelSais());
+	SEQAN_ASSERT(isSuffixArray(indexSA(index), text));
+}
+
+template <typename TText, typename TSA, typename TAlgSpec>
+void _testPlcp(TText const & text, TSA const & sa, TAlgSpec const & alg)
+{
+	String<unsigned> lcp, ref;
+	resize(lcp, length(sa));
+	resize(ref, length(sa));
+	createLcpTable(lcp, text, sa, alg);
+	createLcpTable(ref, text, sa, Kasai());
+	for (unsigned i = 0; i < length(sa); ++i)
+		SEQAN_ASSERT_EQ(lcp[i], ref[i]);
+
+	// semi-external construction
+	String<typename Value<TSA>::Type, External<> > extSA;
+	String<unsigned, External<> > extLcp;
+	extSA = sa;
+	resize(extLcp, length(sa));
+	createLcpTable(extLcp, text, extSA, alg);
+	for (unsigned i = 0; i < length(sa); ++i)
+		SEQAN_ASSERT_EQ((unsigned)extLcp[i], ref[i]);
+}
+
+template <typename TAlgSpec>
+void _testPlcp(TAlgSpec const & alg)
+{
+	CharString text;
+	for (unsigned i = 0; i < 100000; ++i)
+		appendValue(text, (char)('a' + (pickRandomNumber(getRng()) % 3 == 0) + ((i / 7) % 3 == 0)));
+	append(text, "MISSISSIPPI");
+	append(text, infix(text, 500, 30000));
+
+	String<unsigned> sa;
+	resize(sa, length(text));
+	createSuffixArray(sa, text, Skew7());
+	_testPlcp(text, sa, alg);
+
+	CharString mississippi = "MISSISSIPPI";
+	String<unsigned> saM;
+	resize(saM, length(mississippi));
+	createSuffixArray(saM, mississippi, Skew7());
+	_testPlcp(mississippi, saM, alg);
+
+	StringSet<CharString> set;
+	appendValue(set, "MISSISSIPPI");
+	appendValue(set, "");
+	appendValue(set, infix(text, 0, 5000));
+	appendValue(set, "SIPPI");
+	appendValue(set, infix(text, 0, 5000));
+	appendValue(set, "MISSISSIPPI");
+	typedef SAValue<StringSet<CharString> >::Type TSAValue;
+	String<TSAValue> saSet;
+	resize(saSet, lengthSum(set));
+	createSuffixArray(saSet, set, Skew7());
+	_testPlcp(set, saSet, alg);
+}
+
+SEQAN_DEFINE_TEST(testIndexCreationPlcp)
+{
+	_testPlcp(Plcp());
+	_testPlcp(ParallelPlcp());
+
+	CharString text = "MISSISSIPPI";
+	Index<CharString> index(text);
+	indexRequire(index, FibreSA());
+	indexCreate(index, FibreLcp(), ParallelPlcp());
+	SEQAN_ASSERT(isLCPTable(indexLcp(index), indexSA(index), text));
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
 
@@ -135,7 +135,11 @@ SEQAN_BEGIN_TESTSUITE(test_fm_index_beta)
     SEQAN_CALL_TEST(test_fm_index_find_first_index_);
     SEQAN_CALL_TEST(test_fm_index_get_fibre);
     SEQAN_CALL_TEST(test_fm_index_search);
+    SEQAN_CALL_TEST(test_fm_index_parallel_construction);
+    SEQAN_CALL_TEST(test_fm_index_bidirectional);
+    SEQAN_CALL_TEST(test_fm_index_find_ranges);
     SEQAN_CALL_TEST(test_fm_index_open_save);
+    SEQAN_CALL_TEST(test_fm_index_open_mmap);
 
     SEQAN_CALL_TEST(fm_index_iterator_constuctor);
     SEQAN_CALL_TEST(fm_index_iterator_go_down);
@@ -483,6 +483,189 @@ void fmIndexOpenSave(Index<TText, FMIndex<TIndexSpec, TOptimization> > /*tag*/)
     }
 }
 
+template <typename TIndexSpec>
+void fmIndexOpenMMap()
+{
+    typedef Index<DnaString, FMIndex<TIndexSpec, void> > TIndex;
+    typedef Index<String<Dna, MMap<> >, FMIndex<TIndexSpec, MMapFibres> > TMMapIndex;
+
+	DnaString text;
+	generateText(text, 10000);
+
+	CharString tempFilename = SEQAN_TEMP_FILENAME();
+
+    TIndex indexSave(text);
+    indexCreate(indexSave);
+    SEQAN_ASSERT(save(indexSave, toCString(tempFilename)));
+
+    // An index saved from main memory can be mapped read-only.
+    TMMapIndex indexOpen;
+    SEQAN_ASSERT(open(indexOpen, toCString(tempFilename), OPEN_RDONLY));
+    SEQAN_ASSERT_EQ(length(getFibre(indexOpen, FibreText())), length(text));
+    SEQAN_ASSERT_EQ(length(getFibre(indexOpen, FibreSA())), length(getFibre(indexSave, FibreSA())));
+
+    Finder<TIndex> saveFinder(indexSave);
+    Finder<TMMapIndex> openFinder(indexOpen);
+
+    StringSet<DnaString> pattern;
+    generatePattern(pattern, text);
+
+    for (unsigned i = 0; i < length(pattern); ++i)
+    {
+        clear(saveFinder);
+        clear(openFinder);
+
+        while (find(saveFinder, pattern[i]))
+        {
+            SEQAN_ASSERT(find(openFinder, pattern[i]));
+            SEQAN_ASSERT_EQ(position(openFinder), position(saveFinder));
+        }
+        SEQAN_ASSERT_NOT(find(openFinder, pattern[i]));
+    }
+}
+
+template <typename TText, typename TIndexSpec, typename TOptimization>
+void fmIndexBidirectional(Index<TText, BidirectionalFMIndex<TIndexSpec, TOptimization> > /*tag*/)
+{
+	typedef Index<TText, BidirectionalFMIndex<TIndexSpec, TOptimization> > TIndex;
+	typedef Index<TText, FMIndex<TIndexSpec, TOptimization> > TFmIndex;
+	typedef typename Iterator<TIndex, TopDown<ParentLinks<> > >::Type TIter;
+	typedef typename Value<TIndex>::Type TAlphabet;
+	typedef typename SAValue<TIndex>::Type TSAValue;
+    typedef String<TAlphabet> TString;
+
+	TText text;
+	generateText(text);
+
+	TIndex index(text);
+	TFmIndex fmIndex(text);
+	Finder<TFmIndex> fmFinder(fmIndex);
+
+	StringSet<TString> pattern;
+	generatePattern(pattern, text);
+
+    for (unsigned i = 0; i < 200; ++i)
+    {
+        TString localPattern = pattern[i];
+        unsigned middle = length(localPattern) / 2;
+
+        String<TSAValue> expected;
+        clear(fmFinder);
+        while (find(fmFinder, localPattern))
+            appendValue(expected, position(fmFinder));
+        std::sort(begin(expected, Standard()), end(expected, Standard()));
+
+        // Start in the middle of the pattern, extend to the right and then to the left.
+        TIter it(index);
+        bool found = extendRight(it, suffix(localPattern, middle)) && extendLeft(it, prefix(localPattern, middle));
+        SEQAN_ASSERT_EQ(found, !empty(expected));
+
+        // Alternate between left and right extensions.
+        TIter altIt(index);
+        bool altFound = true;
+        for (unsigned l = middle, r = middle; altFound && (l > 0 || r < length(localPattern));)
+        {
+            if (r < length(localPattern))
+                altFound = extendRight(altIt, localPattern[r++]);
+            if (altFound && l > 0)
+                altFound = extendLeft(altIt, localPattern[--l]);
+        }
+        SEQAN_ASSERT_EQ(altFound, !empty(expected));
+
+        if (!found)
+            continue;
+
+        SEQAN_ASSERT_EQ(repLength(it), length(localPattern));
+        SEQAN_ASSERT_EQ(countOccurrences(it), length(expected));
+        SEQAN_ASSERT_EQ(value(it).revRange.i2 - value(it).revRange.i1, length(expected));
+        SEQAN_ASSERT(value(it).range == value(altIt).range);
+        SEQAN_ASSERT(value(it).revRange == value(altIt).revRange);
+
+        String<TSAValue> occurrences;
+        for (unsigned j = 0; j < length(getOccurrences(it)); ++j)
+            appendValue(occurrences, getOccurrences(it)[j]);
+        std::sort(begin(occurrences, Standard()), end(occurrences, Standard()));
+        SEQAN_ASSERT(occurrences == expected);
+
+        // Going up undoes the last extension.
+        typename VertexDescriptor<TIndex>::Type vDesc = value(it);
+        if (extendRight(it, TAlphabet(0)))
+        {
+            SEQAN_ASSERT(goUp(it));
+            SEQAN_ASSERT(value(it).range == vDesc.range);
+            SEQAN_ASSERT(value(it).revRange == vDesc.revRange);
+        }
+    }
+}
+
+template <typename TText, typename TIndexSpec, typename TOptimization>
+void fmIndexFindRanges(Index<TText, FMIndex<TIndexSpec, TOptimization> > /*tag*/)
+{
+	typedef Index<TText, FMIndex<TIndexSpec, TOptimization> > TIndex;
+	typedef typename Value<TIndex>::Type TAlphabet;
+	typedef typename Size<TIndex>::Type TSize;
+	typedef typename SAValue<TIndex>::Type TSAValue;
+    typedef String<TAlphabet> TString;
+
+	TText text;
+	generateText(text);
+
+	TIndex index(text);
+	Finder<TIndex> finder(index);
+
+	StringSet<TString> pattern;
+	generatePattern(pattern, text);
+    appendValue(pattern, TString());
+
+    String<Pair<TSize> > ranges;
+    findRanges(ranges, index, pattern);
+    SEQAN_ASSERT_EQ(length(ranges), length(pattern));
+
+    // The empty pattern occurs at every non-sentinel position.
+    SEQAN_ASSERT_EQ(back(ranges).i1, countSequences(index));
+    SEQAN_ASSERT_EQ(back(ranges).i2, index.n);
+
+    for (unsigned i = 0; i + 1 < length(pattern); ++i)
+    {
+        String<TSAValue> expected;
+        clear(finder);
+        while (find(finder, pattern[i]))
+            appendValue(expected, position(finder));
+        std::sort(begin(expected, Standard()), end(expected, Standard()));
+
+        SEQAN_ASSERT_LEQ(ranges[i].i1, ranges[i].i2);
+        String<TSAValue> occurrences;
+        for (TSize j = ranges[i].i1; j < ranges[i].i2; ++j)
+            appendValue(occurrences, getFibre(index, FibreSA())[j]);
+        std::sort(begin(occurrences, Standard()), end(occurrences, Standard()));
+        SEQAN_ASSERT(occurrences == expected);
+    }
+}
+
+template <typename TText, typename TIndexSpec, typename TOptimization>
+void fmIndexParallelConstruction(Index<TText, FMIndex<TIndexSpec, TOptimization> > /*tag*/, TText & text)
+{
+	typedef Index<TText, FMIndex<TIndexSpec, TOptimization> > TIndex;
+
+#ifdef _OPENMP
+    int numThreads = omp_get_max_threads();
+    omp_set_num_threads(1);
+#endif
+    TIndex serialIndex(text);
+    SEQAN_ASSERT(indexCreate(serialIndex));
+
+#ifdef _OPENMP
+    omp_set_num_threads(4);
+#endif
+    TIndex parallelIndex(text);
+    SEQAN_ASSERT(indexCreate(parallelIndex));
+#ifdef _OPENMP
+    omp_set_num_threads(numThreads);
+#endif
+
+    SEQAN_ASSERT(serialIndex == parallelIndex);
+}
+
 // A test for strings.
 SEQAN_DEFINE_TEST(test_fm_index_constructor)
 {
@@ -511,6 +694,12 @@ SEQAN_DEFINE_TEST(test_fm_index_constructor)
 //         fmIndexConstructor(uCharTag);
 //         fmIndexConstructor(charTag);
     }
+    {
+        Index<String<Dna>, FMIndex<IB<>, void > > dnaTag;
+        Index<String<Dna5>, FMIndex<IB<>, void > > dna5Tag;
+        fmIndexConstructor(dnaTag);
+        fmIndexConstructor(dna5Tag);
+    }
 }
 
 SEQAN_DEFINE_TEST(test_fm_index_clear)
@@ -653,6 +842,85 @@ SEQAN_DEFINE_TEST(test_fm_index_search)
         fmIndexSearch(sCharTag);
         fmIndexSearch(charTag);
     }  
+    {
+        Index<DnaString, FMIndex<IB<>, void > > dnaTag;
+        Index<String<Dna5>, FMIndex<IB<>, void > > dna5Tag;
+        Index<StringSet<DnaString>, FMIndex<IB<>, void > > dnaSetTag;
+        Index<StringSet<Dna5String>, FMIndex<IB<>, void > > dna5SetTag;
+        fmIndexSearch(dnaTag);
+        fmIndexSearch(dna5Tag);
+        fmIndexSearch(dnaSetTag);
+        fmIndexSearch(dna5SetTag);
+    }
+}
+
+SEQAN_DEFINE_TEST(test_fm_index_parallel_construction)
+{
+    using namespace seqan;
+
+    {
+        DnaString text;
+        generateText(text);
+        fmIndexParallelConstruction(Index<DnaString, FMIndex<WT<>, void > >(), text);
+    }
+    {
+        String<Dna5> text;
+        generateText(text);
+        fmIndexParallelConstruction(Index<String<Dna5>, FMIndex<SBM<>, void > >(), text);
+    }
+    {
+        String<char> text;
+        generateText(text);
+        fmIndexParallelConstruction(Index<String<char>, FMIndex<WT<>, void > >(), text);
+    }
+    {
+        StringSet<DnaString> text;
+        generateText(text);
+        fmIndexParallelConstruction(Index<StringSet<DnaString>, FMIndex<WT<>, void > >(), text);
+    }
+    {
+        StringSet<Dna5String> text;
+        generateText(text);
+        fmIndexParallelConstruction(Index<StringSet<Dna5String>, FMIndex<SBM<>, void > >(), text);
+    }
+    {
+        DnaString text;
+        generateText(text);
+        fmIndexParallelConstruction(Index<DnaString, FMIndex<IB<>, void > >(), text);
+    }
+
+    // The suffix array construction algorithm can be chosen.
+    {
+        DnaString text;
+        generateText(text);
+        Index<DnaString, FMIndex<WT<>, void > > defaultIndex(text);
+        Index<DnaString, FMIndex<WT<>, void > > skew3Index(text);
+        SEQAN_ASSERT(indexCreate(defaultIndex));
+        SEQAN_ASSERT(indexCreate(skew3Index, FibreSaLfTable(), Skew3()));
+        SEQAN_ASSERT(defaultIndex == skew3Index);
+    }
+}
+
+SEQAN_DEFINE_TEST(test_fm_index_bidirectional)
+{
+    using namespace seqan;
+
+    fmIndexBidirectional(Index<DnaString, BidirectionalFMIndex<> >());
+    fmIndexBidirectional(Index<String<Dna5>, BidirectionalFMIndex<SBM<>, void> >());
+    fmIndexBidirectional(Index<String<char>, BidirectionalFMIndex<WT<>, void> >());
+    fmIndexBidirectional(Index<StringSet<DnaString>, BidirectionalFMIndex<IB<>, void> >());
+    fmIndexBidirectional(Index<StringSet<String<char> >, BidirectionalFMIndex<WT<>, void> >());
+}
+
+SEQAN_DEFINE_TEST(test_fm_index_find_ranges)
+{
+    using namespace seqan;
+
+    fmIndexFindRanges(Index<DnaString, FMIndex<> >());
+    fmIndexFindRanges(Index<String<Dna5>, FMIndex<SBM<>, void> >());
+    fmIndexFindRanges(Index<String<char>, FMIndex<WT<>, void> >());
+    fmIndexFindRanges(Index<StringSet<DnaString>, FMIndex<IB<>, void> >());
+    fmIndexFindRanges(Index<StringSet<String<char> >, FMIndex<WT<>, void> >());
 }
 
 SEQAN_DEFINE_TEST(test_fm_index_open_save)
@@ -669,6 +937,14 @@ SEQAN_DEFINE_TEST(test_fm_index_open_save)
 }
 
 
+SEQAN_DEFINE_TEST(test_fm_index_open_mmap)
+{
+    using namespace seqan;
+
+    fmIndexOpenMMap<WT<> >();
+    fmIndexOpenMMap<IB<> >();
+}
+
 SEQAN_DEFINE_TEST(test_lf_table_lf_mapping)
 {
     using namespace seqan;
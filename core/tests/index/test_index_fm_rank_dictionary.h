@@ -56,9 +56,11 @@ typedef seqan::TagList<
             seqan::TagList<seqan::WaveletTree<signed char> >, seqan::TagList<
             seqan::TagList<seqan::SequenceBitMask<seqan::Dna> >, seqan::TagList<
             seqan::TagList<seqan::SequenceBitMask<seqan::Dna5> >, seqan::TagList<
-            seqan::TagList<seqan::SequenceBitMask<seqan::AminoAcid> >
+            seqan::TagList<seqan::SequenceBitMask<seqan::AminoAcid> >, seqan::TagList<
+            seqan::TagList<seqan::InterleavedBlocks<seqan::Dna> >, seqan::TagList<
+            seqan::TagList<seqan::InterleavedBlocks<seqan::Dna5> >
             > > > > > >
-            > > >
+            > > > > >
         RankDictionaryTestTypes;
 
 
@@ -239,6 +241,19 @@ void rankDictionaryGetFibre(RankDictionary<SequenceBitMask<TValue> > & /*tag*/)
 	SEQAN_ASSERT_EQ(length(getFibre(rankDictionary, FibreBitStrings())), 110u);
 }
 
+template <typename TValue>
+void rankDictionaryGetFibre(RankDictionary<InterleavedBlocks<TValue> > & /*tag*/)
+{
+    String<typename Value<RankDictionary<InterleavedBlocks<TValue> > >::Type> text = "ACGTNACGTNACGTN";
+	RankDictionary<InterleavedBlocks<TValue> > rankDictionary(text);
+
+    typename Fibre<RankDictionary<InterleavedBlocks<TValue> >, FibreBlocks>::Type & tempBlocks = getFibre(rankDictionary, FibreBlocks());
+
+    resize(tempBlocks, 110);
+
+	SEQAN_ASSERT_EQ(length(getFibre(rankDictionary, FibreBlocks())), 110u);
+}
+
 
 SEQAN_TYPED_TEST(RankDictionaryTestCommon, GetFibre)
 {
@@ -344,6 +359,9 @@ void _rankDictionaryFill(TRankDictionary & /*tag*/)
 template <typename TValue>
 void _rankDictionaryFill(RankDictionary<SequenceBitMask<TValue> > & /*tag*/) {}
 
+template <typename TValue>
+void _rankDictionaryFill(RankDictionary<InterleavedBlocks<TValue> > & /*tag*/) {}
+
 SEQAN_TYPED_TEST(RankDictionaryTestCommon, Fill)
 {
     using namespace seqan;
@@ -56,6 +56,8 @@ typedef seqan::TagList<
             seqan::TagList<SentinelRankDictionary<RankDictionary<seqan::SequenceBitMask<seqan::Dna> >, Sentinel> >, seqan::TagList<
             seqan::TagList<SentinelRankDictionary<RankDictionary<seqan::SequenceBitMask<seqan::Dna5> >, Sentinel> >, seqan::TagList<
             seqan::TagList<SentinelRankDictionary<RankDictionary<seqan::SequenceBitMask<seqan::AminoAcid> >, Sentinel> >, seqan::TagList<
+            seqan::TagList<SentinelRankDictionary<RankDictionary<seqan::InterleavedBlocks<seqan::Dna> >, Sentinel> >, seqan::TagList<
+            seqan::TagList<SentinelRankDictionary<RankDictionary<seqan::InterleavedBlocks<seqan::Dna5> >, Sentinel> >, seqan::TagList<
             seqan::TagList<SentinelRankDictionary<RankDictionary<seqan::WaveletTree<seqan::Dna> >, Sentinels> >, seqan::TagList<
             seqan::TagList<SentinelRankDictionary<RankDictionary<seqan::WaveletTree<seqan::Dna5> >, Sentinels> >, seqan::TagList<
             seqan::TagList<SentinelRankDictionary<RankDictionary<seqan::WaveletTree<seqan::AminoAcid> >, Sentinels> >, seqan::TagList<
@@ -64,11 +66,13 @@ typedef seqan::TagList<
             seqan::TagList<SentinelRankDictionary<RankDictionary<seqan::WaveletTree<signed char> >, Sentinels> >, seqan::TagList<
             seqan::TagList<SentinelRankDictionary<RankDictionary<seqan::SequenceBitMask<seqan::Dna> >, Sentinels> >, seqan::TagList<
             seqan::TagList<SentinelRankDictionary<RankDictionary<seqan::SequenceBitMask<seqan::Dna5> >, Sentinels> >, seqan::TagList<
-            seqan::TagList<SentinelRankDictionary<RankDictionary<seqan::SequenceBitMask<seqan::AminoAcid> >, Sentinels> >
+            seqan::TagList<SentinelRankDictionary<RankDictionary<seqan::SequenceBitMask<seqan::AminoAcid> >, Sentinels> >, seqan::TagList<
+            seqan::TagList<SentinelRankDictionary<RankDictionary<seqan::InterleavedBlocks<seqan::Dna> >, Sentinels> >, seqan::TagList<
+            seqan::TagList<SentinelRankDictionary<RankDictionary<seqan::InterleavedBlocks<seqan::Dna5> >, Sentinels> >
             > > > > > >
-            > > >
+            > > > > >
             > > > > > >
-            > > >
+            > > > > >
         SentinelRankDictionaryTestTypes;
 
 
@@ -88,6 +88,16 @@ void randomize(TBuffer &buf)
 		buf[i] = pickRandomNumber(getRng(), pdf);
 }
 
+template < typename TBuffer >
+void alphabetRandomize(TBuffer &buf) {
+	typedef typename Value<TBuffer>::Type TValue;
+    seqan::Pdf<seqan::Uniform<int> > pdf(0, ValueSize<TValue>::VALUE - 1);
+
+	typename Size<TBuffer>::Type i, s = length(buf);
+	for(i = 0; i < s; i++)
+		buf[i] = TValue(pickRandomNumber(getRng(), pdf));
+}
+
 template < typename TBuffer >
 void textRandomize(TBuffer &buf) {
     seqan::Pdf<seqan::Uniform<int> > pdf(0, 1);
@@ -60,6 +60,7 @@ SEQAN_BEGIN_TESTSUITE(test_index)
 	SEQAN_CALL_TEST(testSTreeIterators_Esa);
 	SEQAN_CALL_TEST(testFind_Esa_Mlr);
 	SEQAN_CALL_TEST(testCompareIndices_Esa_Wotd);
+	SEQAN_CALL_TEST(testOpenMMap_Esa);
 	SEQAN_CALL_TEST(testMultiIndex);
 	SEQAN_CALL_TEST(testMUMs);
 	SEQAN_CALL_TEST(testMaxRepeats);
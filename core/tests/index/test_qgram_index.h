@@ -321,6 +321,208 @@ SEQAN_DEFINE_TEST(testUngappedQGramIndexMulti)
 }
 
 
+//////////////////////////////////////////////////////////////////////////////
+
+template <typename TIndex, typename TSequence>
+void _testQGramIndexParallelSequence(TIndex &refIndex, TIndex &testIndex, TSequence const &sequence)
+{
+	typedef typename Fibre<TIndex, QGramShape>::Type	TShape;
+	typedef typename Fibre<TIndex, QGramSA>::Type		TSA;
+	typedef typename Infix<TSA const>::Type				TOccurrences;
+
+	TShape &shape = indexShape(refIndex);
+	if (length(sequence) < length(shape)) return;
+	for (unsigned i = 0; i + length(shape) <= length(sequence); ++i)
+	{
+		hash(shape, begin(sequence, Standard()) + i);
+		TOccurrences refOccs = getOccurrences(refIndex, shape);
+		TOccurrences testOccs = getOccurrences(testIndex, shape);
+		SEQAN_ASSERT_EQ(length(refOccs), length(testOccs));
+		for (unsigned j = 0; j < length(refOccs); ++j)
+			SEQAN_ASSERT_EQ(refOccs[j], testOccs[j]);
+	}
+}
+
+template <typename TIndex, typename TText>
+void _testQGramIndexParallelOccurrences(TIndex &refIndex, TIndex &testIndex, TText const &text)
+{
+	_testQGramIndexParallelSequence(refIndex, testIndex, text);
+}
+
+template <typename TIndex, typename TString, typename TSpec>
+void _testQGramIndexParallelOccurrences(TIndex &refIndex, TIndex &testIndex, StringSet<TString, TSpec> const &text)
+{
+	for (unsigned seqNo = 0; seqNo < length(text); ++seqNo)
+		_testQGramIndexParallelSequence(refIndex, testIndex, text[seqNo]);
+}
+
+// Compares the parallel construction with all chunk numbers and both ways of
+// counting against the sequential construction.
+template <typename TIndex, typename TText>
+void _testQGramIndexParallel(TText &text, unsigned stepSize)
+{
+	TIndex refIndex(text);
+	setStepSize(refIndex, stepSize);
+	indexCreate(refIndex, QGramSADir());
+
+	for (unsigned numChunks = 1; numChunks <= 5; numChunks += 2)
+		for (int chunkCounts = 0; chunkCounts < 2; ++chunkCounts)
+		{
+			TIndex testIndex(text);
+			setStepSize(testIndex, stepSize);
+			resize(indexSA(testIndex), _qgramQGramCount(testIndex), Exact());
+			resize(indexDir(testIndex), _fullDirLength(testIndex), Exact());
+			_qgramClearDir(indexDir(testIndex), indexBucketMap(testIndex));
+			_createQGramIndexParallel(indexSA(testIndex), indexDir(testIndex), indexBucketMap(testIndex), text,
+			                          indexShape(testIndex), stepSize, numChunks, chunkCounts != 0);
+
+			SEQAN_ASSERT_EQ(length(indexSA(refIndex)), length(indexSA(testIndex)));
+			SEQAN_ASSERT_EQ(length(indexDir(refIndex)), length(indexDir(testIndex)));
+			_testQGramIndexParallelOccurrences(refIndex, testIndex, text);
+		}
+}
+
+SEQAN_DEFINE_TEST(testQGramIndexParallel)
+{
+	DnaString text;
+	resize(text, 3000);
+	alphabetRandomize(text);
+	StringSet<DnaString> strings;
+	for (unsigned i = 0; i < 23; ++i)
+		appendValue(strings, infix(text, i * 97, i * 97 + (i * 31) % 200));
+
+	for (unsigned stepSize = 1; stepSize <= 3; stepSize += 2)
+	{
+		_testQGramIndexParallel<Index<DnaString, IndexQGram<UngappedShape<4> > > >(text, stepSize);
+		_testQGramIndexParallel<Index<DnaString, IndexQGram<GappedShape<HardwiredShape<1, 2> > > > >(text, stepSize);
+		_testQGramIndexParallel<Index<DnaString, IndexQGram<UngappedShape<5>, OpenAddressing> > >(text, stepSize);
+		_testQGramIndexParallel<Index<StringSet<DnaString>, IndexQGram<UngappedShape<3> > > >(strings, stepSize);
+		_testQGramIndexParallel<Index<StringSet<DnaString>, IndexQGram<UngappedShape<6>, OpenAddressing> > >(strings, stepSize);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Collects the minimizers of a sequence by comparing the keys of all q-grams
+// of each window.
+template <typename TIndex, typename TSequence, typename TPositions>
+void _testMinimizersNaive(TPositions &positions, TIndex &index, TSequence const &sequence)
+{
+	typename Fibre<TIndex, QGramShape>::Type shape = indexShape(index);
+	clear(positions);
+	if (length(sequence) < length(shape)) return;
+
+	unsigned qgramCount = length(sequence) - length(shape) + 1;
+	unsigned windowSize = _min(getWindowSize(index), qgramCount);
+	for (unsigned start = 0; start + windowSize <= qgramCount; ++start)
+	{
+		unsigned best = start;
+		for (unsigned i = start + 1; i < start + windowSize; ++i)
+			if (_minimizerKey(hash(shape, begin(sequence) + i), getMinimizerSeed(index)) <
+				_minimizerKey(hash(shape, begin(sequence) + best), getMinimizerSeed(index)))
+				best = i;
+		if (empty(positions) || back(positions) != best)
+			appendValue(positions, best);
+	}
+}
+
+template <typename TIndex>
+void _testMinimizerIndex(DnaString const &text, unsigned windowSize, __uint64 seed)
+{
+	typedef MinimizerIterator<TIndex, DnaString> TMinimizerIterator;
+	typedef typename Infix<typename Fibre<TIndex, QGramSA>::Type const>::Type TOccurrences;
+
+	TIndex index(text);
+	setWindowSize(index, windowSize);
+	setMinimizerSeed(index, seed);
+
+	// the iterator enumerates exactly the naive minimizers
+	String<unsigned> expected, found;
+	_testMinimizersNaive(expected, index, text);
+	for (TMinimizerIterator it(index, text); !atEnd(it); goNext(it))
+		appendValue(found, position(it));
+	SEQAN_ASSERT(expected == found);
+
+	// the index stores exactly these positions
+	indexRequire(index, QGramSADir());
+	SEQAN_ASSERT_EQ(length(indexSA(index)), length(expected));
+	SEQAN_ASSERT_EQ(back(indexDir(index)), length(expected));
+	for (TMinimizerIterator it(index, text); !atEnd(it); goNext(it))
+	{
+		TOccurrences occ = getOccurrences(index, it);
+		SEQAN_ASSERT(std::find(begin(occ), end(occ), position(it)) != end(occ));
+		for (unsigned i = 0; i < length(occ); ++i)
+			SEQAN_ASSERT(std::binary_search(begin(expected), end(expected), (unsigned)occ[i]));
+	}
+
+	// every query sharing w+q-1 characters with the text hits the text
+	unsigned windowLength = getWindowSize(index) + length(indexShape(index)) - 1;
+	for (unsigned start = 0; start + windowLength <= length(text); start += 7)
+	{
+		DnaString query = infix(text, start, start + windowLength);
+		bool hit = false;
+		for (TMinimizerIterator it(index, query); !atEnd(it); goNext(it))
+		{
+			TOccurrences occ = getOccurrences(index, it);
+			hit |= std::find(begin(occ), end(occ), start + position(it)) != end(occ);
+		}
+		SEQAN_ASSERT(hit);
+	}
+}
+
+SEQAN_DEFINE_TEST(testQGramIndexMinimizer)
+{
+	DnaString text;
+	resize(text, 2000);
+	alphabetRandomize(text);
+	append(text, "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAACGACGACGACGACGACGACGACGACG");
+
+	typedef Index<DnaString, IndexQGram<UngappedShape<6>, Minimizer> > TUngappedIndex;
+	typedef Index<DnaString, IndexQGram<GappedShape<HardwiredShape<1, 2, 1> >, Minimizer> > TGappedIndex;
+	_testMinimizerIndex<TUngappedIndex>(text, 10, 0x9e3779b97f4a7c15ull);
+	_testMinimizerIndex<TUngappedIndex>(text, 10, 0);
+	_testMinimizerIndex<TUngappedIndex>(text, 1, 42);
+	_testMinimizerIndex<TUngappedIndex>(text, 3000, 42);
+	_testMinimizerIndex<TGappedIndex>(text, 5, 42);
+
+	// a window of w q-grams stores about 2/(w+1) of the positions
+	TUngappedIndex index(text);
+	SEQAN_ASSERT_EQ(getWindowSize(index), 10u);
+	indexRequire(index, QGramSADir());
+	SEQAN_ASSERT_LT(length(indexSA(index)), length(text) / 4);
+
+	// short sequences of a string set store the minimum of all their q-grams
+	StringSet<DnaString> strings;
+	appendValue(strings, infix(text, 0, 300));
+	appendValue(strings, "ACG");
+	appendValue(strings, infix(text, 300, 310));
+	appendValue(strings, infix(text, 500, 900));
+
+	typedef Index<StringSet<DnaString>, IndexQGram<UngappedShape<4>, Minimizer> > TSetIndex;
+	typedef MinimizerIterator<TSetIndex, DnaString> TSetIterator;
+	TSetIndex setIndex(strings);
+	setWindowSize(setIndex, 8);
+	indexRequire(setIndex, QGramSADir());
+
+	unsigned minimizerCount = 0;
+	for (unsigned seqNo = 0; seqNo < length(strings); ++seqNo)
+	{
+		String<unsigned> expected;
+		_testMinimizersNaive(expected, setIndex, strings[seqNo]);
+		minimizerCount += length(expected);
+		for (TSetIterator it(setIndex, strings[seqNo]); !atEnd(it); goNext(it))
+		{
+			SAValue<TSetIndex>::Type localPos;
+			assignValueI1(localPos, seqNo);
+			assignValueI2(localPos, position(it));
+			SEQAN_ASSERT(std::find(begin(getOccurrences(setIndex, it)), end(getOccurrences(setIndex, it)), localPos) !=
+			             end(getOccurrences(setIndex, it)));
+		}
+	}
+	SEQAN_ASSERT_EQ(length(indexSA(setIndex)), minimizerCount);
+	SEQAN_ASSERT(atEnd(TSetIterator(setIndex, strings[1])));
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
 SEQAN_DEFINE_TEST(testQGramFind)
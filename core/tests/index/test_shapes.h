@@ -137,6 +137,60 @@ SEQAN_DEFINE_TEST(testShapes)
     testHashInit(shapeC);
 }
 
+template <typename TShape, typename TText>
+void testHashAll(TShape shape, TText const &text)
+{
+	String<typename Value<TShape>::Type> hashes;
+	hashAll(shape, text, hashes);
+
+	if (length(text) < length(shape))
+	{
+		SEQAN_ASSERT(empty(hashes));
+		return;
+	}
+	SEQAN_ASSERT_EQ(length(hashes), length(text) - length(shape) + 1);
+	for (unsigned i = 0; i < length(hashes); ++i)
+		SEQAN_ASSERT_EQ(hashes[i], hash(shape, begin(text) + i));
+}
+
+SEQAN_DEFINE_TEST(testShapesHashAll)
+{
+	DnaString text;
+	resize(text, 5000);
+	alphabetRandomize(text);
+
+	testHashAll(Shape<Dna, SimpleShape>(6), text);
+	testHashAll(Shape<Dna, UngappedShape<12> >(), text);
+	testHashAll(Shape<Dna, GenericShape>(CharString("11100110100")), text);
+	testHashAll(Shape<Dna, GappedShape<HardwiredShape<1,1,3,1,2> > >(), text);
+	testHashAll(Shape<Dna, OneGappedShape>(CharString("11110011")), text);
+	testHashAll(Shape<Dna, OneGappedShape>(CharString("11110011")), DnaString("ACGTACG"));
+	testHashAll(Shape<Dna, OneGappedShape>(CharString("11110011")), DnaString("ACGTACGT"));
+	testHashAll(Shape<Dna5, GenericShape>(CharString("1101")), Dna5String("ACGNNTTACGAN"));
+
+	// several shapes of different spans in one pass
+	String<Shape<Dna, GenericShape> > shapes;
+	appendValue(shapes, Shape<Dna, GenericShape>(CharString("1101")));
+	appendValue(shapes, Shape<Dna, GenericShape>(CharString("11000000000000011")));
+	appendValue(shapes, Shape<Dna, GenericShape>(CharString("1")));
+	appendValue(shapes, Shape<Dna, GenericShape>(CharString("1011101")));
+
+	for (unsigned textLen = 0; textLen <= length(text); textLen += (textLen < 20)? 1: 2047)
+	{
+		DnaString prefix = infix(text, 0, textLen);
+		StringSet<String<unsigned> > hashes;
+		hashAll(shapes, prefix, hashes);
+		SEQAN_ASSERT_EQ(length(hashes), length(shapes));
+		for (unsigned k = 0; k < length(shapes); ++k)
+		{
+			String<unsigned> expected;
+			hashAll(shapes[k], prefix, expected);
+			SEQAN_ASSERT(hashes[k] == expected);
+		}
+	}
+	testHashAll(shapes[1], infix(text, 0, 16));
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
 
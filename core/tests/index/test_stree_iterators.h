@@ -282,6 +282,58 @@ SEQAN_DEFINE_TEST(testCompareIndices_Esa_Wotd)
 }
 
 
+SEQAN_DEFINE_TEST(testOpenMMap_Esa)
+{
+	typedef Index<CharString, IndexEsa<> > TIndex;
+	typedef Index<String<char, MMap<> >, IndexEsa<MMapFibres> > TMMapIndex;
+	typedef Index<String<char, MMap<> >, IndexEsa<> > TMMapTextIndex;
+
+	CharString text;
+	for (unsigned i = 0; i < 1000; ++i)
+		appendValue(text, "acgt"[pickRandomNumber(getRng()) % 4]);
+
+	CharString tempFilename = SEQAN_TEMP_FILENAME();
+
+	TIndex indexSave(text);
+	indexRequire(indexSave, EsaSA());
+	indexRequire(indexSave, EsaLcp());
+	indexRequire(indexSave, EsaChildtab());
+	indexRequire(indexSave, EsaBwt());
+	SEQAN_ASSERT(save(indexSave, toCString(tempFilename)));
+
+	// The fibres of an index specialized with MMapFibres are mapped read-only.
+	TMMapIndex indexOpen;
+	SEQAN_ASSERT(open(indexOpen, toCString(tempFilename), OPEN_RDONLY));
+	SEQAN_ASSERT(indexSupplied(indexOpen, EsaSA()));
+	SEQAN_ASSERT(indexSupplied(indexOpen, EsaChildtab()));
+	SEQAN_ASSERT_EQ(length(indexText(indexOpen)), length(text));
+	compareTreeIterators(indexSave, indexOpen);
+
+	// Without it only the text is mapped.
+	TMMapTextIndex indexRead;
+	SEQAN_ASSERT(open(indexRead, toCString(tempFilename), OPEN_RDONLY));
+	compareTreeIterators(indexSave, indexRead);
+
+	// Bundles of a newer version or with other fibre value types are rejected.
+	CharString infoFilename = tempFilename;
+	append(infoFilename, ".esa");
+	String<EsaIndexInfo_> infoString;
+	SEQAN_ASSERT(open(infoString, toCString(infoFilename), OPEN_RDONLY));
+	SEQAN_ASSERT_EQ(length(infoString), 1u);
+	EsaIndexInfo_ info = infoString[0];
+
+	infoString[0].version = EsaIndexFileVersion_::VALUE + 1;
+	SEQAN_ASSERT(save(infoString, toCString(infoFilename)));
+	TMMapIndex indexNewer;
+	SEQAN_ASSERT_NOT(open(indexNewer, toCString(tempFilename), OPEN_RDONLY));
+
+	infoString[0] = info;
+	infoString[0].sizeOfSAEntry = info.sizeOfSAEntry + 1;
+	SEQAN_ASSERT(save(infoString, toCString(infoFilename)));
+	TMMapIndex indexOtherType;
+	SEQAN_ASSERT_NOT(open(indexOtherType, toCString(tempFilename), OPEN_RDONLY));
+}
+
 template <typename TIndexSpec>
 void testSTreeIterators()
 {
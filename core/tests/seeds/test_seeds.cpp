@@ -38,6 +38,7 @@
 #include <seqan/file.h>   // Required to print strings in tests.
 
 #include <seqan/seeds.h>  // Include module under test.
+#include <seqan/random.h>  // Random test data.
 
 // #include "test_basic_iter_indirect.h"
 #include "test_seeds_combination.h"
@@ -162,6 +163,8 @@ SEQAN_BEGIN_TESTSUITE(test_seeds)
     SEQAN_CALL_TEST(test_seeds_extension_match_extension_simple);
     SEQAN_CALL_TEST(test_seeds_extension_ungapped_xdrop_extension_simple);
     SEQAN_CALL_TEST(test_seeds_extension_gapped_xdrop_extension_simple);
+    SEQAN_CALL_TEST(test_seeds_extension_gapped_xdrop_score_simple);
+    SEQAN_CALL_TEST(test_seeds_extension_gapped_xdrop_anti_diagonal);
     SEQAN_CALL_TEST(test_seeds_extension_match_extension_chained);
     SEQAN_CALL_TEST(test_seeds_extension_ungapped_xdrop_extension_chained);
 
@@ -352,6 +352,100 @@ testSeedsExtensionGappedXDropExtension(TSeedSpec const &)
 }
 
 
+// Test the score returned by the gapped X-drop extension of simple seeds.
+SEQAN_DEFINE_TEST(test_seeds_extension_gapped_xdrop_score_simple)
+{
+    using namespace seqan;
+
+    typedef Score<int, Simple> TScoringScheme;
+
+    { // Test 1 of the gapped X-drop extension, both directions add up.
+        DnaString database = "AACCCCTTTGGTGAAAAA";
+        DnaString query =    "AAACCCTTTGGGTTTTT";
+        TScoringScheme scoringScheme(2, -1, -1);
+
+        Seed<Simple> seedLeft(4, 4, 3);
+        int scoreLeft = extendSeed(seedLeft, database, query, EXTEND_LEFT, scoringScheme, 1, GappedXDrop());
+        Seed<Simple> seedRight(4, 4, 3);
+        int scoreRight = extendSeed(seedRight, database, query, EXTEND_RIGHT, scoringScheme, 1, GappedXDrop());
+        Seed<Simple> seed(4, 4, 3);
+        int scoreBoth = extendSeed(seed, database, query, EXTEND_BOTH, scoringScheme, 1, GappedXDrop());
+
+        SEQAN_ASSERT_EQ(scoreLeft, globalAlignmentScore(DnaString(prefix(database, 4)), DnaString(prefix(query, 4)),
+                                                         scoringScheme));
+        SEQAN_ASSERT_EQ(scoreRight, globalAlignmentScore(DnaString(infix(database, 7, 14)),
+                                                          DnaString(infix(query, 7, 13)), scoringScheme));
+        SEQAN_ASSERT_EQ(scoreBoth, scoreLeft + scoreRight);
+        SEQAN_ASSERT_EQ(beginPositionH(seed), 0u);
+        SEQAN_ASSERT_EQ(endPositionH(seed), 14u);
+    }
+    { // Nothing to extend.
+        DnaString database = "ACGT";
+        DnaString query =    "ACGT";
+        Seed<Simple> seed(0, 0, 4);
+        SEQAN_ASSERT_EQ(extendSeed(seed, database, query, EXTEND_BOTH, TScoringScheme(2, -1, -1), 5, GappedXDrop()), 0);
+        SEQAN_ASSERT_EQ(endPositionH(seed), 4u);
+    }
+    { // A long extension along a diverged copy, computed over many anti-diagonals.
+        DnaString database, query;
+        Rng<MersenneTwister> rng(17u);
+        for (unsigned i = 0; i < 3000; ++i)
+        {
+            Dna c = Dna(pickRandomNumber(rng) % 4);
+            appendValue(database, c);
+            unsigned r = pickRandomNumber(rng) % 32;
+            if (r == 0)
+                continue;                                  // deletion
+            appendValue(query, (r == 1) ? Dna(c.value ^ 1) : c);   // mismatch
+            if (r == 2)
+                appendValue(query, Dna(pickRandomNumber(rng) % 4));  // insertion
+        }
+        append(database, "TTTTTTTTTTTTTTTTTTTTTTTTTTTTTT");
+        append(query, "GGGGGGGGGGGGGGGGGGGGGGGGGGGGGG");
+
+        TScoringScheme scoringScheme(1, -2, -2);
+        Seed<Simple> seed(0, 0, 0);
+        int extScore = extendSeed(seed, database, query, EXTEND_RIGHT, scoringScheme, 20, GappedXDrop());
+
+        SEQAN_ASSERT_EQ(beginPositionH(seed), 0u);
+        SEQAN_ASSERT_EQ(beginPositionV(seed), 0u);
+        SEQAN_ASSERT_GT(endPositionH(seed), 2900u);
+        SEQAN_ASSERT_LEQ(endPositionH(seed), 3000u + 10u);  // at most 20 / 2 mismatches past the copy
+        SEQAN_ASSERT_EQ(extScore, globalAlignmentScore(DnaString(prefix(database, endPositionH(seed))),
+                                                       DnaString(prefix(query, endPositionV(seed))), scoringScheme));
+    }
+}
+
+// Test the vectorized anti-diagonal kernel of the gapped X-drop extension against the scalar one.
+SEQAN_DEFINE_TEST(test_seeds_extension_gapped_xdrop_anti_diagonal)
+{
+    using namespace seqan;
+
+    int const undefined = MinValue<int>::VALUE + 1;
+    Rng<MersenneTwister> rng(3u);
+    for (unsigned count = 0; count < 40; ++count)
+    {
+        String<int> antiDiag1, antiDiag2, subst, simdResult, scalarResult;
+        for (unsigned k = 0; k <= count; ++k)
+        {
+            appendValue(antiDiag1, (pickRandomNumber(rng) % 8 == 0) ? undefined : (int)(pickRandomNumber(rng) % 50));
+            appendValue(antiDiag2, (pickRandomNumber(rng) % 8 == 0) ? undefined : (int)(pickRandomNumber(rng) % 50));
+            appendValue(subst, (pickRandomNumber(rng) % 2) ? 2 : -3);
+        }
+        resize(simdResult, count + 1, 0);
+        resize(scalarResult, count + 1, 0);
+
+        int simdBest = _computeXDropAntiDiag(begin(simdResult, Standard()), begin(antiDiag2, Standard()),
+                                             begin(antiDiag1, Standard()), begin(subst, Standard()), count,
+                                             -1, 20, undefined);
+        int scalarBest = _computeXDropAntiDiag<int>(begin(scalarResult, Standard()), begin(antiDiag2, Standard()),
+                                                    begin(antiDiag1, Standard()), begin(subst, Standard()), count,
+                                                    -1, 20, undefined);
+        SEQAN_ASSERT_EQ(simdBest, scalarBest);
+        SEQAN_ASSERT(simdResult == scalarResult);
+    }
+}
+
 // Test the seed extension algorithm with match extension for simple seeds.
 SEQAN_DEFINE_TEST(test_seeds_extension_match_extension_simple)
 {
@@ -37,6 +37,7 @@
 #include <seqan/basic.h>
 #include <seqan/file.h>
 #include <seqan/stream.h>
+#include <seqan/random.h>
 
 #include "test_stream_char_array.h"
 #if SEQAN_HAS_ZLIB
@@ -110,6 +111,14 @@ SEQAN_BEGIN_TESTSUITE(test_stream)
 
     SEQAN_CALL_TEST(test_stream_bgzf_write_large_and_compare_with_file);
     SEQAN_CALL_TEST(test_stream_bgzf_from_file_and_compare);
+    SEQAN_CALL_TEST(test_stream_bgzf_from_file_and_compare_parallel);
+    SEQAN_CALL_TEST(test_stream_bgzf_seek_parallel);
+    SEQAN_CALL_TEST(test_stream_bgzf_read_error_parallel);
+    SEQAN_CALL_TEST(test_stream_bgzf_write_large_and_compare_with_file_parallel);
+    SEQAN_CALL_TEST(test_stream_bgzf_write_parallel_compression_level);
+    SEQAN_CALL_TEST(test_stream_bgzf_tell_parallel);
+    SEQAN_CALL_TEST(test_stream_bgzf_cache_lru);
+    SEQAN_CALL_TEST(test_stream_bgzf_cache_shared);
 #endif  // #if SEQAN_HAS_ZLIB
 
 #if SEQAN_HAS_BZIP2  // Enable tests for Stream<BZ2File> if available.
@@ -526,4 +526,398 @@ SEQAN_DEFINE_TEST(test_stream_bgzf_from_file_and_compare)
     SEQAN_ASSERT(feof(inFasta));
 }
 
+// Read with the parallel read-ahead pipeline, use fewer read-ahead blocks than there are in the file.
+SEQAN_DEFINE_TEST(test_stream_bgzf_from_file_and_compare_parallel)
+{
+    using namespace seqan;
+
+    // Define paths to BGZF and FASTA file.
+    char gzPath[1000];
+    strcpy(gzPath, SEQAN_PATH_TO_ROOT());
+    strcat(gzPath, "/core/tests/stream/SRR067601_1.1k.fasta.gz");
+    char fastaPath[1000];
+    strcpy(fastaPath, SEQAN_PATH_TO_ROOT());
+    strcat(fastaPath, "/core/tests/stream/SRR067601_1.1k.fasta");
+
+    // Open files.
+    Stream<Bgzf> inBgzf;
+    SEQAN_ASSERT(open(inBgzf, gzPath, "r"));
+    setNumThreads(inBgzf, 4, 3);
+
+    FILE * inFasta = fopen(fastaPath, "rb");
+    SEQAN_ASSERT(inFasta != NULL);
+
+    // Read files in chunks that do not align with the block boundaries.
+    char buffer1[1000];
+    char buffer2[1000];
+    int i = 0;
+    while (!streamEof(inBgzf))
+    {
+        int len1 = streamReadBlock(buffer1, inBgzf, 999);
+        int len2 = fread(buffer2, 1, 999, inFasta);
+        SEQAN_ASSERT_EQ_MSG(len1, len2, "At chunk starting at character pos %d", i);
+        SEQAN_ASSERT_EQ_MSG(memcmp(buffer1, buffer2, len1), 0, "At chunk starting at character pos %d", i);
+        i += len1;
+    }
+
+    SEQAN_ASSERT_EQ(i, 253451);
+    SEQAN_ASSERT_LT(fgetc(inFasta), 0);
+    fclose(inFasta);
+}
+
+// Seeking with the parallel read-ahead pipeline, forward into the queue and backward out of it.
+SEQAN_DEFINE_TEST(test_stream_bgzf_seek_parallel)
+{
+    using namespace seqan;
+
+    char gzPath[1000];
+    strcpy(gzPath, SEQAN_PATH_TO_ROOT());
+    strcat(gzPath, "/core/tests/stream/SRR067601_1.1k.fasta.gz");
+
+    // Collect virtual offsets and characters with sequential reading.
+    String<__int64> offsets;
+    String<char> chars;
+    {
+        Stream<Bgzf> inBgzf;
+        SEQAN_ASSERT(open(inBgzf, gzPath, "r"));
+        char c = '\0';
+        for (int i = 0; !streamEof(inBgzf); ++i)
+        {
+            __int64 offset = streamTell(inBgzf);
+            SEQAN_ASSERT_EQ(streamReadChar(c, inBgzf), 0);
+            if (i % 10007 == 0)
+            {
+                appendValue(offsets, offset);
+                appendValue(chars, c);
+            }
+        }
+    }
+
+    Stream<Bgzf> inBgzf;
+    SEQAN_ASSERT(open(inBgzf, gzPath, "r"));
+    setNumThreads(inBgzf, 2, 2);
+    char c = '\0';
+    for (unsigned i = 0; i < length(offsets); i += 2)
+    {
+        SEQAN_ASSERT_EQ(streamSeek(inBgzf, offsets[i], SEEK_SET), 0);
+        SEQAN_ASSERT_EQ(streamReadChar(c, inBgzf), 0);
+        SEQAN_ASSERT_EQ(c, chars[i]);
+    }
+    for (unsigned i = length(offsets); i > 0; --i)
+    {
+        SEQAN_ASSERT_EQ(streamSeek(inBgzf, offsets[i - 1], SEEK_SET), 0);
+        SEQAN_ASSERT_EQ(streamReadChar(c, inBgzf), 0);
+        SEQAN_ASSERT_EQ(c, chars[i - 1]);
+    }
+}
+
+// A read error after some blocks must not drop the blocks before it, with or without the read-ahead queue.
+SEQAN_DEFINE_TEST(test_stream_bgzf_read_error_parallel)
+{
+    using namespace seqan;
+
+    char gzPath[1000];
+    strcpy(gzPath, SEQAN_PATH_TO_ROOT());
+    strcat(gzPath, "/core/tests/stream/SRR067601_1.1k.fasta.gz");
+
+    // Copy the file without its EOF block and append an invalid block header.
+    const char * tempFilename = SEQAN_TEMP_FILENAME();
+    {
+        FILE * in = fopen(gzPath, "rb");
+        SEQAN_ASSERT(in != NULL);
+        String<char> data;
+        char buffer[1000];
+        for (size_t len; (len = fread(buffer, 1, sizeof(buffer), in)) > 0u;)
+            append(data, infix(buffer, 0, len));
+        fclose(in);
+        resize(data, length(data) - 28);
+        resize(data, length(data) + 20, 'X');
+
+        FILE * out = fopen(tempFilename, "wb");
+        SEQAN_ASSERT(out != NULL);
+        SEQAN_ASSERT_EQ(fwrite(&data[0], 1, length(data), out), length(data));
+        fclose(out);
+    }
+
+    for (unsigned numThreads = 1; numThreads <= 4; numThreads += 3)
+    {
+        Stream<Bgzf> inBgzf;
+        SEQAN_ASSERT(open(inBgzf, tempFilename, "r"));
+        setNumThreads(inBgzf, numThreads, 100);
+
+        char c = '\0';
+        int res = 0;
+        int count = 0;
+        while ((res = streamReadChar(c, inBgzf)) == 0)
+            ++count;
+        SEQAN_ASSERT_EQ(res, -2);
+        SEQAN_ASSERT_EQ(count, 253451);
+    }
+}
+
+// Writing with parallel compression must yield the same file as sequential writing.
+SEQAN_DEFINE_TEST(test_stream_bgzf_write_large_and_compare_with_file_parallel)
+{
+    using namespace seqan;
+
+    // Open test file for reading.
+    char tempPath[1000];
+    strcpy(tempPath, SEQAN_PATH_TO_ROOT());
+    strcat(tempPath, "/core/tests/stream/SRR067601_1.1k.fasta");
+    FILE * fp = fopen(tempPath, "rb");
+    SEQAN_ASSERT(fp != NULL);
+
+    // Open BGZF stream for writing, collect fewer blocks than there are in the file.
+    const char * p = SEQAN_TEMP_FILENAME();
+    char outFilename[1000];
+    strcpy(outFilename, p);
+
+    Stream<Bgzf> stream;
+    SEQAN_ASSERT(open(stream, outFilename, "w"));
+    setNumThreads(stream, 4, 3);
+
+    // Copy from fp to stream.
+    String<char> buffer;
+    resize(buffer, 765);
+    while (!feof(fp))
+    {
+        int len = fread(&buffer[0], 1, 765, fp);
+        SEQAN_ASSERT_EQ(streamWriteBlock(stream, &buffer[0], len), static_cast<size_t>(len));
+    }
+    fclose(fp);
+    close(stream);
+
+    // Compare with file written sequentially.
+    char inPath1[1000];
+    strcpy(inPath1, SEQAN_PATH_TO_ROOT());
+    strcat(inPath1, "/core/tests/stream/SRR067601_1.1k.fasta.gz");
+    FILE * fin1 = fopen(inPath1, "rb");
+    SEQAN_ASSERT(fin1 != NULL);
+    FILE * fin2 = fopen(outFilename, "rb");
+    SEQAN_ASSERT(fin2 != NULL);
+
+    int i = 0;
+    while (!feof(fin1) && !feof(fin2))
+    {
+        int i1 = fgetc(fin1);
+        int i2 = fgetc(fin2);
+        SEQAN_ASSERT_EQ_MSG(i1, i2, "At character pos %d", i);
+        ++i;
+    }
+
+    SEQAN_ASSERT(feof(fin1));
+    SEQAN_ASSERT(feof(fin2));
+    fclose(fin1);
+    fclose(fin2);
+}
+
+// Parallel compression of incompressible data and with compression level 0, read back and compare.
+SEQAN_DEFINE_TEST(test_stream_bgzf_write_parallel_compression_level)
+{
+    using namespace seqan;
+
+    // Generate pseudo-random, incompressible data spanning several blocks.
+    String<char> data;
+    resize(data, 300 * 1000);
+    Rng<MersenneTwister> rng(42u);
+    for (unsigned i = 0; i < length(data); ++i)
+        data[i] = static_cast<char>(pickRandomNumber(rng));
+
+    for (int level = 0; level <= 9; level += 9)
+    {
+        const char * p = SEQAN_TEMP_FILENAME();
+        char outFilename[1000];
+        strcpy(outFilename, p);
+
+        Stream<Bgzf> stream;
+        SEQAN_ASSERT(open(stream, outFilename, "w"));
+        setNumThreads(stream, 2);
+        setCompressionLevel(stream, level);
+        SEQAN_ASSERT_EQ(streamWriteBlock(stream, &data[0], length(data)), length(data));
+        close(stream);
+
+        Stream<Bgzf> inBgzf;
+        SEQAN_ASSERT(open(inBgzf, outFilename, "r"));
+        String<char> buffer;
+        resize(buffer, length(data) + 1);
+        SEQAN_ASSERT_EQ(streamReadBlock(&buffer[0], inBgzf, length(buffer)), length(data));
+        resize(buffer, length(data));
+        SEQAN_ASSERT(buffer == data);
+        SEQAN_ASSERT(checkEofIsValid(inBgzf));
+    }
+}
+
+// Copy the test file to a BGZF file using numThreads threads and collect the virtual offsets before each chunk.
+inline void
+_testStreamBgzfWriteTell(seqan::String<__int64> & offsets, char const * outFilename, unsigned numThreads)
+{
+    using namespace seqan;
+
+    char tempPath[1000];
+    strcpy(tempPath, SEQAN_PATH_TO_ROOT());
+    strcat(tempPath, "/core/tests/stream/SRR067601_1.1k.fasta");
+    FILE * fp = fopen(tempPath, "rb");
+    SEQAN_ASSERT(fp != NULL);
+
+    Stream<Bgzf> stream;
+    SEQAN_ASSERT(open(stream, outFilename, "w"));
+    setNumThreads(stream, numThreads, 3);
+
+    String<char> buffer;
+    resize(buffer, 765);
+    while (!feof(fp))
+    {
+        int len = fread(&buffer[0], 1, 765, fp);
+        appendValue(offsets, streamTell(stream));
+        SEQAN_ASSERT_EQ(streamWriteBlock(stream, &buffer[0], len), static_cast<size_t>(len));
+    }
+    fclose(fp);
+    SEQAN_ASSERT_EQ(streamError(stream), 0);
+    close(stream);
+}
+
+// The virtual offsets while writing with parallel compression must be the same as with sequential writing.
+SEQAN_DEFINE_TEST(test_stream_bgzf_tell_parallel)
+{
+    using namespace seqan;
+
+    char outFilename1[1000];
+    strcpy(outFilename1, SEQAN_TEMP_FILENAME());
+    char outFilename2[1000];
+    strcpy(outFilename2, SEQAN_TEMP_FILENAME());
+
+    String<__int64> offsets1, offsets2;
+    _testStreamBgzfWriteTell(offsets1, outFilename1, 1);
+    _testStreamBgzfWriteTell(offsets2, outFilename2, 4);
+    SEQAN_ASSERT_EQ(length(offsets1), length(offsets2));
+    for (unsigned i = 0; i < length(offsets1); ++i)
+        SEQAN_ASSERT_EQ_MSG(offsets1[i], offsets2[i], "At chunk %u", i);
+
+    // The offsets point to the chunks in the file written in parallel.
+    char tempPath[1000];
+    strcpy(tempPath, SEQAN_PATH_TO_ROOT());
+    strcat(tempPath, "/core/tests/stream/SRR067601_1.1k.fasta");
+    FILE * fp = fopen(tempPath, "rb");
+    SEQAN_ASSERT(fp != NULL);
+
+    Stream<Bgzf> inBgzf;
+    SEQAN_ASSERT(open(inBgzf, outFilename2, "r"));
+    for (unsigned i = 0; i + 1 < length(offsets2); ++i)
+    {
+        SEQAN_ASSERT_EQ(fseek(fp, i * 765, SEEK_SET), 0);
+        SEQAN_ASSERT_EQ(streamSeek(inBgzf, offsets2[i], SEEK_SET), 0);
+        char c = '\0';
+        SEQAN_ASSERT_EQ(streamReadChar(c, inBgzf), 0);
+        SEQAN_ASSERT_EQ(c, static_cast<char>(fgetc(fp)));
+    }
+    fclose(fp);
+}
+
+// Collect the virtual offsets of the beginnings of the blocks in the test file and their first characters.
+inline void
+_testStreamBgzfBlockOffsets(seqan::String<__int64> & offsets, seqan::String<char> & chars, char const * path)
+{
+    using namespace seqan;
+
+    Stream<Bgzf> inBgzf;
+    SEQAN_ASSERT(open(inBgzf, path, "r"));
+    char c = '\0';
+    while (!streamEof(inBgzf))
+    {
+        __int64 offset = streamTell(inBgzf);
+        SEQAN_ASSERT_EQ(streamReadChar(c, inBgzf), 0);
+        if (empty(offsets) || (back(offsets) >> 16) != (offset >> 16))
+        {
+            appendValue(offsets, offset);
+            appendValue(chars, c);
+        }
+    }
+}
+
+// Test LRU eviction and hit/miss counters of the block cache.
+SEQAN_DEFINE_TEST(test_stream_bgzf_cache_lru)
+{
+    using namespace seqan;
+
+    char gzPath[1000];
+    strcpy(gzPath, SEQAN_PATH_TO_ROOT());
+    strcat(gzPath, "/core/tests/stream/SRR067601_1.1k.fasta.gz");
+
+    String<__int64> offsets;
+    String<char> chars;
+    _testStreamBgzfBlockOffsets(offsets, chars, gzPath);
+    SEQAN_ASSERT_GEQ(length(offsets), 3u);
+
+    // The cache can hold two full blocks.
+    Stream<Bgzf> inBgzf;
+    SEQAN_ASSERT(open(inBgzf, gzPath, "r"));
+    setMaxCacheSize(inBgzf, 2 * 64 * 1024);
+    BgzfBlockCache & cache = blockCache(inBgzf);
+
+    int const SEQUENCE[6] = { 0, 1, 0, 2, 0, 1 };
+    char c = '\0';
+    for (unsigned i = 0; i < 6; ++i)
+    {
+        SEQAN_ASSERT_EQ(streamSeek(inBgzf, offsets[SEQUENCE[i]], SEEK_SET), 0);
+        SEQAN_ASSERT_EQ(streamReadChar(c, inBgzf), 0);
+        SEQAN_ASSERT_EQ(c, chars[SEQUENCE[i]]);
+    }
+
+    // Block 1 was evicted when loading block 2 since block 0 was used more recently.
+    SEQAN_ASSERT_EQ(getCacheHits(cache), 2u);
+    SEQAN_ASSERT_EQ(getCacheMisses(cache), 4u);
+    SEQAN_ASSERT_EQ(getCacheSize(cache), 2 * 64 * 1024);
+
+    // Shrinking the cache evicts the least recently used block 0.
+    setMaxCacheSize(cache, 64 * 1024);
+    SEQAN_ASSERT_EQ(getCacheSize(cache), 64 * 1024);
+    SEQAN_ASSERT_EQ(streamSeek(inBgzf, offsets[0], SEEK_SET), 0);
+    SEQAN_ASSERT_EQ(streamReadChar(c, inBgzf), 0);
+    SEQAN_ASSERT_EQ(getCacheMisses(cache), 5u);
+
+    clear(cache);
+    SEQAN_ASSERT_EQ(getCacheSize(cache), 0);
+}
+
+// Test sharing of a block cache between two streams.
+SEQAN_DEFINE_TEST(test_stream_bgzf_cache_shared)
+{
+    using namespace seqan;
+
+    char gzPath[1000];
+    strcpy(gzPath, SEQAN_PATH_TO_ROOT());
+    strcat(gzPath, "/core/tests/stream/SRR067601_1.1k.fasta.gz");
+
+    String<__int64> offsets;
+    String<char> chars;
+    _testStreamBgzfBlockOffsets(offsets, chars, gzPath);
+
+    BgzfBlockCache cache(1024 * 1024);
+    Stream<Bgzf> inBgzf1, inBgzf2;
+    SEQAN_ASSERT(open(inBgzf1, gzPath, "r"));
+    SEQAN_ASSERT(open(inBgzf2, gzPath, "r"));
+    setBlockCache(inBgzf1, cache);
+    setBlockCache(inBgzf2, cache);
+
+    // Read whole file through first stream.
+    char c = '\0';
+    while (!streamEof(inBgzf1))
+        SEQAN_ASSERT_EQ(streamReadChar(c, inBgzf1), 0);
+    SEQAN_ASSERT_EQ(getCacheHits(cache), 0u);
+    SEQAN_ASSERT_EQ(getCacheMisses(cache), length(offsets) + 1);  // The last lookup is for the EOF block.
+
+    // Seeking with the second stream only yields hits.
+    for (unsigned i = length(offsets); i > 0; --i)
+    {
+        SEQAN_ASSERT_EQ(streamSeek(inBgzf2, offsets[i - 1], SEEK_SET), 0);
+        SEQAN_ASSERT_EQ(streamReadChar(c, inBgzf2), 0);
+        SEQAN_ASSERT_EQ(c, chars[i - 1]);
+    }
+    SEQAN_ASSERT_EQ(getCacheHits(cache), length(offsets));
+
+    // Closing a stream does not clear a shared cache.
+    close(inBgzf1);
+    SEQAN_ASSERT_GT(getCacheSize(cache), 0);
+}
+
 #endif // #ifndef CORE_TESTS_STREAM_TEST_STREAM_BGZF_H_